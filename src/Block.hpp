@@ -112,6 +112,9 @@ class Block {
 
 		/// pointers to alignments representing vertical bus, if any
 		mutable std::list<CorblivarAlignmentReq*> alignments_vertical_bus;
+		/// pointers to all alignments covering this block, if any; ordered as
+		/// the alignments themselves
+		mutable std::vector<CorblivarAlignmentReq const*> alignments;
 
 		/// The power_density_unscaled is read in from the benchmarks (where voltage
 		/// assignment was not considered), representing the baseline power
@@ -226,8 +229,9 @@ class Block {
 			}
 		}
 
-		/// vector of contiguous neighbours, required for voltage assignment
-		mutable std::vector<ContiguityAnalysis::ContiguousNeighbour> contiguous_neighbours;
+		/// contiguous neighbours, required for voltage assignment; determined and
+		/// held by ContiguityAnalysis::analyseBlocks
+		mutable ContiguityAnalysis::Neighbours contiguous_neighbours;
 
 		/// rectangle, represents block geometry and placement
 		mutable Rect bb, bb_backup, bb_best;
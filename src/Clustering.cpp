@@ -26,6 +26,7 @@
 // required Corblivar headers
 #include "Net.hpp"
 
+
 /// For clustering, a ``chicken-egg'' problem arises: the clustered TSVs impact the thermal
 /// analysis, but for clustering TSVs we require the result of the thermal analysis. Thus,
 /// the determination of hotspots, which are the source for clustering TSVs into islands,
@@ -36,13 +37,9 @@
 /// results, and 3) perform the thermal analysis again, w/ consideration of TSVs.)
 // TODO according to valgrind/callgrind, the efforts for thermal analysis are around 8%, whereas the efforts for determineHotspots are 30%; thus, we could also allow for the
 // additional efforts for another run of thermal analysis
-void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vector<Segments> > &nets_segments, std::vector<TSV_Island> &TSVs, double const& TSV_pitch, unsigned const& upper_limit_TSVs, ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis) {
-	unsigned i, j;
-	std::vector<Segments>::iterator it_seg;
-	std::list<Net*>::iterator it_net;
-	Rect intersection, cluster;
-	bool all_clustered;
-	std::list<Cluster>::iterator it_cluster;
+void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vector<Segments> > &nets_segments, std::vector<TSV_Island> &TSVs, double const& TSV_pitch, unsigned const& upper_limit_TSVs, ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis, ThermalSolver::Workers* workers) {
+	unsigned i, c;
+	unsigned segments;
 
 	if (Clustering::DBG) {
 		std::cout << "-> Clustering::clusterSignalTSVs(" << &nets << ", " << &nets_segments << ", " << &thermal_analysis << ")" << std::endl;
@@ -52,256 +49,332 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 	// thermal-analysis run
 	this->determineHotspots(thermal_analysis);
 
-	// reset previous cluster
-	this->clusters.clear();
+	// reset previous cluster; allocate cluster lists and buffers for all layers
+	this->clusters.resize(nets_segments.size());
+	this->layer_buffers.resize(nets_segments.size());
 
-	// perform layer-wise clustering
+	// perform layer-wise clustering; the layers are independent, thus they are
+	// clustered concurrently by the workers, if given and if there are enough
+	// segments; the first layer is clustered in the calling thread
+	//
+	// note that dbg output would be interleaved for concurrent layers
+	segments = 0;
 	for (i = 0; i < nets_segments.size(); i++) {
+		segments += nets_segments[i].size();
+	}
 
-		// sort the nets' bounding boxes by their area
-		std::sort(nets_segments[i].begin(), nets_segments[i].end(),
-			// lambda expression
-			[](Segments const& sn1, Segments const& sn2) {
-				// std::sort requires a _strict_ ordering, thus we have to make sure that same elements returns false
-				// http://stackoverflow.com/a/1541909
-				// this is ensured by comparing using greater-than operator
-				return (sn1.bb.area > sn2.bb.area);
-			}
-		);
+	if (workers != nullptr && segments >= Clustering::SEGMENTS_PER_THREAD_MIN * nets_segments.size() &&
+			!Clustering::DBG_CLUSTERING && !Clustering::DBG_CLUSTERING_FINAL) {
 
-		// dbg, display all nets to consider for clustering
-		if (Clustering::DBG_CLUSTERING) {
+		workers->run([&](unsigned const& partition) {
+				this->clusterSignalTSVsLayer(partition, nets_segments[partition], TSV_pitch, upper_limit_TSVs, TSVs);
+			}, nets_segments.size());
+	}
+	else {
+		for (i = 0; i < nets_segments.size(); i++) {
+			this->clusterSignalTSVsLayer(i, nets_segments[i], TSV_pitch, upper_limit_TSVs, TSVs);
+		}
+	}
+
+	// store TSV islands of all layers into global TSV container, in the order of
+	// layers and clusters
+	//
+	// also link TSVs (blocks) to the respective nets; this is required for
+	// more accurate wirelength estimation
+	//
+	// since the container "TSVs" will be reallocated subsequently, we
+	// cannot use pointers to its elements; for simplicity (to avoid
+	// later on traversal and search of matching TSV islands for nets)
+	// we simply copy TSVs islands into nets
+	//
+	for (i = 0; i < nets_segments.size(); i++) {
+
+		LayerBuffers& buffers = this->layer_buffers[i];
+
+		for (c = 0; c < this->clusters[i].size(); c++) {
 
-			std::cout << "DBG_CLUSTERING> nets to consider for clustering on layer " << i << ":" << std::endl;
+			TSV_Island& TSVi = buffers.TSVs[buffers.prev_TSVs + c];
 
-			for (it_seg = nets_segments[i].begin(); it_seg != nets_segments[i].end(); ++it_seg) {
-				std::cout << "DBG_CLUSTERING>  net id: " << it_seg->net->id << std::endl;
-				std::cout << "DBG_CLUSTERING>   bb area: " << it_seg->bb.area << std::endl;
+			for (Net* net : this->clusters[i][c].nets) {
+				net->TSVs.push_back(TSVi);
 			}
 
-			std::cout << "DBG_CLUSTERING>" << std::endl;
+			TSVs.push_back(std::move(TSVi));
 		}
+	}
 
-		// reset cluster flags of nets to consider on this layer
-		for (it_seg = nets_segments[i].begin(); it_seg != nets_segments[i].end(); ++it_seg) {
-			(*it_seg).net->clustered = false;
+	if (Clustering::DBG) {
+		std::cout << "<- Clustering::clusterSignalTSVs" << std::endl;
+	}
+}
+
+/// The net segments are merged into clusters in the order of decreasing bb areas: the
+/// first segment not clustered yet initializes a new cluster, and all further segments
+/// which overlap the cluster region are merged, again in order of decreasing bb areas,
+/// where the cluster region is shrunk to the intersection w/ each merged segment. Since
+/// the cluster region is only shrinking, only segments overlapping the initial region
+/// are to be considered; these are determined in one sweep over the segments not
+/// clustered yet, which are kept compacted.
+///
+/// Note that the clustering is thus O(clusters * segments) per layer; spatial indices
+/// for the segments, i.e., uniform and hierarchical grids as well as an R-tree
+/// (sort-tile-recursive packing), are not competitive for the typical count of
+/// segments per layer (around 1,000 for n300, w/ around 90 clusters): most segments
+/// span large parts of the die, and building such an index alone takes as long as all
+/// the branch-free sweeps.
+void Clustering::clusterSignalTSVsLayer(unsigned const& layer, std::vector<Segments> &segments, double const& TSV_pitch, unsigned const& upper_limit_TSVs, std::vector<TSV_Island> const& TSVs) {
+	unsigned s, p, c;
+	unsigned seed;
+	unsigned candidates;
+	Rect intersection, cluster;
+	LayerBuffers& buffers = this->layer_buffers[layer];
+	std::vector<Cluster>& clusters = this->clusters[layer];
+
+	// reset previous cluster
+	clusters.clear();
+
+	// sort the nets' bounding boxes by their area
+	std::sort(segments.begin(), segments.end(),
+		// lambda expression
+		[](Segments const& sn1, Segments const& sn2) {
+			// std::sort requires a _strict_ ordering, thus we have to make sure that same elements returns false
+			// http://stackoverflow.com/a/1541909
+			// this is ensured by comparing using greater-than operator
+			return (sn1.bb.area > sn2.bb.area);
 		}
+	);
 
-		// allocate cluster list
-		this->clusters.emplace_back(std::list<Cluster>());
+	// dbg, display all nets to consider for clustering
+	if (Clustering::DBG_CLUSTERING) {
 
-		// iteratively merge net segments into clusters; try at most so many times
-		// like nets are to considered on this layer
-		for (j = 1; j <= nets_segments[i].size(); j++) {
+		std::cout << "DBG_CLUSTERING> nets to consider for clustering on layer " << layer << ":" << std::endl;
 
-			if (Clustering::DBG_CLUSTERING) {
-				std::cout << "DBG_CLUSTERING> clustering of net segments; clustering iteration " << j << std::endl;
-			}
+		for (Segments const& seg : segments) {
+			std::cout << "DBG_CLUSTERING>  net id: " << seg.net->id << std::endl;
+			std::cout << "DBG_CLUSTERING>   bb area: " << seg.bb.area << std::endl;
+		}
 
-			// reset cluster
-			cluster.area = 0.0;
-			// reset clustering flag
-			all_clustered = true;
+		std::cout << "DBG_CLUSTERING>" << std::endl;
+	}
 
-			for (it_seg = nets_segments[i].begin(); it_seg != nets_segments[i].end(); ++it_seg) {
+	// init active segments, i.e., segments not clustered yet, in the order of sorted
+	// segments; the bb coordinates are kept along for better locality
+	//
+	buffers.active.resize(segments.size());
+	for (s = 0; s < segments.size(); s++) {
+		buffers.active[s] = {
+			s,
+			segments[s].bb.ll.x,
+			segments[s].bb.ll.y,
+			segments[s].bb.ur.x,
+			segments[s].bb.ur.y
+		};
+	}
+	buffers.candidates.resize(segments.size());
 
-				// ignore already clustered segments
-				if ((*it_seg).net->clustered) {
-					continue;
-				}
-				else {
-					// memorize that at least one net is not clustered
-					// yet
-					all_clustered = false;
-
-					// init new cluster if not done yet
-					if (cluster.area == 0.0) {
-
-						if (Clustering::DBG_CLUSTERING) {
-							std::cout << "DBG_CLUSTERING> init new cluster..." << std::endl;
-							std::cout << "DBG_CLUSTERING>  initial net: " << (*it_seg).net->id << std::endl;
-						}
-
-						// actual init
-						this->clusters[i].push_back({
-								// init list of nets with
-								// this initial net
-								std::list<Net*>(1, (*it_seg).net),
-								// init enclosing bb with
-								// this initial net
-								(*it_seg).bb,
-								// dummy hotspot id, since
-								// cluster is not
-								// associated with any
-								// hotspot yet
-								0
-							});
-
-						// memorize initial cluster
-						cluster = (*it_seg).bb;
-
-						// also mark initial net as clustered now
-						(*it_seg).net->clustered = true;
-
-						// try to merge with any hotspot;
-						// considering the most critical ones
-						// first, done via iteration of
-						// score-sorted map
-						//
-						// note that this step is implicitly
-						// ignored when thermal optimization and
-						// thus thermal analysis are deactivated
-						//
-						for (Hotspot const& cur_hotspot : this->hotspots) {
-
-							intersection = Rect::determineIntersection(cluster, cur_hotspot.bb);
-
-							// this hotspot overlaps the
-							// initial net; consider their
-							// intersection for further
-							// clustering
-							if (intersection.area != 0.0) {
-
-								cluster = intersection;
-
-								if (Clustering::DBG_CLUSTERING) {
-									std::cout << "DBG_CLUSTERING>  considering hotspot ";
-									std::cout << cur_hotspot.id << " for this cluster" << std::endl;
-								}
-
-								//also memorize hotspot id
-								//in cluster itself
-								this->clusters[i].back().hotspot_id = cur_hotspot.id;
-
-								break;
-							}
-						}
-					}
-					// cluster is already initialized; try to merge
-					// (further) segments into current cluster; only
-					// until upper limit of TSVs per cluster is not
-					// reached yet
-					else if (this->clusters[i].back().nets.size() < upper_limit_TSVs) {
-
-						// determine intersection of cluster w/
-						// current segment
-						intersection = Rect::determineIntersection(cluster, (*it_seg).bb);
-
-						// ignore merges which would results in
-						// empty (i.e., non-overlapping) segments
-						if (intersection.area == 0.0) {
-
-							if (Clustering::DBG_CLUSTERING) {
-								std::cout << "DBG_CLUSTERING>  ignore net " << (*it_seg).net->id << " for this cluster" << std::endl;
-							}
-
-							continue;
-						}
-						// else update cluster
-						else {
-							this->clusters[i].back().nets.push_back((*it_seg).net);
-							this->clusters[i].back().bb = intersection;
-
-							// also update cluster-region
-							// monitor variable
-							cluster = intersection;
-
-							// also mark net as clustered now
-							(*it_seg).net->clustered = true;
-
-							if (Clustering::DBG_CLUSTERING) {
-								std::cout << "DBG_CLUSTERING>  add net " << (*it_seg).net->id << " to this cluster" << std::endl;
-							}
-						}
-					}
+	// iteratively merge net segments into clusters; each cluster is initialized by the
+	// first segment not clustered yet
+	//
+	while (!buffers.active.empty()) {
+
+		seed = buffers.active.front().segment;
+
+		if (Clustering::DBG_CLUSTERING) {
+			std::cout << "DBG_CLUSTERING> init new cluster..." << std::endl;
+			std::cout << "DBG_CLUSTERING>  initial net: " << segments[seed].net->id << std::endl;
+		}
+
+		// actual init
+		clusters.push_back({
+				// init list of nets with this initial net
+				std::vector<Net*>(1, segments[seed].net),
+				// init enclosing bb with this initial net
+				segments[seed].bb,
+				// dummy hotspot id, since cluster is not associated with
+				// any hotspot yet
+				0
+			});
+
+		// memorize initial cluster
+		cluster = segments[seed].bb;
+
+		// try to merge with any hotspot; considering the most critical ones first,
+		// done via iteration of score-sorted map
+		//
+		// note that this step is implicitly ignored when thermal optimization and
+		// thus thermal analysis are deactivated
+		//
+		for (Hotspot const& cur_hotspot : this->hotspots) {
+
+			intersection = Rect::determineIntersection(cluster, cur_hotspot.bb);
+
+			// this hotspot overlaps the initial net; consider their intersection
+			// for further clustering
+			if (intersection.area != 0.0) {
+
+				cluster = intersection;
+
+				if (Clustering::DBG_CLUSTERING) {
+					std::cout << "DBG_CLUSTERING>  considering hotspot ";
+					std::cout << cur_hotspot.id << " for this cluster" << std::endl;
 				}
-			}
 
-			if (Clustering::DBG_CLUSTERING) {
-				std::cout << "DBG_CLUSTERING>" << std::endl;
-			}
+				//also memorize hotspot id in cluster itself
+				clusters.back().hotspot_id = cur_hotspot.id;
 
-			// break merge loop in case all nets have been already clustered
-			if (all_clustered) {
 				break;
 			}
 		}
 
-		// dbg, display all cluster
-		if (Clustering::DBG_CLUSTERING_FINAL) {
+		// determine candidates, i.e., active segments which overlap the cluster
+		// region; the candidates are collected w/o branching
+		//
+		// note that empty cluster regions cannot be merged w/ any segment; also
+		// consider upper limit of TSVs per cluster
+		//
+		candidates = 0;
+		if (cluster.area != 0.0 && clusters.back().nets.size() < upper_limit_TSVs) {
 
-			std::cout << "DBG_CLUSTERING> final set of clusters on layer " << i << ":" << std::endl;
-			std::cout << "DBG_CLUSTERING>" << std::endl;
+			for (p = 1; p < buffers.active.size(); p++) {
 
-			for (it_cluster = this->clusters[i].begin(); it_cluster != this->clusters[i].end(); ++it_cluster) {
+				ActiveSegment const& act = buffers.active[p];
 
-				std::cout << "DBG_CLUSTERING>  cluster bb:";
-				std::cout << " (" << (*it_cluster).bb.ll.x << ",";
-				std::cout << (*it_cluster).bb.ll.y << "),";
-				std::cout << " (" << (*it_cluster).bb.ur.x << ",";
-				std::cout << (*it_cluster).bb.ur.y << ")" << std::endl;
+				buffers.candidates[candidates] = p;
 
-				std::cout << "DBG_CLUSTERING>  associated hotspot:" << (*it_cluster).hotspot_id << std::endl;
+				// consider only segments overlapping the cluster region,
+				// i.e., segments which may have an intersection w/ positive
+				// area
+				candidates +=
+					(act.ll_x < cluster.ur.x) &
+					(cluster.ll.x < act.ur_x) &
+					(act.ll_y < cluster.ur.y) &
+					(cluster.ll.y < act.ur_y);
+			}
+		}
+
+		// try to merge (further) segments into current cluster; only until upper
+		// limit of TSVs per cluster is not reached yet
+		for (c = 0; c < candidates; c++) {
+
+			if (clusters.back().nets.size() >= upper_limit_TSVs) {
+				break;
+			}
 
-				for (it_net = (*it_cluster).nets.begin(); it_net != (*it_cluster).nets.end(); ++it_net) {
-					std::cout << "DBG_CLUSTERING>   net id: " << (*it_net)->id << std::endl;
+			p = buffers.candidates[c];
+			s = buffers.active[p].segment;
+
+			// determine intersection of cluster w/ current segment
+			intersection = Rect::determineIntersection(cluster, segments[s].bb);
+
+			// ignore merges which would results in empty (i.e., non-overlapping)
+			// segments
+			if (intersection.area == 0.0) {
+
+				if (Clustering::DBG_CLUSTERING) {
+					std::cout << "DBG_CLUSTERING>  ignore net " << segments[s].net->id << " for this cluster" << std::endl;
 				}
 
-				std::cout << "DBG_CLUSTERING>" << std::endl;
+				continue;
+			}
+			// else update cluster
+			else {
+				clusters.back().nets.push_back(segments[s].net);
+				clusters.back().bb = intersection;
+
+				// also update cluster-region monitor variable
+				cluster = intersection;
+
+				// also mark net as clustered now, to be dropped from
+				// active segments
+				buffers.active[p].segment = Clustering::CLUSTERED;
+
+				if (Clustering::DBG_CLUSTERING) {
+					std::cout << "DBG_CLUSTERING>  add net " << segments[s].net->id << " to this cluster" << std::endl;
+				}
 			}
+		}
+
+		// drop initial and merged segments from active segments
+		buffers.active.front().segment = Clustering::CLUSTERED;
+		buffers.active.erase(
+				std::remove_if(buffers.active.begin(), buffers.active.end(),
+					[](ActiveSegment const& act) {
+						return act.segment == Clustering::CLUSTERED;
+					}
+				),
+				buffers.active.end()
+			);
 
+		if (Clustering::DBG_CLUSTERING) {
 			std::cout << "DBG_CLUSTERING>" << std::endl;
 		}
+	}
 
-		// derive TSV islands from clusters and store into global TSV container;
-		// they will will be handled and plotted in the TSV-density maps
-		//
-		// also link TSVs (blocks) to the respective nets; this is required for
-		// more accurate wirelength estimation
-		//
-		for (it_cluster = this->clusters[i].begin(); it_cluster != this->clusters[i].end(); ++it_cluster) {
-
-			TSV_Island TSVi = TSV_Island(
-					// cluster id
-					"net_cluster_" + std::to_string((*it_cluster).nets.size()),
-					// signal / TSV count
-					(*it_cluster).nets.size(),
-					// TSV pitch; required for proper scaling
-					// of TSV island
-					TSV_pitch,
-					// cluster bb; reference point for
-					// placement of TSV island;
-					//
-					// note that proper sizing is done via
-					// TSV_Island() constructor!
-					(*it_cluster).bb,
-					// layer assignment
-					i
-				);
-
-			// perform greedy shifting in case new island overlaps with any
-			// previous one
-			//
-			TSV_Island::greedyShifting(TSVi, TSVs);
-
-			// store in global TSVs container
-			TSVs.push_back(TSVi);
-
-			// link TSV block to each associated net
-			//
-			// since the container "TSVs" will be reallocated subsequently, we
-			// cannot use pointers to its elements; for simplicity (to avoid
-			// later on traversal and search of matching TSV islands for nets)
-			// we simply copy TSVs islands into nets
-			//
-			for (it_net = (*it_cluster).nets.begin(); it_net != (*it_cluster).nets.end(); ++it_net) {
-				(*it_net)->TSVs.push_back(TSVi);
+	// dbg, display all cluster
+	if (Clustering::DBG_CLUSTERING_FINAL) {
+
+		std::cout << "DBG_CLUSTERING> final set of clusters on layer " << layer << ":" << std::endl;
+		std::cout << "DBG_CLUSTERING>" << std::endl;
+
+		for (Cluster const& cur_cluster : clusters) {
+
+			std::cout << "DBG_CLUSTERING>  cluster bb:";
+			std::cout << " (" << cur_cluster.bb.ll.x << ",";
+			std::cout << cur_cluster.bb.ll.y << "),";
+			std::cout << " (" << cur_cluster.bb.ur.x << ",";
+			std::cout << cur_cluster.bb.ur.y << ")" << std::endl;
+
+			std::cout << "DBG_CLUSTERING>  associated hotspot:" << cur_cluster.hotspot_id << std::endl;
+
+			for (Net const* net : cur_cluster.nets) {
+				std::cout << "DBG_CLUSTERING>   net id: " << net->id << std::endl;
 			}
+
+			std::cout << "DBG_CLUSTERING>" << std::endl;
 		}
+
+		std::cout << "DBG_CLUSTERING>" << std::endl;
 	}
 
-	if (Clustering::DBG) {
-		std::cout << "<- Clustering::clusterSignalTSVs" << std::endl;
+	// derive TSV islands from clusters; they will will be handled and plotted in the
+	// TSV-density maps
+	//
+	// the islands are shifted against any previous islands on this layer, i.e.,
+	// against the islands given in the global TSV container and the islands of
+	// previous clusters; the islands of this layer are kept in a separate container,
+	// such that layers can be handled concurrently
+	//
+	buffers.TSVs.clear();
+	for (TSV_Island const& TSVi : TSVs) {
+
+		if (TSVi.layer == static_cast<int>(layer)) {
+			buffers.TSVs.push_back(TSVi);
+		}
+	}
+	buffers.prev_TSVs = buffers.TSVs.size();
+
+	for (Cluster const& cur_cluster : clusters) {
+
+		buffers.TSVs.emplace_back(TSV_Island(
+				// cluster id
+				"net_cluster_" + std::to_string(cur_cluster.nets.size()),
+				// signal / TSV count
+				cur_cluster.nets.size(),
+				// TSV pitch; required for proper scaling of TSV island
+				TSV_pitch,
+				// cluster bb; reference point for placement of TSV island;
+				//
+				// note that proper sizing is done via TSV_Island()
+				// constructor!
+				cur_cluster.bb,
+				// layer assignment
+				layer
+			));
+
+		// perform greedy shifting in case new island overlaps with any previous
+		// one
+		//
+		TSV_Island::greedyShifting(buffers.TSVs.back(), buffers.TSVs);
 	}
 }
 
@@ -310,16 +383,19 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 /// based on Lindeberg's grey-level blob detection algorithm.
 void Clustering::determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis) {
 	unsigned x, y;
-	std::vector<ThermalAnalyzer::ThermalMapBin*> thermal_map;
-	std::vector<ThermalAnalyzer::ThermalMapBin*>::iterator it1;
-	std::list<ThermalAnalyzer::ThermalMapBin*> relev_neighbors;
-	std::list<ThermalAnalyzer::ThermalMapBin*>::iterator it2;
+	unsigned i, j, cur;
+	int dx, dy;
+	unsigned dim_x, dim_y;
+	double temp;
+	double min_temp, max_temp;
+	double scale;
 	ThermalAnalyzer::ThermalMapBin *cur_bin;
-	unsigned hotspot_id;
-	std::unordered_map<unsigned, Hotspot> hotspots;
-	std::unordered_map<unsigned, Hotspot>::iterator it4;
+	int hotspot_id;
 	Hotspot *cur_hotspot;
-	bool bin_handled;
+	bool higher_neighbors, background_neighbors;
+	// hotspot ids of neighbors w/ higher temperatures; at most 8 neighbors
+	std::array<int, 8> neighbors_ids;
+	unsigned neighbors_ids_count;
 
 	// sanity check for available thermal-analysis result; note that these results are
 	// for example _not_ available during the very first run of SA Phase II where
@@ -328,249 +404,299 @@ void Clustering::determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &therm
 		return;
 	}
 
+	Map2D<ThermalAnalyzer::ThermalMapBin>& thermal_map = *thermal_analysis.thermal_map;
+	std::vector<double>& temps = this->hotspot_buffers.temps;
+	std::vector<int>& ids = this->hotspot_buffers.ids;
+	std::vector<HotspotBuffers::Bin>& bins = this->hotspot_buffers.bins;
+	std::vector<HotspotBuffers::Bin>& order = this->hotspot_buffers.order;
+	std::vector<unsigned>& buckets = this->hotspot_buffers.buckets;
+
+	dim_x = thermal_map.dimX();
+	dim_y = thermal_map.dimY();
+
 	// reset hotspot regions
 	this->hotspots.clear();
 
-	// reset hotspot associations in the thermal map
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-			(*thermal_analysis.thermal_map)[x][y].hotspot_id = ThermalAnalyzer::HOTSPOT_UNDEFINED;
-		}
-	}
+	// parse the thermal grid into flat arrays, in storage order; also reset hotspot
+	// associations, and memorize all relevant bins in a list (to be sorted below);
+	// data structure for blob detection
+	//
+	// note that the buffers are only allocated once, for the largest map
+	temps.resize(thermal_map.size());
+	ids.resize(thermal_map.size());
+	bins.clear();
+	min_temp = max_temp = thermal_analysis.temp_offset;
 
-	// parse the thermal grid into an list (to be sorted below); data structure for
-	// blob detection
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (i = 0; i < thermal_map.size(); i++) {
 
-			// ignore bins w/ temperature values near the offset
-			if (Math::looseDoubleComp(thermal_analysis.temp_offset, (*thermal_analysis.thermal_map)[x][y].temp)) {
-				continue;
-			}
+		temps[i] = thermal_map.data()[i].temp;
+		ids[i] = ThermalAnalyzer::HOTSPOT_UNDEFINED;
 
-			thermal_map.push_back(&(*thermal_analysis.thermal_map)[x][y]);
+		// ignore bins w/ temperature values near the offset
+		if (Math::looseDoubleComp(thermal_analysis.temp_offset, temps[i])) {
+			continue;
 		}
-	}
 
-	// sort list by temperature values
-	std::sort(thermal_map.begin(), thermal_map.end(),
-		// lambda expression
-		[](ThermalAnalyzer::ThermalMapBin const* b1, ThermalAnalyzer::ThermalMapBin const* b2) {
-			// std::sort requires a _strict_ ordering, thus we have to make sure that same elements returns false
-			// http://stackoverflow.com/a/1541909
-			// this is ensured by comparing using greater-than operator
-			return (b1->temp > b2->temp);
-		}
-	);
+		bins.push_back({temps[i], i});
 
-	if (Clustering::DBG_HOTSPOT) {
-		std::cout << "DBG_HOTSPOT> bin w/ global max temperature [x][y]: " << thermal_map.front()->x << ", " << thermal_map.front()->y << std::endl;
-		std::cout << "DBG_HOTSPOT>  temp: " << thermal_map.front()->temp << std::endl;
-		for (it2 = thermal_map.front()->neighbors.begin(); it2 != thermal_map.front()->neighbors.end(); ++it2) {
-			std::cout << "DBG_HOTSPOT>  neighbor bin [x][y]: " << (*it2)->x << ", " << (*it2)->y << std::endl;
+		if (bins.size() == 1) {
+			min_temp = max_temp = temps[i];
+		}
+		else {
+			min_temp = std::min(min_temp, temps[i]);
+			max_temp = std::max(max_temp, temps[i]);
 		}
 	}
 
-	// group the thermal-map list into hotspot regions; perform actual blob detection
-	hotspot_id = ThermalAnalyzer::HOTSPOT_FIRST_ID;
-	for (it1 = thermal_map.begin(); it1 != thermal_map.end(); ++it1) {
-
-		cur_bin = (*it1);
-
-		// determine all neighboring bins w/ higher temperature
-		relev_neighbors.clear();
-		for (it2 = cur_bin->neighbors.begin(); it2 != cur_bin->neighbors.end(); ++it2) {
+	// sort list by temperature values, in descending order; bins w/ same temperatures
+	// are ordered by their index
+	//
+	// the bins are first distributed into buckets, one for each bin on average,
+	// according to their temperatures; the buckets are then sorted separately, which
+	// is trivial for most buckets; overall, sorting is thus linear in practice
+	//
+	order.resize(bins.size());
+	buckets.assign(bins.size() + 1, 0);
 
-			if ((*it2)->temp > cur_bin->temp) {
-				relev_neighbors.push_back(*it2);
-			}
-		}
+	if (max_temp > min_temp) {
+		scale = (bins.size() - 1) / (max_temp - min_temp);
+	}
+	else {
+		scale = 0.0;
+	}
 
-		// if no such neighbor exits, then the current bin is a local maximum and
-		// will be the seed for a new hotspot/blob
-		if (relev_neighbors.empty()) {
-
-			// initialize new hotspot
-			hotspots.insert( std::pair<unsigned, Hotspot>(
-					// id is the (temporary) key for the map, used for
-					// easier data access during blob detection
-					hotspot_id,
-					// actual hotspot initialization
-					{
-						// peak temp
-						cur_bin->temp,
-						// base-level temp; currently undefined
-						-1.0,
-						// temperature gradient; currently
-						// undefined
-						-1.0,
-						// allocate vector of associated bins;
-						// initialize with cur_bin as first bin of
-						// new hotspot
-						std::vector<ThermalAnalyzer::ThermalMapBin*>(1, cur_bin),
-						// memorize hotspot as still growing
-						true,
-						// id
-						hotspot_id,
-						// score; currently undefined
-						-1.0,
-						// enclosing bb; initialize with cur_bin
-						cur_bin->bb
-						})
-				);
+	// count bins per bucket; the highest temperatures fall into the first bucket
+	for (HotspotBuffers::Bin const& bin : bins) {
+		buckets[Clustering::hotspotBucket(bin.temp, max_temp, scale, bins.size()) + 1]++;
+	}
+	// determine buckets' start indices
+	for (i = 1; i < buckets.size(); i++) {
+		buckets[i] += buckets[i - 1];
+	}
+	// distribute bins into buckets; this is stable, i.e., the bins are ordered by
+	// their index within the buckets; afterwards, buckets[k] marks the end of bucket
+	// k, which is also the start of bucket k + 1
+	for (HotspotBuffers::Bin const& bin : bins) {
+		order[buckets[Clustering::hotspotBucket(bin.temp, max_temp, scale, bins.size())]++] = bin;
+	}
+	// sort the buckets
+	for (i = 0; i < bins.size(); i++) {
 
-			// mark bin as associated to this new hotspot
-			cur_bin->hotspot_id = hotspot_id;
+		j = (i == 0) ? 0 : buckets[i - 1];
 
-			// increment hotspot counter/id
-			hotspot_id++;
+		if (buckets[i] - j < 2) {
+			continue;
 		}
 
-		// some neighbor bins w/ higher temperatures exit
-		else {
-			bin_handled = false;
-
-			// if any of these neighbors is a background bin, then this bin is
-			// also a background bin
-			for (it2 = relev_neighbors.begin(); it2 != relev_neighbors.end(); ++it2) {
+		std::sort(order.begin() + j, order.begin() + buckets[i],
+			// lambda expression
+			[](HotspotBuffers::Bin const& b1, HotspotBuffers::Bin const& b2) {
+				// std::sort requires a _strict_ ordering, thus we have to make sure that same elements returns false
+				// http://stackoverflow.com/a/1541909
+				// this is ensured by comparing using greater-than operator for
+				// the temperatures, and lesser-than operator for the indices
+				return (b1.temp > b2.temp) || (b1.temp == b2.temp && b1.index < b2.index);
+			}
+		);
+	}
 
-				if ((*it2)->hotspot_id == ThermalAnalyzer::HOTSPOT_BACKGROUND) {
+	if (Clustering::DBG_HOTSPOT && !order.empty()) {
+		std::cout << "DBG_HOTSPOT> bin w/ global max temperature [x][y]: " << order.front().index / dim_y << ", " << order.front().index % dim_y << std::endl;
+		std::cout << "DBG_HOTSPOT>  temp: " << order.front().temp << std::endl;
+	}
 
-					cur_bin->hotspot_id = ThermalAnalyzer::HOTSPOT_BACKGROUND;
-					bin_handled = true;
+	// group the thermal-map list into hotspot regions; perform actual blob detection
+	hotspot_id = ThermalAnalyzer::HOTSPOT_FIRST_ID;
+	for (HotspotBuffers::Bin const& bin : order) {
 
-					break;
-				}
-			}
+		cur = bin.index;
+		x = cur / dim_y;
+		y = cur % dim_y;
+		temp = bin.temp;
 
-			// none of the neighbors are background bins; proceed with check
-			// if the neighbors belong to one or to different hotspots
-			if (!bin_handled) {
+		// determine all neighboring bins w/ higher temperature; the neighbors are
+		// given implicitly by the 8-neighborhood in the flat map
+		//
+		// if any of these neighbors is a background bin, then this bin is also a
+		// background bin; otherwise, memorize the hotspots of these neighbors
+		higher_neighbors = background_neighbors = false;
+		neighbors_ids_count = 0;
 
-				if (Clustering::DBG_HOTSPOT) {
+		for (dx = -1; dx <= 1; dx++) {
 
-					if (relev_neighbors.empty()) {
-						std::cout << "DBG_HOTSPOT> blob-detection error; no valid neighbor bin found" << std::endl;
-					}
-					else {
-						for (it2 = relev_neighbors.begin(); it2 != relev_neighbors.end(); ++it2) {
+			if ((x == 0 && dx == -1) || (x == dim_x - 1 && dx == 1)) {
+				continue;
+			}
 
-							if ((*it2)->hotspot_id == ThermalAnalyzer::HOTSPOT_UNDEFINED) {
+			for (dy = -1; dy <= 1; dy++) {
 
-								std::cout << "DBG_HOTSPOT> blob-detection error; undefined bin triggered" << std::endl;
-								continue;
-							}
-						}
-					}
+				if ((y == 0 && dy == -1) || (y == dim_y - 1 && dy == 1) || (dx == 0 && dy == 0)) {
+					continue;
 				}
 
-				// memorize only unique bins; initially sort the neighbors
-				relev_neighbors.sort(
-						// lambda expression
-						[](ThermalAnalyzer::ThermalMapBin const* b1, ThermalAnalyzer::ThermalMapBin const* b2) {
-
-							// std::sort requires a _strict_ ordering, thus we have to make sure that same elements returns false
-							// http://stackoverflow.com/a/1541909
-							// this is ensured by comparing using lesser-than operator
-							return (b1->hotspot_id < b2->hotspot_id);
-						}
-					);
-				// now, remove consecutive duplicates
-				relev_neighbors.unique();
+				j = cur + dx * static_cast<int>(dim_y) + dy;
 
-				// all neighbors belong to one specific hotspot
-				if (relev_neighbors.size() == 1) {
+				if (temps[j] <= temp) {
+					continue;
+				}
 
-					cur_hotspot = &hotspots.find(relev_neighbors.front()->hotspot_id)->second;
+				higher_neighbors = true;
 
-					// if the hotspot is allowed to grow, associated
-					// this bin with it, and mark bin as well
-					if (cur_hotspot->still_growing) {
+				// note that undefined neighbors are only possible for (erroneous)
+				// bins w/ temperatures below the offset; they are handled like
+				// background bins
+				if (ids[j] == ThermalAnalyzer::HOTSPOT_BACKGROUND || ids[j] == ThermalAnalyzer::HOTSPOT_UNDEFINED) {
 
-						cur_hotspot->bins.push_back(cur_bin);
-						cur_bin->hotspot_id = cur_hotspot->id;
-					}
-					// if the hotspot is not allowed to grow anymore,
-					// mark the bin as background bin
-					else {
-						cur_bin->hotspot_id = ThermalAnalyzer::HOTSPOT_BACKGROUND;
+					if (Clustering::DBG_HOTSPOT && ids[j] == ThermalAnalyzer::HOTSPOT_UNDEFINED) {
+						std::cout << "DBG_HOTSPOT> blob-detection error; undefined bin triggered" << std::endl;
 					}
+
+					background_neighbors = true;
 				}
-				// neighbors belong to different hotspots
 				else {
-					// the bin has to be background since it defines
-					// the base level for different hotspots
-					cur_bin->hotspot_id = ThermalAnalyzer::HOTSPOT_BACKGROUND;
-
-					// the different hotspots have reached their base
-					// level w/ this bin; mark them as not growing
-					// anymore and memorize the base-level temp
-					for (it2 = relev_neighbors.begin(); it2 != relev_neighbors.end(); ++it2) {
-
-						hotspots.find((*it2)->hotspot_id)->second.still_growing = false;
-						hotspots.find((*it2)->hotspot_id)->second.base_temp = cur_bin->temp;
-
-						// the determination of temp gradient and
-						// score could be also conducted here, but
-						// is postponed since a post-processing of
-						// all hotspot regions is required anyway
-					}
+					neighbors_ids[neighbors_ids_count] = ids[j];
+					neighbors_ids_count++;
 				}
 			}
 		}
-	}
 
-	// post-processing hotspot regions, also re-order them according to their score
-	for (it4 = hotspots.begin(); it4 != hotspots.end(); ++it4) {
+		// if no such neighbor exits, then the current bin is a local maximum and
+		// will be the seed for a new hotspot/blob
+		if (!higher_neighbors) {
+
+			cur_bin = &thermal_map.data()[cur];
+
+			// initialize new hotspot; the ids are consecutive, thus the hotspots
+			// are accessed via their id during blob detection
+			this->hotspots.push_back({
+					// peak temp
+					temp,
+					// base-level temp; initialize with peak temp,
+					// to be lowered while hotspot is growing
+					temp,
+					// temperature gradient; currently
+					// undefined
+					-1.0,
+					// count of associated bins; cur_bin is first
+					// bin of new hotspot
+					1,
+					// memorize hotspot as still growing
+					true,
+					// id
+					static_cast<unsigned>(hotspot_id),
+					// score; currently undefined
+					-1.0,
+					// enclosing bb; initialize with cur_bin
+					cur_bin->bb
+				});
 
-		cur_hotspot = &(*it4).second;
+			// mark bin as associated to this new hotspot
+			ids[cur] = hotspot_id;
 
-		// some regions may be still marked as growing; mark such regions as not
-		// growing anymore
-		if (cur_hotspot->still_growing) {
+			// increment hotspot counter/id
+			hotspot_id++;
+		}
+		// some neighbor bins w/ higher temperatures exit; at least one of them is
+		// background bin
+		else if (background_neighbors) {
+			ids[cur] = ThermalAnalyzer::HOTSPOT_BACKGROUND;
+		}
+		// one neighbor, belonging to one specific hotspot
+		//
+		// note that hotspots only grow by bins w/ exactly one neighbor of higher
+		// temperature; bins w/ multiple such neighbors define the base level, also
+		// in case all these neighbors belong to the same hotspot
+		else if (neighbors_ids_count == 1) {
+
+			cur_hotspot = &this->hotspots[neighbors_ids[0] - ThermalAnalyzer::HOTSPOT_FIRST_ID];
+
+			// if the hotspot is allowed to grow, associated this bin with it, and
+			// mark bin as well
+			if (cur_hotspot->still_growing) {
+
+				cur_bin = &thermal_map.data()[cur];
+
+				cur_hotspot->bins++;
+				ids[cur] = cur_hotspot->id;
+
+				// bins are handled in order of decreasing temperatures, thus the
+				// base temp is given by the current bin, as long as the hotspot is
+				// growing; note that the actual base temp is slightly lower since the
+				// base-level bin is not included in the hotspot itself
+				cur_hotspot->base_temp = temp;
+
+				// extend the (all bins enclosing) bb; its properties are determined
+				// during post-processing
+				cur_hotspot->bb.ll.x = std::min(cur_hotspot->bb.ll.x, cur_bin->bb.ll.x);
+				cur_hotspot->bb.ll.y = std::min(cur_hotspot->bb.ll.y, cur_bin->bb.ll.y);
+				cur_hotspot->bb.ur.x = std::max(cur_hotspot->bb.ur.x, cur_bin->bb.ur.x);
+				cur_hotspot->bb.ur.y = std::max(cur_hotspot->bb.ur.y, cur_bin->bb.ur.y);
+			}
+			// if the hotspot is not allowed to grow anymore, mark the bin as
+			// background bin
+			else {
+				ids[cur] = ThermalAnalyzer::HOTSPOT_BACKGROUND;
+			}
+		}
+		// multiple neighbors, possibly belonging to different hotspots
+		else {
+			// the bin has to be background since it defines the base level for
+			// different hotspots
+			ids[cur] = ThermalAnalyzer::HOTSPOT_BACKGROUND;
+
+			// the different hotspots have reached their base level w/ this bin;
+			// mark them as not growing anymore and memorize the base-level temp
+			for (i = 0; i < neighbors_ids_count; i++) {
 
-			cur_hotspot->still_growing = false;
+				cur_hotspot = &this->hotspots[neighbors_ids[i] - ThermalAnalyzer::HOTSPOT_FIRST_ID];
 
-			// also approximate base temp, using the minimal temperature of
-			// all bins of the hotspot; note that the actual base temp is
-			// slightly lower since the base-level bin is not included in the
-			// hotspot itself
-			cur_hotspot->base_temp = (*cur_hotspot->bins.begin())->temp;
-			for (it1 = cur_hotspot->bins.begin(); it1 != cur_hotspot->bins.end(); ++it1) {
+				cur_hotspot->still_growing = false;
+				cur_hotspot->base_temp = temp;
 
-				cur_hotspot->base_temp = std::min(cur_hotspot->base_temp, (*it1)->temp);
+				// the determination of temp gradient and score could be also
+				// conducted here, but is postponed since a post-processing of all
+				// hotspot regions is required anyway
 			}
 		}
+	}
+
+	// transfer hotspot associations into the thermal map
+	for (i = 0; i < thermal_map.size(); i++) {
+		thermal_map.data()[i].hotspot_id = ids[i];
+	}
+
+	// post-processing hotspot regions
+	for (Hotspot& hotspot : this->hotspots) {
+
+		// some regions may be still marked as growing; mark such regions as not
+		// growing anymore; their base temp is already approximated by the minimal
+		// temperature of all bins of the hotspot
+		hotspot.still_growing = false;
 
 		// using the base temp, determine gradient
-		cur_hotspot->temp_gradient = cur_hotspot->peak_temp - cur_hotspot->base_temp;
+		hotspot.temp_gradient = hotspot.peak_temp - hotspot.base_temp;
 
 		// determine hotspot score; the score is defined by its peak temp and temp
 		// gradient, i.e., measures how ``critical'' the local thermal maxima is
-		cur_hotspot->score = cur_hotspot->temp_gradient * std::pow(cur_hotspot->peak_temp, 2.0);
+		hotspot.score = hotspot.temp_gradient * std::pow(hotspot.peak_temp, 2.0);
 		// apply normalization such that scores are roughly in the range of
 		// [0..10]
-		cur_hotspot->score /= Clustering::SCORE_NORMALIZATION;
+		hotspot.score /= Clustering::SCORE_NORMALIZATION;
 
-		// determine the (all bins enclosing) bb; this is used to simplify checks
-		// of nets overlapping hotspot regions, but also reduces spatial accuracy
-		for (it1 = cur_hotspot->bins.begin(); it1 != cur_hotspot->bins.end(); ++it1) {
-
-			cur_hotspot->bb = Rect::determBoundingBox(cur_hotspot->bb, (*it1)->bb);
-		}
+		// determine the properties of the (all bins enclosing) bb; this is used to
+		// simplify checks of nets overlapping hotspot regions, but also reduces
+		// spatial accuracy
+		hotspot.bb = Rect::determBoundingBox(hotspot.bb, hotspot.bb);
 
 		// enlarge final bb by 2x, which should increase chances for the
 		// subsequent clustering to match net bounding box with these cluster bbs
-		cur_hotspot->bb.ll.x -= (cur_hotspot->bb.w / 2.0);
-		cur_hotspot->bb.ur.x += (cur_hotspot->bb.w / 2.0);
-		cur_hotspot->bb.ll.y -= (cur_hotspot->bb.h / 2.0);
-		cur_hotspot->bb.ur.y += (cur_hotspot->bb.h / 2.0);
-		cur_hotspot->bb.w = cur_hotspot->bb.ur.x - cur_hotspot->bb.ll.x;
-		cur_hotspot->bb.h = cur_hotspot->bb.ur.y - cur_hotspot->bb.ll.y;
-		cur_hotspot->bb.area = cur_hotspot->bb.w * cur_hotspot->bb.h;
-
-		// put hotspot into  global map, which shall be sorted by the hotspot scores
-		this->hotspots.push_back(std::move(*cur_hotspot));
+		hotspot.bb.ll.x -= (hotspot.bb.w / 2.0);
+		hotspot.bb.ur.x += (hotspot.bb.w / 2.0);
+		hotspot.bb.ll.y -= (hotspot.bb.h / 2.0);
+		hotspot.bb.ur.y += (hotspot.bb.h / 2.0);
+		hotspot.bb.w = hotspot.bb.ur.x - hotspot.bb.ll.x;
+		hotspot.bb.h = hotspot.bb.ur.y - hotspot.bb.ll.y;
+		hotspot.bb.area = hotspot.bb.w * hotspot.bb.h;
 	}
 
 	// finally, sort global map according to hotspot scores
@@ -584,7 +710,11 @@ void Clustering::determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &therm
 				// this is ensured by comparing using lesser-than operator
 				//
 				// the higher the cost the better; sort in desceding order
-				return (hs1.score > hs2.score);
+				//
+				// hotspots w/ same score, e.g., single-bin hotspots w/
+				// zero score, are ordered by their ids, i.e., by their
+				// peak temps
+				return (hs1.score > hs2.score) || (hs1.score == hs2.score && hs1.id < hs2.id);
 			}
 		 );
 
@@ -603,14 +733,14 @@ void Clustering::determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &therm
 			std::cout << "DBG_HOTSPOT>   base temp: " << cur_hotspot.base_temp << std::endl;
 			std::cout << "DBG_HOTSPOT>   temp gradient: " << cur_hotspot.temp_gradient << std::endl;
 			std::cout << "DBG_HOTSPOT>   score: " << cur_hotspot.score << std::endl;
-			std::cout << "DBG_HOTSPOT>   bins count: " << cur_hotspot.bins.size() << std::endl;
+			std::cout << "DBG_HOTSPOT>   bins count: " << cur_hotspot.bins << std::endl;
 			std::cout << "DBG_HOTSPOT>   still growing: " << cur_hotspot.still_growing << std::endl;
 		}
 
 		std::cout << "DBG_HOTSPOT> adapted thermal-map:" << std::endl;
 
-		for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-			for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+		for (x = 0; x < thermal_analysis.thermal_map->dimX(); x++) {
+			for (y = 0; y < thermal_analysis.thermal_map->dimY(); y++) {
 
 				cur_bin = &(*thermal_analysis.thermal_map)[x][y];
 
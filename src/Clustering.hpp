@@ -27,6 +27,7 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "ThermalAnalyzer.hpp"
+#include "ThermalSolver.hpp"
 // forward declarations, if any
 
 /// Corblivar signal-TSV clustering
@@ -57,7 +58,7 @@ class Clustering {
 		};
 		/// POD wrapping net clusters
 		struct Cluster {
-			std::list<Net*> nets;
+			std::vector<Net*> nets;
 			Rect bb;
 			unsigned hotspot_id;
 		};
@@ -66,7 +67,8 @@ class Clustering {
 			double peak_temp;
 			double base_temp;
 			double temp_gradient;
-			std::vector<ThermalAnalyzer::ThermalMapBin*> bins;
+			/// count of bins associated w/ hotspot
+			unsigned bins;
 			bool still_growing;
 			unsigned id;
 			double score;
@@ -76,13 +78,15 @@ class Clustering {
 		/// Hotspots container
 		std::vector<Hotspot> hotspots;
 
-		/// Clustering helper
+		/// Clustering helper; the layers are clustered concurrently by the
+		/// given workers, if any
 		void clusterSignalTSVs(std::vector<Net> &nets,
 				std::vector< std::vector<Segments> > &nets_segments,
 				std::vector<TSV_Island> &TSVs,
 				double const& TSV_pitch,
 				unsigned const& upper_limit_TSVs,
-				ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis);
+				ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis,
+				ThermalSolver::Workers* workers = nullptr);
 
 	// private data, functions
 	private:
@@ -90,11 +94,74 @@ class Clustering {
 		/// Hotspot determination
 		void determineHotspots(ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis);
 
+		/// buffers for hotspot determination, kept for all runs; all are
+		/// related to the flat thermal map, i.e., to its storage order
+		struct HotspotBuffers {
+			/// temperatures of all bins
+			std::vector<double> temps;
+			/// hotspot ids of all bins
+			std::vector<int> ids;
+			/// bins to consider, along w/ their temperatures for better
+			/// locality
+			struct Bin {
+				double temp;
+				unsigned index;
+			};
+			std::vector<Bin> bins;
+			/// bins to consider, sorted by temperature
+			std::vector<Bin> order;
+			/// bucket boundaries for sorting
+			std::vector<unsigned> buckets;
+		} hotspot_buffers;
+
+		/// helper for hotspot determination; maps temperatures linearly to
+		/// buckets, in descending order
+		inline static unsigned hotspotBucket(double const& temp, double const& max_temp, double const& scale, unsigned const& buckets) {
+			return std::min(static_cast<unsigned>((max_temp - temp) * scale), buckets - 1);
+		}
+
 		/// Normalization scale for hotspot score
 		static constexpr double SCORE_NORMALIZATION = 1.0e6;
 
+		/// min count of segments for concurrent layer-wise clustering, such
+		/// that small workloads are handled w/o parallelization overhead
+		static constexpr unsigned SEGMENTS_PER_THREAD_MIN = 128;
+
+		/// Layer-wise clustering helper
+		void clusterSignalTSVsLayer(unsigned const& layer,
+				std::vector<Segments> &segments,
+				double const& TSV_pitch,
+				unsigned const& upper_limit_TSVs,
+				std::vector<TSV_Island> const& TSVs);
+
+		/// active segment, i.e., segment not clustered yet, along w/ its bb
+		/// coordinates for better locality
+		struct ActiveSegment {
+			unsigned segment;
+			double ll_x, ll_y, ur_x, ur_y;
+		};
+
+		/// marker for segments clustered already
+		static constexpr unsigned CLUSTERED = std::numeric_limits<unsigned>::max();
+
+		/// buffers for layer-wise clustering, kept for all runs; all indices
+		/// are related to the area-sorted segments of the layer
+		struct LayerBuffers {
+			/// active segments, in the order of sorted segments
+			std::vector<ActiveSegment> active;
+			/// candidate segments for current cluster; indices of active
+			/// segments
+			std::vector<unsigned> candidates;
+			/// TSV islands of this layer; the first prev_TSVs ones are
+			/// previous islands, the remaining ones are derived from the
+			/// clusters
+			std::vector<TSV_Island> TSVs;
+			unsigned prev_TSVs;
+		};
+		std::vector<LayerBuffers> layer_buffers;
+
 		/// Cluster container
-		std::vector< std::list<Cluster> > clusters;
+		std::vector< std::vector<Cluster> > clusters;
 };
 
 #endif
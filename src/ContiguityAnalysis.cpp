@@ -36,36 +36,69 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 
 	ContiguityAnalysis::Boundary cur_boundary;
 
-	// this data structure is used for inter-die contiguity analysis; note and see
-	// below that considering / walking one dimension's boundaries is sufficient to
-	// determine intersections in both dimensions / overlaps
-	std::vector< std::vector<ContiguityAnalysis::Boundary> > inter_die_boundaries_vert;
-
 	std::vector<ContiguityAnalysis::Boundary>::iterator i1;
 	std::vector<ContiguityAnalysis::Boundary>::iterator i2;
 	// (TODO) drop; not required as of now
 //	double common_boundary_hor, common_boundary_vert;
 
-	// init die-wise lists of boundaries
-	this->boundaries_hor.clear();
-	this->boundaries_hor.reserve(layers);
-	this->boundaries_vert.clear();
-	this->boundaries_vert.reserve(layers);
-	inter_die_boundaries_vert.reserve(layers - 1);
+	// the analysis is only required if the layout has changed since the previous
+	// analysis; otherwise, the previously determined neighbours are still valid
+	//
+	bool layout_changed = (this->blocks_bbs.size() != blocks.size()) || (static_cast<int>(this->boundaries_hor.size()) != layers);
+
+	for (unsigned b = 0; b < blocks.size() && !layout_changed; b++) {
+
+		Rect const& bb = this->blocks_bbs[b];
+
+		layout_changed = (bb.ll.x != blocks[b].bb.ll.x) || (bb.ll.y != blocks[b].bb.ll.y) || (bb.ur.x != blocks[b].bb.ur.x) || (bb.ur.y != blocks[b].bb.ur.y)
+			|| (this->blocks_layers[b] != blocks[b].layer);
+	}
+
+	if (!layout_changed) {
+
+		// the blocks may have been assigned from elsewhere in between; thus, (re-)link
+		// the blocks to their neighbours in any case
+		for (unsigned b = 0; b < blocks.size(); b++) {
+			blocks[b].contiguous_neighbours.first = this->neighbours.data() + this->neighbours_offsets[b];
+			blocks[b].contiguous_neighbours.last = this->neighbours.data() + this->neighbours_offsets[b + 1];
+		}
+
+		if (ContiguityAnalysis::DBG) {
+			std::cout << "DBG_CONTIGUITY> Layout unchanged; keep previously determined neighbours" << std::endl;
+		}
+
+		return;
+	}
+
+	// memorize layout
+	this->blocks_bbs.clear();
+	this->blocks_layers.clear();
+	for (Block const& block : blocks) {
+		this->blocks_bbs.push_back(block.bb);
+		this->blocks_layers.push_back(block.layer);
+	}
+
+	// init die-wise lists of boundaries; the lists are kept between calls, only
+	// their content is reset
+	//
+	// the inter-die data structures are used for inter-die contiguity analysis; note
+	// and see below that considering / walking one dimension's boundaries is
+	// sufficient to determine intersections in both dimensions / overlaps
+	this->boundaries_hor.resize(layers);
+	this->boundaries_vert.resize(layers);
+	this->inter_die_boundaries_vert.resize(std::max(layers - 1, 0));
 	for (int l = 0; l < layers; l++) {
-		this->boundaries_hor.push_back(std::vector<ContiguityAnalysis::Boundary>());
-		this->boundaries_vert.push_back(std::vector<ContiguityAnalysis::Boundary>());
+		this->boundaries_hor[l].clear();
+		this->boundaries_vert[l].clear();
 	}
 	for (int l = 0; l < layers - 1; l++) {
-		inter_die_boundaries_vert.push_back(std::vector<ContiguityAnalysis::Boundary>());
+		this->inter_die_boundaries_vert[l].clear();
 	}
+	this->neighbour_pairs.clear();
 
 	// add blocks' boundaries into corresponding list
 	for (Block const& block : blocks) {
 
-		// reset previous contiguous neighbours
-		block.contiguous_neighbours.clear();
-
 		cur_boundary.block = &block;
 
 		// left boundary
@@ -81,16 +114,16 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 		// into one layer of inter_die_boundaries, such that determination of
 		// inter-die contiguity will be simplified
 		if (block.layer == 0) {
-			inter_die_boundaries_vert[0].push_back(cur_boundary);
+			this->inter_die_boundaries_vert[0].push_back(cur_boundary);
 		}
 		else if (block.layer == layers - 1) {
-			inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
+			this->inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
 		}
 		// layer > 0; block has to be considered for both this and the layer below
 		// in the dedicated data structure
 		else {
-			inter_die_boundaries_vert[block.layer].push_back(cur_boundary);
-			inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
+			this->inter_die_boundaries_vert[block.layer].push_back(cur_boundary);
+			this->inter_die_boundaries_vert[block.layer - 1].push_back(cur_boundary);
 		}
 
 		// right boundary
@@ -203,11 +236,6 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 //				// memorize within both blocks
 //				common_boundary_vert = ContiguityAnalysis::common_boundary_vert(b1, b2);
 
-				// init neighbourship storage
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b1;
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b2;
-				neighbour_for_b1.block = b2.block;
-				neighbour_for_b2.block = b1.block;
 
 				// (TODO) drop; not required as of now
 //				// for b2 being right of b1, the common boundary to be
@@ -224,9 +252,9 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 //					neighbour_for_b2.common_boundary_vert = common_boundary_vert;
 //				}
 
-				// memorize within each block
-				b1.block->contiguous_neighbours.push_back(neighbour_for_b1);
-				b2.block->contiguous_neighbours.push_back(neighbour_for_b2);
+				// memorize pair of blocks; the neighbours are stored within each
+				// block below
+				this->neighbour_pairs.emplace_back(b1.block - blocks.data(), b2.block - blocks.data());
 
 				if (ContiguityAnalysis::DBG) {
 					std::cout << "DBG_CONTIGUITY>   Common boundary with block " << b2.block->id;
@@ -280,11 +308,6 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 //				// memorize within both blocks
 //				common_boundary_hor = ContiguityAnalysis::common_boundary_hor(b1, b2);
 
-				// init neighbourship storage
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b1;
-				ContiguityAnalysis::ContiguousNeighbour neighbour_for_b2;
-				neighbour_for_b1.block = b2.block;
-				neighbour_for_b2.block = b1.block;
 
 				// (TODO) drop; not required as of now
 //				// for b2 being atop of b1, the common boundary to be
@@ -301,9 +324,9 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 //					neighbour_for_b2.common_boundary_hor = common_boundary_hor;
 //				}
 
-				// memorize within each block
-				b1.block->contiguous_neighbours.push_back(neighbour_for_b1);
-				b2.block->contiguous_neighbours.push_back(neighbour_for_b2);
+				// memorize pair of blocks; the neighbours are stored within each
+				// block below
+				this->neighbour_pairs.emplace_back(b1.block - blocks.data(), b2.block - blocks.data());
 
 				if (ContiguityAnalysis::DBG) {
 					std::cout << "DBG_CONTIGUITY>   Common boundary with block " << b2.block->id;
@@ -330,12 +353,12 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 		// dimension first (i.e., y for horizontal, and x for vertical boundaries)
 		// and also by their extension dimension; this way, boundaries can next be
 		// easily compared with each other
-		std::sort(inter_die_boundaries_vert[l].begin(), inter_die_boundaries_vert[l].end(), ContiguityAnalysis::boundaries_vert_comp);
+		std::sort(this->inter_die_boundaries_vert[l].begin(), this->inter_die_boundaries_vert[l].end(), ContiguityAnalysis::boundaries_vert_comp);
 
 		if (ContiguityAnalysis::DBG) {
 
 			std::cout << "DBG_CONTIGUITY> Sorted and merged boundaries; dies " << l << " and " << l + 1 << "; left (vertical) boundaries:" << std::endl;
-			for (auto const& boundary : inter_die_boundaries_vert[l]) {
+			for (auto const& boundary : this->inter_die_boundaries_vert[l]) {
 
 				std::cout << "DBG_CONTIGUITY>  Boundary: ";
 				std::cout << "(" << boundary.low.x << "," << boundary.low.y << ")";
@@ -354,11 +377,34 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 			std::cout << "DBG_CONTIGUITY> Determine intersecting boundaries for dies " << l << " and " << l + 1 << "; derive inter-die contiguity" << std::endl;
 		}
 
+		// separate the merged boundaries by die, keeping their order and
+		// memorizing their positions in the merged list; this way, each boundary
+		// has to be compared only to the boundaries of the other die
+		this->inter_die_boundaries_lower.clear();
+		this->inter_die_boundaries_upper.clear();
+		this->inter_die_positions_lower.clear();
+		this->inter_die_positions_upper.clear();
+
+		for (unsigned p = 0; p < this->inter_die_boundaries_vert[l].size(); p++) {
+
+			if (this->inter_die_boundaries_vert[l][p].block->layer == l) {
+				this->inter_die_boundaries_lower.push_back(this->inter_die_boundaries_vert[l][p]);
+				this->inter_die_positions_lower.push_back(p);
+			}
+			else {
+				this->inter_die_boundaries_upper.push_back(this->inter_die_boundaries_vert[l][p]);
+				this->inter_die_positions_upper.push_back(p);
+			}
+		}
+
 		// walking vertical boundaries; this is sufficient for determining
 		// overlaps in x- and y-dimension
-		for (i1 = inter_die_boundaries_vert[l].begin(); i1 != inter_die_boundaries_vert[l].end(); ++i1) {
+		unsigned next_lower = 0;
+		unsigned next_upper = 0;
 
-			ContiguityAnalysis::Boundary& b1 = (*i1);
+		for (unsigned p1 = 0; p1 < this->inter_die_boundaries_vert[l].size(); p1++) {
+
+			ContiguityAnalysis::Boundary& b1 = this->inter_die_boundaries_vert[l][p1];
 
 			if (ContiguityAnalysis::DBG) {
 				std::cout << "DBG_CONTIGUITY>  Currently considered vertical segment ";
@@ -369,11 +415,21 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 			// the boundary b2, to be compared to b1, should be within the
 			// x-range of b1.block; thus, we start from the next element (not
 			// the same, in order to avoid comparison with itself) in the set
-			// of sorted boundaries
-			i2 = i1 + 1;
-			for (; i2 != inter_die_boundaries_vert[l].end(); ++i2) {
+			// of sorted boundaries, but only consider the boundaries of the
+			// other die
+			while (next_lower < this->inter_die_positions_lower.size() && this->inter_die_positions_lower[next_lower] <= p1) {
+				next_lower++;
+			}
+			while (next_upper < this->inter_die_positions_upper.size() && this->inter_die_positions_upper[next_upper] <= p1) {
+				next_upper++;
+			}
 
-				ContiguityAnalysis::Boundary& b2 = (*i2);
+			bool b1_lower = (b1.block->layer == l);
+			std::vector<ContiguityAnalysis::Boundary> const& other_die = b1_lower ? this->inter_die_boundaries_upper : this->inter_die_boundaries_lower;
+
+			for (unsigned p2 = (b1_lower ? next_upper : next_lower); p2 < other_die.size(); p2++) {
+
+				ContiguityAnalysis::Boundary const& b2 = other_die[p2];
 
 				// break condition; if b2 is outside of b1 (to the right
 				// of b1.block), no intersection if feasible anymore
@@ -381,12 +437,9 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 					break;
 				}
 
-				// otherwise, some intersection _may_ exist, but only a)
-				// for blocks of the other die and b) if there is some
-				// overlap in y-direction
-				if ((b2.block->layer != b1.block->layer) &&
-						(b1.low.y <= b2.high.y && b2.low.y <= b1.high.y)
-				   ) {
+				// otherwise, some intersection _may_ exist, but only if
+				// there is some overlap in y-direction
+				if (b1.low.y <= b2.high.y && b2.low.y <= b1.high.y) {
 					// at this point, we know that b2 is intersecting
 					// with b1 to some degree in _both_ dimensions;
 					// thus, we can simplify the inter-die contiguity
@@ -402,12 +455,6 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 //					// boundary from the blocks themselves
 //					common_boundary_hor = ContiguityAnalysis::common_boundary_hor(b1.block, b2.block);
 
-					// init neighbourship storage
-					ContiguityAnalysis::ContiguousNeighbour neighbour_for_b1;
-					ContiguityAnalysis::ContiguousNeighbour neighbour_for_b2;
-					neighbour_for_b1.block = b2.block;
-					neighbour_for_b2.block = b1.block;
-
 					// (TODO) drop; not required as of now
 //					// for b2 being right of b1, the common boundary to be
 //					// stored in b1 is positive and the one for b2 is
@@ -437,9 +484,9 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 //						neighbour_for_b2.common_boundary_inter_die_hor = common_boundary_hor;
 //					}
 
-					// memorize within each block
-					b1.block->contiguous_neighbours.push_back(neighbour_for_b1);
-					b2.block->contiguous_neighbours.push_back(neighbour_for_b2);
+					// memorize pair of blocks; the neighbours are stored
+					// within each block below
+					this->neighbour_pairs.emplace_back(b1.block - blocks.data(), b2.block - blocks.data());
 
 					if (ContiguityAnalysis::DBG) {
 						std::cout << "DBG_CONTIGUITY>   2-dimensional contiguity with block " << b2.block->id;
@@ -463,6 +510,31 @@ void ContiguityAnalysis::analyseBlocks(int layers, std::vector<Block> const& blo
 		}
 	}
 
+	// store the contiguous neighbours of all blocks in CSR layout; the neighbours of
+	// each block are kept in the order of their determination
+	//
+	this->neighbours_offsets.assign(blocks.size() + 1, 0);
+	for (auto const& pair : this->neighbour_pairs) {
+		this->neighbours_offsets[pair.first + 1]++;
+		this->neighbours_offsets[pair.second + 1]++;
+	}
+	for (unsigned b = 0; b < blocks.size(); b++) {
+		this->neighbours_offsets[b + 1] += this->neighbours_offsets[b];
+	}
+
+	this->neighbours.resize(this->neighbours_offsets.back());
+	std::vector<unsigned> fill(this->neighbours_offsets.begin(), this->neighbours_offsets.end() - 1);
+
+	for (auto const& pair : this->neighbour_pairs) {
+		this->neighbours[fill[pair.first]++].block = &blocks[pair.second];
+		this->neighbours[fill[pair.second]++].block = &blocks[pair.first];
+	}
+
+	for (unsigned b = 0; b < blocks.size(); b++) {
+		blocks[b].contiguous_neighbours.first = this->neighbours.data() + this->neighbours_offsets[b];
+		blocks[b].contiguous_neighbours.last = this->neighbours.data() + this->neighbours_offsets[b + 1];
+	}
+
 	if (ContiguityAnalysis::DBG) {
 		std::cout << "DBG_CONTIGUITY> Contiguous neighbours for all blocks:" << std::endl;
 
@@ -27,6 +27,7 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Point.hpp"
+#include "Rect.hpp"
 // forward declarations, if any
 class Block;
 
@@ -66,6 +67,28 @@ class ContiguityAnalysis {
 //			double common_boundary_inter_die_hor = 0.0;
 		};
 
+		/// range of contiguous neighbours of one block; refers to the neighbours
+		/// stored for all blocks in ContiguityAnalysis::neighbours, in compressed
+		/// sparse row (CSR) layout; valid until the next call of analyseBlocks
+		struct Neighbours {
+
+			ContiguousNeighbour* first = nullptr;
+			ContiguousNeighbour* last = nullptr;
+
+			inline ContiguousNeighbour* begin() const {
+				return this->first;
+			}
+			inline ContiguousNeighbour* end() const {
+				return this->last;
+			}
+			inline unsigned size() const {
+				return this->last - this->first;
+			}
+			inline bool empty() const {
+				return this->first == this->last;
+			}
+		};
+
 		/// POD for block boundaries
 		struct Boundary {
 
@@ -88,6 +111,28 @@ class ContiguityAnalysis {
 
 	// private data, functions
 	private:
+		/// inter-die contiguity analysis: left boundaries of blocks for each pair
+		/// of adjacent dies, merged and sorted, and the same boundaries separated
+		/// by die (in the same order)
+		std::vector< std::vector<ContiguityAnalysis::Boundary> > inter_die_boundaries_vert;
+		std::vector<ContiguityAnalysis::Boundary> inter_die_boundaries_lower;
+		std::vector<ContiguityAnalysis::Boundary> inter_die_boundaries_upper;
+		/// positions of the above boundaries in the merged and sorted list
+		std::vector<unsigned> inter_die_positions_lower;
+		std::vector<unsigned> inter_die_positions_upper;
+
+		/// pairs of contiguous blocks (indices into the blocks container), in order
+		/// of their determination, and the resulting CSR layout of all blocks'
+		/// neighbours
+		std::vector< std::pair<unsigned, unsigned> > neighbour_pairs;
+		std::vector<unsigned> neighbours_offsets;
+		std::vector<ContiguityAnalysis::ContiguousNeighbour> neighbours;
+
+		/// blocks' geometry considered during last analysis; the analysis is
+		/// skipped if the layout is unchanged
+		std::vector<Rect> blocks_bbs;
+		std::vector<int> blocks_layers;
+
 		inline static bool boundaries_vert_comp(Boundary const& b1, Boundary const& b2);
 		inline static bool boundaries_hor_comp(Boundary const& b1, Boundary const& b2);
 
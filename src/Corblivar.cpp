@@ -70,6 +70,12 @@ int main (int argc, char** argv) {
 		// assume read in data as currently best solution
 		corb.storeBestCBLs();
 
+		// calibration run; fit thermal-mask parameters against given reference
+		// thermal map
+		if (fp.thermalCalibrationRun()) {
+			fp.calibrateThermalMasks(corb);
+		}
+
 		// overall cost is not determined; cost cannot be determined since no
 		// normalization during SA search was performed
 		fp.finalize(corb, false);
@@ -84,8 +90,17 @@ int main (int argc, char** argv) {
 			std::cout << "Performing SA floorplanning optimization ..." << std::endl << std::endl;
 		}
 
+		// init workers for batched evaluation of layout operations, if
+		// configured
+		fp.initBatchEvaluation(argc, argv);
+
 		// perform SA; main handler
-		done = fp.performSA(corb);
+		if (fp.getSAReplicas() > 1) {
+			done = fp.performParallelTemperingSA(corb, argc, argv);
+		}
+		else {
+			done = fp.performSA(corb);
+		}
 
 		if (fp.logMin()) {
 			std::cout << "Corblivar> ";
@@ -35,9 +35,18 @@
 #include <unordered_map>
 #include <set>
 #include <list>
+#include <deque>
 #include <bitset>
 #include <utility>
 #include <algorithm>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <chrono>
 // (TODO) replace w/ chrono
 #include <sys/timeb.h>
 
@@ -46,5 +55,6 @@
 #include <ctime>
 #include <cmath>
 #include <cstdlib>
+#include <cstdint>
 
 #endif
@@ -123,6 +123,9 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 		this->dies[die].CBL.T.push_back(std::move(cur_t));
 	}
 
+	// initial CBLs require full layout regeneration
+	this->invalidatePlacements();
+
 	if (CorblivarCore::DBG) {
 		for (CorblivarDie const& die : this->dies) {
 			std::cout << "DBG_CORE> ";
@@ -142,7 +145,7 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 	Block const* cur_block;
 	Block const* other_block;
-	std::vector<CorblivarAlignmentReq const*> cur_block_alignment_reqs;
+	std::vector<CorblivarAlignmentReq const*>& cur_block_alignment_reqs = this->cur_block_reqs;
 	CorblivarAlignmentReq const* req_processed;
 
 	if (CorblivarCore::DBG) {
@@ -153,9 +156,19 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 	// init die pointer
 	this->p = &this->dies[0];
 
-	// reset die data, i.e., layout generation handler data
+	// reset die data, i.e., layout generation handler data; w/o alignment, the
+	// dies are independent of each other and the layout generation can be
+	// resumed from the checkpoint before each die's first modified tuple;
+	// w/ alignment, blocks may be shifted across dies and all dies are to be
+	// generated from scratch
 	for (CorblivarDie& die : this->dies) {
-		die.reset();
+
+		if (perform_alignment) {
+			die.reset();
+		}
+		else {
+			die.resume();
+		}
 	}
 
 	// reset alignments-in-process list
@@ -215,7 +228,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 			if (perform_alignment) {
 
 				// determine related requests for current block
-				cur_block_alignment_reqs = this->findAlignmentReqs(cur_block);
+				this->findAlignmentReqs(cur_block, cur_block_alignment_reqs);
 
 				// some requests are given, handle them stepwise
 				if (!cur_block_alignment_reqs.empty()) {
@@ -297,7 +310,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 						// request is processed; drop from list of
 						// requests-in-process
 						else {
-							this->AL.remove(req_processed);
+							this->AL.erase(std::remove(this->AL.begin(), this->AL.end(), req_processed), this->AL.end());
 						}
 					}
 
@@ -322,14 +335,29 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 				}
 			}
 
-			// handling block alignment is not desired, simply place blocks
+			// handling block alignment is not desired, simply place blocks;
+			// also memorize placement stacks for partial regeneration
 			else {
 				this->p->placeCurrentBlock(perform_alignment);
+				this->p->storeCheckpoint();
 				this->p->updateProgressPointerFlag();
 			}
 		}
 	}
 
+	// memorize from which tuple onwards the next layout generation has to be
+	// performed; w/ alignment, checkpoints are not available and the whole
+	// layout is to be regenerated next time
+	for (CorblivarDie& die : this->dies) {
+
+		if (perform_alignment) {
+			die.regen_tuple = 0;
+		}
+		else {
+			die.regen_tuple = die.CBL.size();
+		}
+	}
+
 	if (CorblivarCore::DBG) {
 		std::cout << "DBG_CORE> ";
 		std::cout << "Done" << std::endl;
@@ -343,7 +371,6 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	Block const* b2;
 	CorblivarDie* die_b1;
 	CorblivarDie* die_b2;
-	std::list<Block const*> b1_relev_blocks, b2_relev_blocks;
 	Direction dir_b1, dir_b2;
 	bool b1_shifted, b2_shifted;
 	bool b1_to_shift_horizontal, b1_to_shift_vertical, b2_to_shift_horizontal, b2_to_shift_vertical;
@@ -364,8 +391,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		die_b2 = &this->dies[b2->layer];
 
 		// pop relevant blocks from related placement stacks
-		b1_relev_blocks = die_b1->popRelevantBlocks();
-		b2_relev_blocks = die_b2->popRelevantBlocks();
+		die_b1->popRelevantBlocks(this->b1_relev_blocks);
+		die_b2->popRelevantBlocks(this->b2_relev_blocks);
 
 		// first, we need to determine which insertion direction is to be applied
 		// for each block
@@ -388,8 +415,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				}
 
 				// first, determine blocks' y-coordinates
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks);
 
 				// perform shift in y-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req);
@@ -398,8 +425,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// second, determine block's x-coordinates (depends on
 				// y-coord of relevant blocks and, more generally, on
 				// previously placed, possibly shifted blocks)
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks, true);
 
 				// perform shift in x-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req) || b1_shifted;
@@ -414,8 +441,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				}
 
 				// first, determine blocks' x-coordinates
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks);
 
 				// perform shift in x-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req);
@@ -424,8 +451,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// second, determine block's y-coordinates (depends on
 				// x-coord of relevant blocks and, more generally, on
 				// previously placed, possibly shifted blocks)
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks, true);
 
 				// perform shift in y-dir, if required and possible
 				b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req) || b1_shifted;
@@ -443,20 +470,20 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 
 			// initially, determine all coordinates
 			if (dir_b1 == Direction::HORIZONTAL) {
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
 			}
 			else {
-				die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
-				die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
+				die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
+				die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
 			}
 			if (dir_b2 == Direction::HORIZONTAL) {
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks, true);
 			}
 			else {
-				die_b2->determCurrentBlockCoords(Coordinate::X, b2_relev_blocks);
-				die_b2->determCurrentBlockCoords(Coordinate::Y, b2_relev_blocks, true);
+				die_b2->determCurrentBlockCoords(Coordinate::X, this->b2_relev_blocks);
+				die_b2->determCurrentBlockCoords(Coordinate::Y, this->b2_relev_blocks, true);
 			}
 
 			// second, determine which block is to be shifted in which direction
@@ -474,7 +501,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// perform shifting of b1; helper also considers to shift
 				// b2 if required
 				CorblivarCore::sequentialShiftingHelper(
-						die_b1, die_b2, req, b1_relev_blocks, b2_relev_blocks, dir_b1, b1_shifted, b2_shifted);
+						die_b1, die_b2, req, this->b1_relev_blocks, this->b2_relev_blocks, dir_b1, b1_shifted, b2_shifted);
 			}
 
 			else if (b2_to_shift_horizontal && b2_to_shift_vertical) {
@@ -482,7 +509,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 				// perform shifting of b2; helper also considers to shift
 				// b1 if required
 				CorblivarCore::sequentialShiftingHelper(
-						die_b2, die_b1, req, b2_relev_blocks, b1_relev_blocks, dir_b2, b2_shifted, b1_shifted);
+						die_b2, die_b1, req, this->b2_relev_blocks, this->b1_relev_blocks, dir_b2, b2_shifted, b1_shifted);
 			}
 
 			// b) one or both blocks are to be shifted in their first direction
@@ -521,18 +548,18 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// since the corner-block front in both dimensions may be different now
 		//
 		if (b1_shifted) {
-			die_b1->rebuildPlacementStacks(b1_relev_blocks);
+			die_b1->rebuildPlacementStacks(this->b1_relev_blocks);
 		}
 		// if a block was not shifted, we can simply update the placement stacks
 		else {
-			die_b1->updatePlacementStacks(b1_relev_blocks);
+			die_b1->updatePlacementStacks(this->b1_relev_blocks);
 		}
 
 		if (b2_shifted) {
-			die_b2->rebuildPlacementStacks(b2_relev_blocks);
+			die_b2->rebuildPlacementStacks(this->b2_relev_blocks);
 		}
 		else {
-			die_b2->updatePlacementStacks(b2_relev_blocks);
+			die_b2->updatePlacementStacks(this->b2_relev_blocks);
 		}
 
 		// mark (shifted) blocks as placed
@@ -588,7 +615,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		}
 
 		// pop relevant blocks from related placement stack
-		b1_relev_blocks = die_b1->popRelevantBlocks();
+		die_b1->popRelevantBlocks(this->b1_relev_blocks);
 
 		// horizontal placement
 		if (die_b1->getCurrentDirection() == Direction::HORIZONTAL) {
@@ -599,7 +626,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			}
 
 			// first, determine block's y-coordinates
-			die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks);
+			die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks);
 
 			// perform shift in y-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req);
@@ -607,7 +634,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			// second, determine block's x-coordinates (depends on y-coord of
 			// relevant blocks and, more generally, on previously placed,
 			// possibly shifted blocks)
-			die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks, true);
+			die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks, true);
 
 			// perform shift in x-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req) || b1_shifted;
@@ -621,7 +648,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			}
 
 			// first, determine block's x-coordinates
-			die_b1->determCurrentBlockCoords(Coordinate::X, b1_relev_blocks);
+			die_b1->determCurrentBlockCoords(Coordinate::X, this->b1_relev_blocks);
 
 			// perform shift in x-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::HORIZONTAL, req);
@@ -629,7 +656,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 			// second, determine block's y-coordinates (depends on x-coord of
 			// relevant blocks and, more generally, on previously placed,
 			// possibly shifted blocks)
-			die_b1->determCurrentBlockCoords(Coordinate::Y, b1_relev_blocks, true);
+			die_b1->determCurrentBlockCoords(Coordinate::Y, this->b1_relev_blocks, true);
 
 			// perform shift in y-dir, if required and possible
 			b1_shifted = die_b1->shiftCurrentBlock(Direction::VERTICAL, req) || b1_shifted;
@@ -638,11 +665,11 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// if the block was shifted, we need to rebuild the placement stacks since
 		// the corner-block front in both dimensions may be different now
 		if (b1_shifted) {
-			die_b1->rebuildPlacementStacks(b1_relev_blocks);
+			die_b1->rebuildPlacementStacks(this->b1_relev_blocks);
 		}
 		// if the block was not shifted, we can simply update the placement stacks
 		else {
-			die_b1->updatePlacementStacks(b1_relev_blocks);
+			die_b1->updatePlacementStacks(this->b1_relev_blocks);
 		}
 
 		// mark shifted block as placed
@@ -657,7 +684,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	return true;
 }
 
-void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, std::list<Block const*> b1_relev_blocks, std::list<Block const*> b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
+void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, std::vector<Block const*> const& b1_relev_blocks, std::vector<Block const*> const& b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
 
 	// annotate that b1 is shifted at least in one direction
 	b1_shifted = true;
@@ -745,36 +772,30 @@ void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie*
 	}
 }
 
-std::vector<CorblivarAlignmentReq const*> CorblivarCore::findAlignmentReqs(Block const* b) const {
-	std::vector<CorblivarAlignmentReq const*> ret;
-
-	// sanity check for no given requests
-	if (this->A.empty()) {
-		return ret;
-	}
+void CorblivarCore::findAlignmentReqs(Block const* b, std::vector<CorblivarAlignmentReq const*>& reqs) const {
 
-	// determine requests covering the given block
-	for (CorblivarAlignmentReq const& req : this->A) {
+	reqs.clear();
 
-		if (req.s_i->numerical_id == b->numerical_id || req.s_j->numerical_id == b->numerical_id) {
+	// determine requests covering the given block; these are memorized in the
+	// block itself, see IO::parseAlignmentRequests, in the order of the requests
+	for (CorblivarAlignmentReq const* req : b->alignments) {
 
-			// only consider request which are still in
-			// process, i.e., not both blocks are placed yet
-			if (!req.s_i->placed || !req.s_j->placed) {
-
-				if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
-					std::cout << "DBG_ALIGNMENT>  Unhandled request: " << req.tupleString() << std::endl;
-				}
+		// only consider request which are still in
+		// process, i.e., not both blocks are placed yet
+		if (!req->s_i->placed || !req->s_j->placed) {
 
-				ret.push_back(&req);
+			if (CorblivarAlignmentReq::DBG_LAYOUT_GENERATION) {
+				std::cout << "DBG_ALIGNMENT>  Unhandled request: " << req->tupleString() << std::endl;
 			}
+
+			reqs.push_back(req);
 		}
 	}
 
 	// requests w/ placed blocks are considered first; eases handling
 	// of alignment requests such that blocks ready for alignment are
 	// placed/aligned first
-	std::sort(ret.begin(), ret.end(),
+	std::sort(reqs.begin(), reqs.end(),
 		// lambda expression
 		[](CorblivarAlignmentReq const* req1, CorblivarAlignmentReq const* req2) {
 			return
@@ -786,8 +807,6 @@ std::vector<CorblivarAlignmentReq const*> CorblivarCore::findAlignmentReqs(Block
 				);
 		}
 	);
-
-	return ret;
 }
 
 void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
@@ -846,6 +865,9 @@ void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
 			break;
 	}
 
+	// sorted CBLs require full layout regeneration
+	this->invalidatePlacements();
+
 	// reassign CBL sequences from tuple vectors
 	unsigned d = 0;
 	for (CorblivarDie& die : this->dies) {
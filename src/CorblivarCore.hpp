@@ -73,8 +73,18 @@ class CorblivarCore {
 		/// sequence A; alignment requests
 		std::vector<CorblivarAlignmentReq> A;
 
-		/// alignments-in-process list
-		std::list<CorblivarAlignmentReq const*> AL;
+		/// alignments-in-process list; memory is retained across layout
+		/// generations
+		std::vector<CorblivarAlignmentReq const*> AL;
+
+		/// relevant blocks popped from placement stacks of both blocks to be
+		/// aligned; scratch buffers, preallocated; separate from the dies'
+		/// buffers since both blocks may be placed on the same die
+		std::vector<Block const*> b1_relev_blocks, b2_relev_blocks;
+
+		/// alignment requests for current block; scratch buffer, memory is
+		/// retained across layout generations
+		std::vector<CorblivarAlignmentReq const*> cur_block_reqs;
 
 		/// handler for block alignment
 		bool alignBlocks(CorblivarAlignmentReq const* req);
@@ -82,11 +92,12 @@ class CorblivarCore {
 		static void sequentialShiftingHelper(
 				CorblivarDie* die_b1, CorblivarDie* die_b2,
 				CorblivarAlignmentReq const* req,
-				std::list<Block const*> b1_relev_blocks, std::list<Block const*> b2_relev_blocks,
+				std::vector<Block const*> const& b1_relev_blocks, std::vector<Block const*> const& b2_relev_blocks,
 				Direction const& dir_b1,
 				bool& b1_shifted, bool& b2_shifted);
-		/// handler for block alignment
-		std::vector<CorblivarAlignmentReq const*> findAlignmentReqs(Block const* b) const;
+		/// handler for block alignment; note that reqs is return-by-reference,
+		/// the buffer is reset beforehand
+		void findAlignmentReqs(Block const* b, std::vector<CorblivarAlignmentReq const*>& reqs) const;
 
 	// constructors, destructors, if any non-implicit
 	public:
@@ -101,9 +112,14 @@ class CorblivarCore {
 				CorblivarDie cur_die = CorblivarDie(i);
 				// reserve mem for worst case, i.e., all blocks in one particular die
 				cur_die.CBL.reserve(blocks);
+				cur_die.reserve(blocks);
 
 				this->dies.push_back(std::move(cur_die));
 			}
+
+			// allocate buffers for block alignment
+			this->b1_relev_blocks.reserve(blocks);
+			this->b2_relev_blocks.reserve(blocks);
 		};
 
 	// public data, functions
@@ -111,9 +127,20 @@ class CorblivarCore {
 
 		/// general operations; randomly setup data structure from input
 		void initCorblivarRandomly(bool const& log, int const& layers, std::vector<Block> const& blocks, bool const& power_aware_assignment);
-		/// general operations; generate layout from data structure
+		/// general operations; generate layout from data structure; w/o
+		/// alignment, the layout is only regenerated for the tuples modified
+		/// since the previous layout generation, as marked on each die
 		bool generateLayout(bool const& perform_alignment);
 
+		/// layout-generation handler; marks the placement of all dies as invalid,
+		/// i.e., enforces full regeneration during next layout generation
+		inline void invalidatePlacements() {
+
+			for (CorblivarDie& die : this->dies) {
+				die.invalidatePlacement();
+			}
+		};
+
 		/// getter
 		inline CorblivarDie& editDie(unsigned const& die) {
 			return this->dies[die];
@@ -143,6 +170,10 @@ class CorblivarCore {
 			// perform swap
 			std::swap(this->dies[die1].CBL.S[tuple1], this->dies[die2].CBL.S[tuple2]);
 
+			// placement becomes invalid from the swapped tuples onwards
+			this->dies[die1].invalidatePlacement(tuple1);
+			this->dies[die2].invalidatePlacement(tuple2);
+
 			if (DBG) {
 				std::cout << "DBG_CORE> swapBlocks;";
 				std::cout << " d1=" << die1;
@@ -216,6 +247,11 @@ class CorblivarCore {
 				this->dies[die1].CBL.L.erase(this->dies[die1].CBL.L.begin() + tuple1);
 				this->dies[die1].CBL.T.erase(this->dies[die1].CBL.T.begin() + tuple1);
 			}
+
+			// placement becomes invalid from the removed/inserted tuples
+			// onwards
+			this->dies[die1].invalidatePlacement(tuple1);
+			this->dies[die2].invalidatePlacement(tuple2);
 		};
 
 		/// abstract layout-modification operation
@@ -228,6 +264,9 @@ class CorblivarCore {
 				this->dies[die].CBL.L[tuple] = Direction::VERTICAL;
 			}
 
+			// placement becomes invalid from the modified tuple onwards
+			this->dies[die].invalidatePlacement(tuple);
+
 			if (DBG) {
 				std::cout << "DBG_CORE> switchInsertionDirection;";
 				std::cout << " d1=" << die;
@@ -258,6 +297,9 @@ class CorblivarCore {
 
 			this->dies[die].CBL.T[tuple] = juncts;
 
+			// placement becomes invalid from the modified tuple onwards
+			this->dies[die].invalidatePlacement(tuple);
+
 			if (DBG) {
 				std::cout << "DBG_CORE> switchTupleJunctions;";
 				std::cout << " d1=" << die;
@@ -314,6 +356,9 @@ class CorblivarCore {
 		/// CBL backup handler
 		inline void restoreCBLs() {
 
+			// restored CBLs require full layout regeneration
+			this->invalidatePlacements();
+
 			for (CorblivarDie& die : this->dies) {
 
 				die.CBL.clear();
@@ -368,6 +413,9 @@ class CorblivarCore {
 			unsigned empty_dies = 0;
 			bool ret;
 
+			// applied CBLs require full layout regeneration
+			this->invalidatePlacements();
+
 			for (CorblivarDie& die : this->dies) {
 
 				die.CBL.clear();
@@ -403,6 +451,97 @@ class CorblivarCore {
 
 			return ret;
 		};
+		/// CBL best-solution handler
+		///
+		/// adopts the best solution of another instance, e.g., of an SA replica;
+		/// since the other instance refers to its own set of blocks, the blocks
+		/// are mapped via their numerical ids to the given blocks
+		inline void adoptBestCBLs(CorblivarCore const& other, std::vector<Block> const& blocks) {
+
+			for (unsigned i = 0; i < this->dies.size(); i++) {
+				CorblivarDie& die = this->dies[i];
+				CorblivarDie const& other_die = other.dies[i];
+
+				die.CBLbest.clear();
+				die.CBLbest.reserve(die.CBL.capacity());
+
+				for (Block const* other_b : other_die.CBLbest.S) {
+					Block const* b = &blocks[other_b->numerical_id];
+
+					// adopt bb from other block
+					b->bb_best = other_b->bb_best;
+
+					die.CBLbest.S.push_back(b);
+				}
+				for (Direction const& dir : other_die.CBLbest.L) {
+					die.CBLbest.L.push_back(dir);
+				}
+				for (unsigned const& t_juncts : other_die.CBLbest.T) {
+					die.CBLbest.T.push_back(t_juncts);
+				}
+			}
+		};
+		/// CBL handler
+		///
+		/// adopts the current CBLs of another instance, e.g., of a worker for
+		/// batched evaluation of layout operations; the blocks are mapped via
+		/// their numerical ids to the given blocks, and the blocks' shapes as
+		/// well as the alignment requests' coordinates are adopted as well,
+		/// since both may be subject to layout operations
+		///
+		/// the layout is only to be regenerated from the first tuple differing
+		/// from the previous CBLs onwards, such that partial regeneration
+		/// remains applicable, e.g., for the candidate accepted by batched
+		/// evaluation, which differs only in the tuples of one layout operation
+		inline void adoptCBLs(CorblivarCore const& other, std::vector<Block> const& blocks) {
+			unsigned t;
+
+			for (unsigned i = 0; i < this->dies.size(); i++) {
+				CorblivarDie& die = this->dies[i];
+				CorblivarDie const& other_die = other.dies[i];
+
+				// determine first modified tuple; blocks are compared by
+				// their numerical ids, and their shapes are compared as well
+				for (t = 0; t < std::min(die.CBL.size(), other_die.CBL.size()); t++) {
+
+					if (die.CBL.S[t]->numerical_id != other_die.CBL.S[t]->numerical_id ||
+							die.CBL.L[t] != other_die.CBL.L[t] ||
+							die.CBL.T[t] != other_die.CBL.T[t] ||
+							die.CBL.S[t]->bb.w != other_die.CBL.S[t]->bb.w ||
+							die.CBL.S[t]->bb.h != other_die.CBL.S[t]->bb.h
+					   ) {
+						break;
+					}
+				}
+				die.invalidatePlacement(t);
+
+				die.CBL.clear();
+				die.CBL.reserve(other_die.CBL.capacity());
+
+				for (Block const* other_b : other_die.CBL.S) {
+					Block const* b = &blocks[other_b->numerical_id];
+
+					// adopt shape and layer assignment
+					b->bb = other_b->bb;
+					b->layer = die.id;
+
+					die.CBL.S.push_back(b);
+				}
+				for (Direction const& dir : other_die.CBL.L) {
+					die.CBL.L.push_back(dir);
+				}
+				for (unsigned const& t_juncts : other_die.CBL.T) {
+					die.CBL.T.push_back(t_juncts);
+				}
+			}
+
+			for (unsigned i = 0; i < this->A.size(); i++) {
+				this->A[i].type_x = other.A[i].type_x;
+				this->A[i].type_y = other.A[i].type_y;
+				this->A[i].alignment_x = other.A[i].alignment_x;
+				this->A[i].alignment_y = other.A[i].alignment_y;
+			}
+		};
 };
 
 #endif
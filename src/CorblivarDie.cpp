@@ -31,7 +31,7 @@
 #include "CorblivarAlignmentReq.hpp"
 
 void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
-	std::list<Block const*> relevBlocks;
+	std::vector<Block const*>& relevBlocks = this->relev_blocks;
 
 	// current tuple; only mutable block parameters can be edited
 	Block const* cur_block = this->getCurrentBlock();
@@ -43,7 +43,7 @@ void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
 	}
 
 	// pop relevant blocks from related placement stack
-	relevBlocks = this->popRelevantBlocks();
+	this->popRelevantBlocks(relevBlocks);
 
 	// horizontal placement
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
@@ -80,7 +80,7 @@ void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
 
 void CorblivarDie::debugStacks() {
 	Block const* cur_block = this->getCurrentBlock();
-	std::list<Block const*>::iterator iter;
+	PlacementStack::iterator iter;
 
 	std::cout << "DBG_CORB> ";
 	std::cout << "Processed (placed) CBL tuple " << this->getCBL().tupleString(this->pi) << " on die " << this->id + 1 << ": ";
@@ -142,10 +142,11 @@ bool CorblivarDie::debugLayout() const {
 	return invalid;
 }
 
-std::list<Block const*> CorblivarDie::popRelevantBlocks() {
-	std::list<Block const*> ret;
+void CorblivarDie::popRelevantBlocks(std::vector<Block const*>& ret) {
 	unsigned blocks_count;
 
+	ret.clear();
+
 	// horizontal placement; consider stack Hi
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
 
@@ -155,7 +156,7 @@ std::list<Block const*> CorblivarDie::popRelevantBlocks() {
 
 		// pop relevant blocks from stack into return list
 		while (blocks_count > ret.size()) {
-			ret.push_back(std::move(this->Hi.front()));
+			ret.push_back(this->Hi.front());
 			this->Hi.pop_front();
 		}
 	}
@@ -168,15 +169,13 @@ std::list<Block const*> CorblivarDie::popRelevantBlocks() {
 
 		// pop relevant blocks from stack into return list
 		while (blocks_count > ret.size()) {
-			ret.push_back(std::move(this->Vi.front()));
+			ret.push_back(this->Vi.front());
 			this->Vi.pop_front();
 		}
 	}
-
-	return ret;
 }
 
-void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_stack) {
+void CorblivarDie::updatePlacementStacks(std::vector<Block const*> const& relev_blocks_stack) {
 	bool add_to_stack;
 	Block const* b;
 
@@ -232,7 +231,7 @@ void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_s
 		// by reverse iteration, we retain the (implicit) ordering of blocks
 		// popped from stack Hi regarding their insertion order; required for
 		// proper stack manipulation
-		for (std::list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (std::vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true)) {
@@ -271,7 +270,7 @@ void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_s
 		// iteration, we retain the (implicit) ordering of blocks popped from
 		// stack Vi regarding their insertion order; required for proper stack
 		// manipulation
-		for (std::list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (std::vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_below_rectB(b->bb, cur_block->bb, true)) {
@@ -281,9 +280,8 @@ void CorblivarDie::updatePlacementStacks(std::list<Block const*>& relev_blocks_s
 	}
 }
 
-void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_stack) {
-	std::list<Block const*>::iterator iter;
-	std::list<Block const*> stack_backup;
+void CorblivarDie::rebuildPlacementStacks(std::vector<Block const*> const& relev_blocks_stack) {
+	PlacementStack::iterator iter;
 	bool covered;
 
 	// current block
@@ -461,7 +459,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 		// first, try to fix Hi
 		//
 		// local copy Hi for backup
-		stack_backup = this->Hi;
+		this->stack_backup.assign(this->Hi);
 
 		// try dropping blocks until corner blocks match
 		while (this->Hi.front() != this->Vi.front()) {
@@ -478,10 +476,10 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 		if (this->Hi.empty()) {
 
 			// restore Hi
-			this->Hi = stack_backup;
+			this->Hi.assign(this->stack_backup);
 
 			// local copy Vi for backup
-			stack_backup = this->Vi;
+			this->stack_backup.assign(this->Vi);
 
 			// try dropping blocks until corner blocks match
 			while (this->Hi.front() != this->Vi.front()) {
@@ -499,7 +497,7 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 			if (this->Vi.empty()) {
 
 				// restore Vi
-				this->Vi = stack_backup;
+				this->Vi.assign(this->stack_backup);
 
 				// dbg log for failure
 				if (CorblivarDie::DBG_STACKS) {
@@ -510,8 +508,39 @@ void CorblivarDie::rebuildPlacementStacks(std::list<Block const*>& relev_blocks_
 	}
 }
 
-void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, std::list<Block const*> const& relev_blocks_stack, bool const& extended_check) const {
+void CorblivarDie::updatePlacedIndex() {
+	Block const* b;
+
+	// blocks are placed in order of their tuples; thus, walk all blocks
+	// following the already indexed ones, until a not yet placed block is
+	// reached
+	while (this->placed_indexed < this->CBL.size() && this->CBL.S[this->placed_indexed]->placed) {
+		b = this->CBL.S[this->placed_indexed];
+
+		// insert block, sorted by lower-left coordinates
+		this->placed_by_x.insert(std::upper_bound(this->placed_by_x.begin(), this->placed_by_x.end(), b,
+			// lambda expression
+			[](Block const* b1, Block const* b2) {
+				return b1->bb.ll.x < b2->bb.ll.x;
+			}
+		), b);
+		this->placed_by_y.insert(std::upper_bound(this->placed_by_y.begin(), this->placed_by_y.end(), b,
+			// lambda expression
+			[](Block const* b1, Block const* b2) {
+				return b1->bb.ll.y < b2->bb.ll.y;
+			}
+		), b);
+
+		this->placed_max_w = std::max(this->placed_max_w, b->bb.w);
+		this->placed_max_h = std::max(this->placed_max_h, b->bb.h);
+
+		this->placed_indexed++;
+	}
+}
+
+void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, std::vector<Block const*> const& relev_blocks_stack, bool const& extended_check) {
 	double x, y;
+	std::vector<Block const*>::const_iterator first, last;
 
 	// current block
 	Block const* cur_block = this->getCurrentBlock();
@@ -560,22 +589,34 @@ void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, std::list<B
 			//
 			if (extended_check) {
 
-				// walk all blocks (implicitly ordered such that placed
-				// blocks are first)
-				for (unsigned b = 0; b < this->getCBL().size(); b++) {
-
-					// if not yet placed block is reached, the
-					// following blocks are also not placed, i.e., not
-					// relevant; break loop
-					if (!this->getBlock(b)->placed) {
-						break;
+				// all placed blocks are to be considered, as given by
+				// the index
+				this->updatePlacedIndex();
+
+				// only blocks w/ lower-left y-coordinate in range
+				// [ll.y - max height, ur.y] may intersect in
+				// y-direction; the range is extended by another max
+				// height to safely cover any rounding for the blocks'
+				// upper-right coordinates
+				first = std::lower_bound(this->placed_by_y.begin(), this->placed_by_y.end(), cur_block->bb.ll.y - 2.0 * this->placed_max_h,
+					// lambda expression
+					[](Block const* b, double const& y) {
+						return b->bb.ll.y < y;
 					}
-					else {
-						// only consider blocks which intersect in y-direction
-						if (Rect::rectsIntersectVertical(cur_block->bb, this->getBlock(b)->bb)) {
-							// determine right front
-							x = std::max(x, this->getBlock(b)->bb.ur.x);
-						}
+				);
+				last = std::upper_bound(first, this->placed_by_y.cend(), cur_block->bb.ur.y,
+					// lambda expression
+					[](double const& y, Block const* b) {
+						return y < b->bb.ll.y;
+					}
+				);
+
+				for (; first != last; ++first) {
+
+					// only consider blocks which intersect in y-direction
+					if (Rect::rectsIntersectVertical(cur_block->bb, (*first)->bb)) {
+						// determine right front
+						x = std::max(x, (*first)->bb.ur.x);
 					}
 				}
 			}
@@ -642,22 +683,34 @@ void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, std::list<B
 			//
 			if (extended_check) {
 
-				// walk all blocks (implicitly ordered such that placed
-				// blocks are first)
-				for (unsigned b = 0; b < this->getCBL().size(); b++) {
-
-					// if not yet placed block is reached, the
-					// following blocks are also not placed, i.e., not
-					// relevant; break loop
-					if (!this->getBlock(b)->placed) {
-						break;
+				// all placed blocks are to be considered, as given by
+				// the index
+				this->updatePlacedIndex();
+
+				// only blocks w/ lower-left x-coordinate in range
+				// [ll.x - max width, ur.x] may intersect in
+				// x-direction; the range is extended by another max
+				// width to safely cover any rounding for the blocks'
+				// upper-right coordinates
+				first = std::lower_bound(this->placed_by_x.begin(), this->placed_by_x.end(), cur_block->bb.ll.x - 2.0 * this->placed_max_w,
+					// lambda expression
+					[](Block const* b, double const& x) {
+						return b->bb.ll.x < x;
 					}
-					else {
-						// only consider blocks which intersect in x-direction
-						if (Rect::rectsIntersectHorizontal(cur_block->bb, this->getBlock(b)->bb)) {
-							// determine upper front
-							y = std::max(y, this->getBlock(b)->bb.ur.y);
-						}
+				);
+				last = std::upper_bound(first, this->placed_by_x.cend(), cur_block->bb.ur.x,
+					// lambda expression
+					[](double const& x, Block const* b) {
+						return x < b->bb.ll.x;
+					}
+				);
+
+				for (; first != last; ++first) {
+
+					// only consider blocks which intersect in x-direction
+					if (Rect::rectsIntersectHorizontal(cur_block->bb, (*first)->bb)) {
+						// determine upper front
+						y = std::max(y, (*first)->bb.ur.y);
 					}
 				}
 			}
@@ -932,8 +985,20 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 /// FloorPlanner::evaluateAlignments before packing but after layout generation
 /// (FloorPlanner::evaluateAlignments does annotate alignment success / failure to the
 /// blocks themselves, via call to CorblivarAlignmentReq::evaluate)
+///
+/// packing is realized as sweep line: the blocks are processed in order of their
+/// lower-left coordinate, and the front of all blocks swept so far is maintained in a
+/// skyline (segment tree over the blocks' boundaries orthogonal to the packing
+/// direction); the packed coordinate of each block is then given by the skyline's
+/// maximal front within the block's range, determined in O(log n); overall runtime
+/// is thus O(n log n), instead of O(n^2) for checking all blocks against each other
+///
+/// the skyline's front is only valid as long as the swept blocks in the block's range
+/// are all left of (below) the block, which holds for overlap-free layouts; for
+/// invalid layouts, e.g., arising from alignment, the front may be beyond the block,
+/// and then the neighbors are checked explicitly as fallback
 void CorblivarDie::performPacking(Direction const& dir) {
-	std::vector<Block const*> blocks;
+	std::vector<Block const*>& blocks = this->packing_blocks;
 	std::vector<Block const*>::iterator i1;
 	std::vector<Block const*>::reverse_iterator i2;
 	Block const* block;
@@ -942,9 +1007,11 @@ void CorblivarDie::performPacking(Direction const& dir) {
 	std::vector<Rect> blocks_checked;
 	double range_checked;
 	Rect cur_intersect, cur_prev_intersect;
+	unsigned lower, upper, intervals;
 
-	// store blocks in separate list, for subsequent sorting
-	blocks.insert(blocks.begin(), this->getCBL().S.begin(), this->getCBL().S.end());
+	// store blocks in separate list, for subsequent sorting; memory of buffer is
+	// retained
+	blocks.assign(this->getCBL().S.begin(), this->getCBL().S.end());
 
 	if (dir == Direction::HORIZONTAL) {
 
@@ -972,67 +1039,85 @@ void CorblivarDie::performPacking(Direction const& dir) {
 			}
 		);
 
-		// for each block, check the adjacent blocks and perform packing by
-		// considering the neighbors' nearest right front
+		// init skyline over the blocks' vertical boundaries; these remain
+		// unchanged during horizontal packing
+		this->initSkyline(Coordinate::Y);
+		intervals = this->skyline_coords.size() - 1;
+
+		// for each block, determine the neighbors' nearest right front and
+		// perform packing accordingly
 		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
 			block= *i1;
 
-			// skip blocks at left boundary, they are implicitly packed
-			if (block->bb.ll.x == 0.0) {
-				continue;
-			}
+			lower = this->skylineIndex(block->bb.ll.y);
+			upper = this->skylineIndex(block->bb.ur.y);
 
-			// also skip blocks which are successfully aligned; this way, they
-			// keep their position and alignment is not broken
-			if (block->alignment == Block::AlignmentStatus::SUCCESS) {
+			// skip blocks at left boundary, they are implicitly packed;
+			// also skip blocks which are successfully aligned; this way,
+			// they keep their position and alignment is not broken
+			if (block->bb.ll.x == 0.0 || block->alignment == Block::AlignmentStatus::SUCCESS) {
+
+				// note that skipped blocks are still to be considered
+				// for the front
+				this->updateSkyline(1, 0, intervals, lower, upper, block->bb.ur.x);
 				continue;
 			}
 
-			// init packed coordinate
-			x = 0.0;
-			// init search stop flag
-			blocks_checked.clear();
-			range_checked = 0.0;
-
-			// check against other blocks; walk in reverse order since we only need to
-			// consider the blocks to the left
-			for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
-				neighbor = *i2;
-
-				if (Rect::rectA_leftOf_rectB(neighbor->bb, block->bb, true)) {
-
-					// determine the packed coordinate by considering
-					// the neigbors nearest right front
-					x = std::max(x, neighbor->bb.ur.x);
-
-					// current blocks' intersection
-					cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
-
-					// initially, consider the full intersection range
-					// as relevant
-					range_checked += cur_intersect.h;
-
-					// check the intersection w/ previous
-					// intersections in order to avoid redundant
-					// considerations of ranges
-					for (Rect const& r : blocks_checked) {
-
-						cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
-						// drop the additionally, redundant
-						// covered range
-						if (cur_prev_intersect.h > 0.0) {
-							range_checked -= cur_prev_intersect.h;
+			// init packed coordinate, by the skyline's front for the
+			// block's range
+			x = this->querySkyline(1, 0, intervals, lower, upper);
+
+			// the front is valid for all regular cases, where the swept
+			// blocks are all left of the current block; for invalid
+			// layouts or blocks w/o height, check against other blocks
+			if (x > block->bb.ll.x || lower == upper) {
+
+				// init packed coordinate
+				x = 0.0;
+				// init search stop flag
+				blocks_checked.clear();
+				range_checked = 0.0;
+
+				// check against other blocks; walk in reverse order since we only need to
+				// consider the blocks to the left
+				for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
+					neighbor = *i2;
+
+					if (Rect::rectA_leftOf_rectB(neighbor->bb, block->bb, true)) {
+
+						// determine the packed coordinate by considering
+						// the neigbors nearest right front
+						x = std::max(x, neighbor->bb.ur.x);
+
+						// current blocks' intersection
+						cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
+
+						// initially, consider the full intersection range
+						// as relevant
+						range_checked += cur_intersect.h;
+
+						// check the intersection w/ previous
+						// intersections in order to avoid redundant
+						// considerations of ranges
+						for (Rect const& r : blocks_checked) {
+
+							cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
+							// drop the additionally, redundant
+							// covered range
+							if (cur_prev_intersect.h > 0.0) {
+								range_checked -= cur_prev_intersect.h;
+							}
 						}
-					}
 
-					// memorize the actually covered range of the
-					// block front; use a set of rectangles
-					blocks_checked.push_back(cur_intersect);
+						// memorize the actually covered range of the
+						// block front; use a set of rectangles
+						blocks_checked.push_back(cur_intersect);
 
-					// in case the full block front was checked, we
-					// can stop checking other blocks
-					if (Math::looseDoubleComp(block->bb.h, range_checked)) {
-						break;
+						// in case the full block front was checked, we
+						// can stop checking other blocks
+						if (Math::looseDoubleComp(block->bb.h, range_checked)) {
+							break;
+						}
 					}
 				}
 			}
@@ -1042,6 +1127,9 @@ void CorblivarDie::performPacking(Direction const& dir) {
 			// left to right boundary)
 			block->bb.ll.x = x;
 			block->bb.ur.x = block->bb.w + x;
+
+			// update skyline w/ the block's new front
+			this->updateSkyline(1, 0, intervals, lower, upper, block->bb.ur.x);
 		}
 	}
 
@@ -1072,67 +1160,85 @@ void CorblivarDie::performPacking(Direction const& dir) {
 			}
 		);
 
-		// for each block, check the adjacent blocks and perform packing by
-		// considering the neighbors' nearest upper front
+		// init skyline over the blocks' horizontal boundaries; these remain
+		// unchanged during vertical packing
+		this->initSkyline(Coordinate::X);
+		intervals = this->skyline_coords.size() - 1;
+
+		// for each block, determine the neighbors' nearest upper front and
+		// perform packing accordingly
 		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
 			block= *i1;
 
-			// skip blocks at bottom boundary, they are implicitly packed
-			if (block->bb.ll.y == 0.0) {
-				continue;
-			}
+			lower = this->skylineIndex(block->bb.ll.x);
+			upper = this->skylineIndex(block->bb.ur.x);
 
-			// also skip blocks which are successfully aligned; this way, they
-			// keep their position and alignment is not broken
-			if (block->alignment == Block::AlignmentStatus::SUCCESS) {
+			// skip blocks at bottom boundary, they are implicitly packed;
+			// also skip blocks which are successfully aligned; this way,
+			// they keep their position and alignment is not broken
+			if (block->bb.ll.y == 0.0 || block->alignment == Block::AlignmentStatus::SUCCESS) {
+
+				// note that skipped blocks are still to be considered
+				// for the front
+				this->updateSkyline(1, 0, intervals, lower, upper, block->bb.ur.y);
 				continue;
 			}
 
-			// init packed coordinate
-			y = 0.0;
-			// init search stop flag
-			blocks_checked.clear();
-			range_checked = 0.0;
-
-			// check against other blocks; walk in reverse order since we only need to
-			// consider the blocks below
-			for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
-				neighbor = *i2;
-
-				if (Rect::rectA_below_rectB(neighbor->bb, block->bb, true)) {
-
-					// determine the packed coordinate by considering
-					// the neigbors nearest right front
-					y = std::max(y, neighbor->bb.ur.y);
-
-					// current blocks' intersection
-					cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
-
-					// initially, consider the full intersection range
-					// as relevant
-					range_checked += cur_intersect.w;
-
-					// check the intersection w/ previous
-					// intersections in order to avoid redundant
-					// considerations of ranges
-					for (Rect const& r : blocks_checked) {
-
-						cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
-						// drop the additionally, redundant
-						// covered range
-						if (cur_prev_intersect.w > 0.0) {
-							range_checked -= cur_prev_intersect.w;
+			// init packed coordinate, by the skyline's front for the
+			// block's range
+			y = this->querySkyline(1, 0, intervals, lower, upper);
+
+			// the front is valid for all regular cases, where the swept
+			// blocks are all below the current block; for invalid layouts
+			// or blocks w/o width, check against other blocks
+			if (y > block->bb.ll.y || lower == upper) {
+
+				// init packed coordinate
+				y = 0.0;
+				// init search stop flag
+				blocks_checked.clear();
+				range_checked = 0.0;
+
+				// check against other blocks; walk in reverse order since we only need to
+				// consider the blocks below
+				for (i2 = std::vector<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
+					neighbor = *i2;
+
+					if (Rect::rectA_below_rectB(neighbor->bb, block->bb, true)) {
+
+						// determine the packed coordinate by considering
+						// the neigbors nearest right front
+						y = std::max(y, neighbor->bb.ur.y);
+
+						// current blocks' intersection
+						cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
+
+						// initially, consider the full intersection range
+						// as relevant
+						range_checked += cur_intersect.w;
+
+						// check the intersection w/ previous
+						// intersections in order to avoid redundant
+						// considerations of ranges
+						for (Rect const& r : blocks_checked) {
+
+							cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
+							// drop the additionally, redundant
+							// covered range
+							if (cur_prev_intersect.w > 0.0) {
+								range_checked -= cur_prev_intersect.w;
+							}
 						}
-					}
 
-					// memorize the actually covered range of the
-					// block front; use a set of rectangles
-					blocks_checked.push_back(cur_intersect);
+						// memorize the actually covered range of the
+						// block front; use a set of rectangles
+						blocks_checked.push_back(cur_intersect);
 
-					// in case the full block front was checked, we
-					// can stop checking other blocks
-					if (Math::looseDoubleComp(block->bb.w, range_checked)) {
-						break;
+						// in case the full block front was checked, we
+						// can stop checking other blocks
+						if (Math::looseDoubleComp(block->bb.w, range_checked)) {
+							break;
+						}
 					}
 				}
 			}
@@ -1142,6 +1248,85 @@ void CorblivarDie::performPacking(Direction const& dir) {
 			// step-wise packing from bottom to top boundary)
 			block->bb.ll.y = y;
 			block->bb.ur.y = block->bb.h + y;
+
+			// update skyline w/ the block's new front
+			this->updateSkyline(1, 0, intervals, lower, upper, block->bb.ur.y);
 		}
 	}
 }
+
+void CorblivarDie::initSkyline(Coordinate const& coord) {
+	unsigned nodes;
+
+	// collect the blocks' boundaries orthogonal to the packing direction
+	this->skyline_coords.clear();
+
+	for (Block const* b : this->packing_blocks) {
+
+		if (coord == Coordinate::Y) {
+			this->skyline_coords.push_back(b->bb.ll.y);
+			this->skyline_coords.push_back(b->bb.ur.y);
+		}
+		else {
+			this->skyline_coords.push_back(b->bb.ll.x);
+			this->skyline_coords.push_back(b->bb.ur.x);
+		}
+	}
+
+	// sorted and unique boundaries define the elementary intervals; note that
+	// boundaries are compared exactly, as for the checks of adjacent blocks
+	std::sort(this->skyline_coords.begin(), this->skyline_coords.end());
+	this->skyline_coords.erase(std::unique(this->skyline_coords.begin(), this->skyline_coords.end()), this->skyline_coords.end());
+
+	// segment tree over elementary intervals, w/ root at index 1; init w/ zero
+	// front, i.e., the left (bottom) die boundary
+	nodes = 4 * std::max(static_cast<unsigned>(this->skyline_coords.size()), 1u);
+	this->skyline_max.assign(nodes, 0.0);
+	this->skyline_tag.assign(nodes, 0.0);
+}
+
+void CorblivarDie::updateSkyline(unsigned const& node, unsigned const& node_lower, unsigned const& node_upper, unsigned const& lower, unsigned const& upper, double const& front) {
+	unsigned middle;
+
+	// node's range and update range are disjunct
+	if (upper <= node_lower || node_upper <= lower) {
+		return;
+	}
+
+	// node's range fully covered; memorize front as tag, applying to all
+	// intervals of the node, w/o updating the children
+	if (lower <= node_lower && node_upper <= upper) {
+		this->skyline_max[node] = std::max(this->skyline_max[node], front);
+		this->skyline_tag[node] = std::max(this->skyline_tag[node], front);
+		return;
+	}
+
+	// node's range partially covered; update children
+	middle = (node_lower + node_upper) / 2;
+	this->updateSkyline(2 * node, node_lower, middle, lower, upper, front);
+	this->updateSkyline(2 * node + 1, middle, node_upper, lower, upper, front);
+
+	this->skyline_max[node] = std::max(this->skyline_max[node], std::max(this->skyline_max[2 * node], this->skyline_max[2 * node + 1]));
+}
+
+double CorblivarDie::querySkyline(unsigned const& node, unsigned const& node_lower, unsigned const& node_upper, unsigned const& lower, unsigned const& upper) const {
+	unsigned middle;
+
+	// node's range and query range are disjunct
+	if (upper <= node_lower || node_upper <= lower) {
+		return 0.0;
+	}
+
+	// node's range fully covered
+	if (lower <= node_lower && node_upper <= upper) {
+		return this->skyline_max[node];
+	}
+
+	// node's range partially covered; the node's tag applies to the queried
+	// intervals as well
+	middle = (node_lower + node_upper) / 2;
+	return std::max(this->skyline_tag[node], std::max(
+			this->querySkyline(2 * node, node_lower, middle, lower, upper),
+			this->querySkyline(2 * node + 1, middle, node_upper, lower, upper)
+		));
+}
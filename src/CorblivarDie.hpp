@@ -29,6 +29,8 @@
 // Corblivar includes, if any
 #include "CornerBlockList.hpp"
 #include "Coordinate.hpp"
+#include "Direction.hpp"
+#include "PlacementStack.hpp"
 // forward declarations, if any
 class Block;
 class CorblivarAlignmentReq;
@@ -50,8 +52,64 @@ class CorblivarDie {
 		/// progress pointer, CBL vector index
 		unsigned pi;
 
-		/// placement stacks; for efficiency implemented as list
-		std::list<Block const*> Hi, Vi;
+		/// placement stacks; for efficiency implemented as contiguous,
+		/// preallocated buffers, see reserve()
+		PlacementStack Hi, Vi;
+		/// placement stacks; backup buffer, used while rebuilding stacks
+		PlacementStack stack_backup;
+		/// relevant blocks popped from placement stacks for current block;
+		/// scratch buffer, preallocated, see reserve()
+		std::vector<Block const*> relev_blocks;
+
+		/// index of placed blocks, for the extended checks during layout
+		/// generation w/ alignment; placed blocks sorted by their lower-left x-
+		/// and y-coordinates, respectively; a block is indexed once it's placed
+		/// since its coordinates remain unchanged afterwards (until packing, after
+		/// layout generation); preallocated, see reserve()
+		std::vector<Block const*> placed_by_x, placed_by_y;
+		/// index of placed blocks; maximal width and height of indexed blocks,
+		/// bounding the range of the index to be checked
+		double placed_max_w, placed_max_h;
+		/// index of placed blocks; count of tuples covered, i.e., the placed
+		/// blocks S[0..placed_indexed-1] are indexed
+		unsigned placed_indexed;
+
+		/// packing; blocks sorted for sweep, scratch buffer, preallocated
+		std::vector<Block const*> packing_blocks;
+		/// packing; skyline over the blocks' front, i.e., the maximal
+		/// coordinates of the blocks swept so far, for the elementary intervals
+		/// defined by the (sorted, unique) blocks' boundaries orthogonal to the
+		/// packing direction; implemented as max-segment tree w/ tags for
+		/// full-node updates
+		std::vector<double> skyline_coords, skyline_max, skyline_tag;
+
+		/// undo log for placement stacks, memorized during layout generation
+		/// w/o alignment; for each placed tuple, the direction and the stacks'
+		/// sizes right after placement, and the range of blocks popped from the
+		/// stacks (see checkpoints_popped); enables partial regeneration, by
+		/// rolling back the stacks from their final state to the state before
+		/// the first modified tuple
+		///
+		/// note that placement of a tuple only pops blocks from the top of one
+		/// stack and then pushes blocks onto the top of both stacks, thus the
+		/// popped blocks and the stacks' sizes are sufficient to roll back
+		struct StackDelta {
+			bool horizontal;
+			unsigned Hi_size, Vi_size;
+			unsigned popped_begin, popped_end;
+		};
+		/// undo log for placement stacks; deltas of placed tuples, in order
+		std::vector<StackDelta> checkpoints;
+		/// undo log for placement stacks; blocks popped for all placed tuples,
+		/// in order of tuples and of popping
+		std::vector<Block const*> checkpoints_popped;
+		/// checkpointed placement of each tuple's block, memorized right after
+		/// the block's placement, i.e., before any packing
+		std::vector<Rect> checkpoints_bb;
+
+		/// first tuple to be (re-)placed during next layout generation; all
+		/// previous tuples and their checkpoints remain valid
+		unsigned regen_tuple;
 
 		/// main CBL sequence
 		CornerBlockList CBL;
@@ -72,12 +130,143 @@ class CorblivarDie {
 			this->Hi.clear();
 			this->Vi.clear();
 
+			// reset index of placed blocks
+			this->resetPlacedIndex();
+
+			// reset undo log for placement stacks
+			this->checkpoints.clear();
+			this->checkpoints_popped.clear();
+
 			// reset placed flags
 			for (Block const* b : this->CBL.S) {
 				b->placed = false;
 			}
 		};
 
+		/// partial reset handler; restores the checkpointed state right before
+		/// the first modified tuple, from which layout generation is resumed
+		inline void resume() {
+			unsigned t;
+
+			// sanity check for checkpoints not covering the modified tuple;
+			// fall back to full reset
+			if (this->regen_tuple == 0 || this->regen_tuple > this->checkpoints.size()) {
+				this->reset();
+				return;
+			}
+
+			// restore placement of unmodified blocks; required since their
+			// bbs may have been altered by packing after the previous layout
+			// generation
+			for (t = 0; t < this->regen_tuple; t++) {
+				this->CBL.S[t]->bb = this->checkpoints_bb[t];
+				this->CBL.S[t]->placed = true;
+			}
+			// reset placed flags for blocks to be placed
+			for (; t < this->CBL.size(); t++) {
+				this->CBL.S[t]->placed = false;
+			}
+
+			// reset index of placed blocks; the restored blocks are indexed
+			// on demand
+			this->resetPlacedIndex();
+
+			// restore placement stacks; roll back the stacks' updates of all
+			// tuples to be placed again, in reverse order
+			for (t = this->checkpoints.size(); t > this->regen_tuple; t--) {
+				this->rollbackCheckpoint(t - 1);
+			}
+			this->checkpoints_popped.resize(this->checkpoints[this->regen_tuple - 1].popped_end);
+			this->checkpoints.resize(this->regen_tuple);
+
+			// all tuples unmodified; nothing to place, retain progress pointer
+			// as after complete layout generation
+			if (this->regen_tuple >= this->CBL.size()) {
+				this->pi = this->CBL.empty() ? 0 : this->CBL.size() - 1;
+				this->done = true;
+			}
+			// resume from first modified tuple
+			else {
+				this->pi = this->regen_tuple;
+				this->done = false;
+			}
+		};
+
+		/// checkpoint handler; to be called right after placement of the
+		/// current block, memorizes the stacks' update for the current tuple,
+		/// i.e., the blocks popped from the stacks, still given in relev_blocks
+		inline void storeCheckpoint() {
+			StackDelta delta;
+
+			// allocate checkpoints for all tuples; memory is retained across
+			// layout generations
+			if (this->checkpoints_bb.size() != this->CBL.size()) {
+				this->checkpoints_bb.resize(this->CBL.size());
+			}
+
+			this->checkpoints_bb[this->pi] = this->CBL.S[this->pi]->bb;
+
+			delta.horizontal = (this->getCurrentDirection() == Direction::HORIZONTAL);
+			delta.Hi_size = this->Hi.size();
+			delta.Vi_size = this->Vi.size();
+			delta.popped_begin = this->checkpoints_popped.size();
+			this->checkpoints_popped.insert(this->checkpoints_popped.end(), this->relev_blocks.begin(), this->relev_blocks.end());
+			delta.popped_end = this->checkpoints_popped.size();
+
+			this->checkpoints.push_back(delta);
+		};
+		/// checkpoint handler; rolls back the stacks' update for given tuple,
+		/// i.e., restores the stacks as they were before the tuple was placed;
+		/// to be applied in reverse order of tuples
+		inline void rollbackCheckpoint(unsigned const& tuple) {
+			StackDelta const& delta = this->checkpoints[tuple];
+			unsigned Hi_prev_size, Vi_prev_size;
+			unsigned popped = delta.popped_end - delta.popped_begin;
+			unsigned i;
+
+			// stacks' sizes before placement of the tuple
+			if (tuple == 0) {
+				Hi_prev_size = Vi_prev_size = 0;
+			}
+			else {
+				Hi_prev_size = this->checkpoints[tuple - 1].Hi_size;
+				Vi_prev_size = this->checkpoints[tuple - 1].Vi_size;
+			}
+
+			// drop the blocks pushed during placement; for the stack the
+			// blocks were popped from, this equals the size difference plus
+			// the count of popped blocks
+			for (i = delta.Hi_size + (delta.horizontal ? popped : 0); i > Hi_prev_size; i--) {
+				this->Hi.pop_front();
+			}
+			for (i = delta.Vi_size + (delta.horizontal ? 0 : popped); i > Vi_prev_size; i--) {
+				this->Vi.pop_front();
+			}
+
+			// push back the popped blocks, in reverse order of popping
+			for (i = delta.popped_end; i > delta.popped_begin; i--) {
+
+				if (delta.horizontal) {
+					this->Hi.push_front(this->checkpoints_popped[i - 1]);
+				}
+				else {
+					this->Vi.push_front(this->checkpoints_popped[i - 1]);
+				}
+			}
+		};
+
+		/// handler for index of placed blocks
+		inline void resetPlacedIndex() {
+			this->placed_by_x.clear();
+			this->placed_by_y.clear();
+			this->placed_max_w = this->placed_max_h = 0.0;
+			this->placed_indexed = 0;
+		};
+		/// handler for index of placed blocks; adds all blocks placed since
+		/// the last update, i.e., the placed blocks following the already
+		/// indexed ones (blocks are placed in order of their tuples)
+		void updatePlacedIndex();
+
 		/// handler for progress pointer, flag
 		inline void updateProgressPointerFlag() {
 			if (this->pi == (this->CBL.size() - 1)) {
@@ -94,17 +283,32 @@ class CorblivarDie {
 		bool shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq const* req, bool const& dry_run = false);
 
 		/// layout-generation helper: determine coordinates of block in process
-		void determCurrentBlockCoords(Coordinate const& coord, std::list<Block const*> const& relev_blocks_stack, bool const& extended_check = false) const;
+		void determCurrentBlockCoords(Coordinate const& coord, std::vector<Block const*> const& relev_blocks_stack, bool const& extended_check = false);
 		/// layout-generation helper: pop relevant blocks to consider during
 		/// placement from stacks
-		std::list<Block const*> popRelevantBlocks();
+		/// note that relev_blocks_stack is return-by-reference; the buffer is
+		/// reset beforehand, its memory is retained
+		void popRelevantBlocks(std::vector<Block const*>& relev_blocks_stack);
 		/// layout-generation helper: update placement stack (after placement)
-		void updatePlacementStacks(std::list<Block const*>& relev_blocks_stack);
+		void updatePlacementStacks(std::vector<Block const*> const& relev_blocks_stack);
 		/// layout-generation helper: rebuild placement stack (after block shifting)
-		void rebuildPlacementStacks(std::list<Block const*>& relev_blocks_stack);
+		void rebuildPlacementStacks(std::vector<Block const*> const& relev_blocks_stack);
 		/// layout-generation helper: placement stacks debugging
 		void debugStacks();
 
+		/// packing helper: init skyline for given boundaries of blocks
+		void initSkyline(Coordinate const& coord);
+		/// packing helper: elementary-interval index for given boundary
+		inline unsigned skylineIndex(double const& boundary) const {
+			return std::lower_bound(this->skyline_coords.begin(), this->skyline_coords.end(), boundary) - this->skyline_coords.begin();
+		};
+		/// packing helper: raise skyline to (at least) given front for
+		/// elementary intervals [lower, upper)
+		void updateSkyline(unsigned const& node, unsigned const& node_lower, unsigned const& node_upper, unsigned const& lower, unsigned const& upper, double const& front);
+		/// packing helper: maximal front of skyline for elementary intervals
+		/// [lower, upper)
+		double querySkyline(unsigned const& node, unsigned const& node_lower, unsigned const& node_upper, unsigned const& lower, unsigned const& upper) const;
+
 	// constructors, destructors, if any non-implicit
 	public:
 		/// default constructor
@@ -112,17 +316,43 @@ class CorblivarDie {
 			this->stalled = false;
 			this->done = false;
 			this->id = id;
+			this->regen_tuple = 0;
+			this->resetPlacedIndex();
 		}
 
+		/// allocate memory for placement stacks and related buffers; for worst
+		/// case, i.e., all blocks in this die
+		inline void reserve(unsigned const& blocks) {
+			this->Hi.reserve(blocks);
+			this->Vi.reserve(blocks);
+			this->stack_backup.reserve(blocks);
+			this->relev_blocks.reserve(blocks);
+			this->placed_by_x.reserve(blocks);
+			this->placed_by_y.reserve(blocks);
+			this->packing_blocks.reserve(blocks);
+			this->checkpoints.reserve(blocks);
+			this->checkpoints_popped.reserve(2 * blocks);
+			this->skyline_coords.reserve(2 * blocks);
+			this->skyline_max.reserve(8 * blocks);
+			this->skyline_tag.reserve(8 * blocks);
+		};
+
 	// public data, functions
 	public:
 		friend class CorblivarCore;
 
-		/// setter
+		/// setter; marks CBL as modified from the first tuple onwards
 		inline CornerBlockList& editCBL() {
+			this->invalidatePlacement();
 			return this->CBL;
 		};
 
+		/// layout-generation handler; marks the placement starting from the
+		/// given tuple as invalid, to be regenerated during next layout generation
+		inline void invalidatePlacement(unsigned const& tuple = 0) {
+			this->regen_tuple = std::min(this->regen_tuple, tuple);
+		};
+
 		/// getter
 		inline CornerBlockList const& getCBL() const {
 			return this->CBL;
@@ -45,7 +45,7 @@ constexpr double TSV_Island::AR_MIN;
 constexpr double TSV_Island::AR_MAX;
 
 /// main handler
-bool FloorPlanner::performSA(CorblivarCore& corb) {
+bool FloorPlanner::performSA(CorblivarCore& corb, PTHandler* PT, unsigned const& replica) {
 	int i, ii;
 	int innerLoopMax;
 	int accepted_ops;
@@ -65,9 +65,10 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	bool SA_phase_two, SA_phase_two_init;
 	bool valid_layout;
 	TempPhase cooling_phase;
+	unsigned thermal_level;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
-		std::cout << "-> FloorPlanner::performSA(" << &corb << ")" << std::endl;
+		std::cout << "-> FloorPlanner::performSA(" << &corb << ", " << PT << ", " << replica << ")" << std::endl;
 	}
 
 	// for handling floorplacement benchmarks, i.e., floorplanning w/ very large
@@ -81,7 +82,29 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	}
 
 	// init SA: initial sampling; setup parameters, setup temperature schedule
-	this->initSA(corb, cost_samples, innerLoopMax, init_temp);
+	if (PT == nullptr) {
+		this->initSA(corb, cost_samples, innerLoopMax, init_temp);
+	}
+	// parallel tempering: the initial sampling is performed once by the master
+	// instance, see performParallelTemperingSA; the initial temperatures of all
+	// replicas are staggered geometrically from the master's initial temperature,
+	// which the master replica (id 0) retains
+	else {
+		this->initSA(corb, cost_samples, innerLoopMax, init_temp, false);
+
+		cost_samples = PT->cost_samples;
+		init_temp = PT->init_temp;
+
+		if (this->schedule.PT_replicas > 1) {
+			init_temp *= std::pow(FloorPlanner::SA_PT_TEMP_STAGGER_MAX, static_cast<double>(replica) / (this->schedule.PT_replicas - 1));
+		}
+	}
+
+	// multi-resolution thermal analysis; start w/ thermal maps for cooling phase 1
+	thermal_level = 0;
+	if (this->opt_flags.thermal) {
+		this->applyThermalSchedule(thermal_level, false);
+	}
 
 	/// main SA loop
 	//
@@ -113,63 +136,100 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 
 		// init cost for current layout and fitting ratio
 		this->generateLayout(corb, this->opt_flags.alignment && SA_phase_two);
+
+		// multi-resolution thermal analysis; apply refined thermal maps, if
+		// triggered during previous temperature update; the max thermal cost
+		// is re-normalized on the current layout, only required once
+		// initialized in SA phase two
+		//
+		// note that for parallel tempering, the thermal schedule is shared by
+		// all replicas and applied during synchronization, see exchangeReplicas
+		if (this->opt_flags.thermal && thermal_level != this->thermal_schedule.level) {
+			this->max_cost_thermal *= this->applyThermalSchedule(thermal_level, SA_phase_two);
+		}
+
+		// 3D thermal analysis for late SA phases; applied once the configured SA
+		// progress is reached, and only in SA phase two, where the thermal cost
+		// is normalized already
+		if (PT == nullptr && this->opt_flags.thermal && this->thermalSolver.parameters.SA && !this->thermal_schedule.solver && SA_phase_two &&
+				i >= this->thermalSolver.parameters.SA_progress * this->schedule.loop_limit) {
+			this->max_cost_thermal *= this->applyThermalSolver();
+		}
+
 		cur_cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two).total_cost;
 
 		// inner loop: layout operations
 		while (ii <= innerLoopMax) {
 
-			// perform layout op
-			op_success = layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, false, (cooling_phase == TempPhase::PHASE_3));
+			// perform batch of layout ops, if configured
+			if (!this->batch.fp.empty()) {
+				op_success = this->performLayoutOpsBatch(corb, layout_fit_counter, SA_phase_two, (cooling_phase == TempPhase::PHASE_3),
+						fitting_layouts_ratio, cur_temp, cur_cost, cost, accept);
+			}
+			// perform regular, single layout op
+			else {
+				op_success = layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, false, (cooling_phase == TempPhase::PHASE_3));
+			}
 
 			if (op_success) {
 
 				prev_cost = cur_cost;
 
-				// generate layout; also memorize whether layout is valid;
-				// note that this return value is only effective if
-				// FloorPlanner::DBG_LAYOUT is set
-				valid_layout = this->generateLayout(corb, this->opt_flags.alignment && SA_phase_two);
+				// batched ops have been evaluated already; only the cost for
+				// the accepted candidate is to be memorized
+				if (!this->batch.fp.empty()) {
 
-				// dbg invalid layouts
-				if (FloorPlanner::DBG_LAYOUT && !valid_layout) {
-
-					// generate invalid floorplan for dbg
-					IO::writeFloorplanGP(*this, corb.getAlignments(), "invalid_layout");
-					// generate related Corblivar solution
-					if (this->IO_conf.solution_out.is_open()) {
-						this->IO_conf.solution_out << corb.CBLsString() << std::endl;
-						this->IO_conf.solution_out.close();
+					if (accept) {
+						cur_cost = cost.total_cost;
 					}
-					// abort further run
-					exit(1);
 				}
+				else {
+					// generate layout; also memorize whether layout is valid;
+					// note that this return value is only effective if
+					// FloorPlanner::DBG_LAYOUT is set
+					valid_layout = this->generateLayout(corb, this->opt_flags.alignment && SA_phase_two);
+
+					// dbg invalid layouts
+					if (FloorPlanner::DBG_LAYOUT && !valid_layout) {
+
+						// generate invalid floorplan for dbg
+						IO::writeFloorplanGP(*this, corb.getAlignments(), "invalid_layout");
+						// generate related Corblivar solution
+						if (this->IO_conf.solution_out.is_open()) {
+							this->IO_conf.solution_out << corb.CBLsString() << std::endl;
+							this->IO_conf.solution_out.close();
+						}
+						// abort further run
+						exit(1);
+					}
 
-				// evaluate layout, new cost
-				cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two);
-				cur_cost = cost.total_cost;
-				// cost difference
-				cost_diff = cur_cost - prev_cost;
+					// evaluate layout, new cost
+					cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two);
+					cur_cost = cost.total_cost;
+					// cost difference
+					cost_diff = cur_cost - prev_cost;
 
-				if (FloorPlanner::DBG_SA) {
-					std::cout << "DBG_SA> Inner step: " << ii << "/" << innerLoopMax << std::endl;
-					std::cout << "DBG_SA> Cost diff: " << cost_diff << std::endl;
-				}
+					if (FloorPlanner::DBG_SA) {
+						std::cout << "DBG_SA> Inner step: " << ii << "/" << innerLoopMax << std::endl;
+						std::cout << "DBG_SA> Cost diff: " << cost_diff << std::endl;
+					}
 
-				// revert solution w/ worse or same cost, depending on temperature
-				accept = true;
-				if (cost_diff >= 0.0) {
-					r = Math::randF(0, 1);
-					if (r > exp(- cost_diff / cur_temp)) {
+					// revert solution w/ worse or same cost, depending on temperature
+					accept = true;
+					if (cost_diff >= 0.0) {
+						r = Math::randF(0, 1);
+						if (r > exp(- cost_diff / cur_temp)) {
 
-						if (FloorPlanner::DBG_SA) {
-							std::cout << "DBG_SA> Revert op" << std::endl;
-						}
-						accept = false;
+							if (FloorPlanner::DBG_SA) {
+								std::cout << "DBG_SA> Revert op" << std::endl;
+							}
+							accept = false;
 
-						// revert last op
-						layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, true);
-						// reset cost according to reverted CBL
-						cur_cost = prev_cost;
+							// revert last op
+							layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, true);
+							// reset cost according to reverted CBL
+							cur_cost = prev_cost;
+						}
 					}
 				}
 
@@ -177,6 +237,12 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 				if (accept) {
 					// update ops count
 					accepted_ops++;
+					// 3D thermal analysis; only performed for accepted
+					// layouts, the estimated thermal cost is replaced
+					if (this->thermal_schedule.solver) {
+						this->acceptThermalSolver(cost);
+						cur_cost = cost.total_cost;
+					}
 					// sum up cost for subsequent avg determination
 					avg_cost += cur_cost;
 
@@ -223,8 +289,22 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 								// and for effective comparison of further
 								// fitting solutions; also initialize all
 								// max cost terms
-								fitting_cost =
-									this->evaluateLayout(corb.getAlignments(), 1.0, true, true).total_cost;
+								//
+								// for parallel tempering, adopt the max
+								// cost terms shared by all replicas
+								// instead, if available already
+								if (PT != nullptr && PT->reference != nullptr) {
+
+									this->adoptMaxCost(*PT->reference);
+									PT->normalized[replica] = true;
+
+									fitting_cost =
+										this->evaluateLayout(corb.getAlignments(), 1.0, true).total_cost;
+								}
+								else {
+									fitting_cost =
+										this->evaluateLayout(corb.getAlignments(), 1.0, true, true).total_cost;
+								}
 
 								// also memorize in which iteration we
 								// found the first valid layout
@@ -322,7 +402,11 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 				if (SA_phase_two_init) {
 					break;
 				}
-				// consider next loop iteration
+				// consider next loop iteration; a batch accounts for all its
+				// candidate ops
+				else if (!this->batch.fp.empty()) {
+					ii += this->batch.fp.size();
+				}
 				else {
 					ii++;
 				}
@@ -446,15 +530,42 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		cur_step.avg_cost = avg_cost;
 		cur_step.new_best_sol_found = best_sol_found;
 		cur_step.cost_best_sol = best_cost;
+		cur_step.thermal_map_dim = this->thermalAnalyzer.dims.thermal_map;
 		this->tempSchedule.push_back(std::move(cur_step));
 
 		// update SA temperature
 		cooling_phase = this->updateTemp(cur_temp, i, i_valid_layout_found);
 
+		// multi-resolution thermal analysis; refine thermal maps along w/ the
+		// cooling phases; note that maps are only refined, i.e., not coarsened
+		// again for reheating in subsequent phases
+		thermal_level = std::max(thermal_level, static_cast<unsigned>(cooling_phase) - 1);
+
+		// parallel tempering: synchronize w/ other replicas and exchange
+		// temperatures, if applicable; also request 3D thermal analysis for the
+		// next step, see above
+		if (PT != nullptr) {
+			this->exchangeReplicas(*PT, replica, corb, fitting_layouts_ratio, SA_phase_two,
+					(this->opt_flags.thermal && this->thermalSolver.parameters.SA && SA_phase_two &&
+					 i + 1 >= this->thermalSolver.parameters.SA_progress * this->schedule.loop_limit),
+					thermal_level, cur_cost, best_cost, cur_temp);
+		}
+
 		// consider next outer step
 		i++;
 	}
 
+	if (this->logMed() && !this->batch.fp.empty()) {
+		std::cout << "SA> Batched evaluation; candidates accepted: " << this->batch.accepted << "/" << this->batch.batches << " batches" << std::endl;
+	}
+
+	// multi-resolution thermal analysis; restore regular thermal maps and power
+	// blurring, as required for finalization
+	this->thermal_schedule.solver = false;
+	if (this->opt_flags.thermal) {
+		this->applyThermalSchedule(2, false);
+	}
+
 	if (this->logMed()) {
 		std::cout << "SA> Done" << std::endl;
 		std::cout << std::endl;
@@ -467,6 +578,356 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	return valid_layout_found;
 }
 
+bool FloorPlanner::performParallelTemperingSA(CorblivarCore& corb, int const& argc, char** argv) {
+	unsigned r;
+	std::vector<std::unique_ptr<FloorPlanner>> replicas_fp;
+	std::vector<std::unique_ptr<CorblivarCore>> replicas_corb;
+	std::vector<std::thread> threads;
+	std::vector<char> replicas_done;
+	bool done;
+	int best_replica;
+	double best_cost;
+	int innerLoopMax;
+	Cost cost;
+	unsigned replicas = static_cast<unsigned>(this->schedule.PT_replicas);
+	PTHandler PT(replicas);
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::performParallelTemperingSA(" << &corb << ", " << argc << ", " << argv << ")" << std::endl;
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Parallel tempering; init " << replicas - 1 << " further replicas ..." << std::endl;
+	}
+
+	// init replicas; each replica is a separate instance w/ separate blocks, nets,
+	// etc., thus all layout-related data is private to each replica
+	//
+	// note that the master instance, i.e., this instance, is considered as
+	// replica 0
+	for (r = 1; r < replicas; r++) {
+
+		replicas_fp.emplace_back(new FloorPlanner());
+		replicas_corb.emplace_back();
+		FloorPlanner::initReplica(*replicas_fp.back(), replicas_corb.back(), argc, argv);
+
+		FloorPlanner& fp = *replicas_fp.back();
+		CorblivarCore& corb_replica = *replicas_corb.back();
+
+		// separate random data set for each replica
+		corb_replica.initCorblivarRandomly(false, fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+
+		// each replica evaluates its own batches, if configured
+		fp.initBatchEvaluation(argc, argv);
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Done" << std::endl;
+		std::cout << "SA> " << std::endl;
+	}
+
+	// initial sampling, performed once by this instance; the resulting initial
+	// temperature is the base for all replicas' temperatures, see performSA
+	this->initSA(corb, PT.cost_samples, innerLoopMax, PT.init_temp);
+
+	PT.instances[0] = this;
+	for (r = 1; r < replicas; r++) {
+		PT.instances[r] = replicas_fp[r - 1].get();
+	}
+
+	// perform SA for all replicas concurrently; replica 0 (this instance) runs in
+	// the calling thread
+	//
+	// note that std::vector<bool> is not applicable for concurrent writes
+	replicas_done.resize(replicas, false);
+	for (r = 1; r < replicas; r++) {
+		threads.emplace_back(
+				[&replicas_fp, &replicas_corb, &replicas_done, &PT, r]() {
+					// separate random-number stream for each replica
+					Math::rng().seed(Math::randSeed(), r);
+
+					replicas_done[r] = replicas_fp[r - 1]->performSA(*replicas_corb[r - 1], &PT, r);
+				}
+			);
+	}
+	replicas_done[0] = this->performSA(corb, &PT, 0);
+
+	for (std::thread& t : threads) {
+		t.join();
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Parallel tempering; replica exchanges accepted: " << PT.exchanges_accepted << "/" << PT.exchanges_attempted << std::endl;
+		std::cout << "SA> Parallel tempering; determine best solution across all replicas ..." << std::endl;
+	}
+
+	// determine best solution across all replicas; the solutions have to be
+	// re-evaluated by this instance since the replicas' die outlines may differ,
+	// i.e., when shrunk independently, and since the final thermal analysis
+	// differs from the thermal schedule during SA
+	//
+	// note that only solutions fitting into the (possibly shrunk) outline of this
+	// instance are considered
+	best_replica = -1;
+	best_cost = 0.0;
+	for (r = 0; r < replicas; r++) {
+
+		if (!replicas_done[r]) {
+			continue;
+		}
+
+		// apply best solution of replica; the best solution of this instance
+		// is memorized as backup since it's overwritten by adopting other
+		// replicas' solutions
+		if (r == 0) {
+			corb.applyBestCBLs(false);
+			corb.backupCBLs();
+		}
+		else {
+			corb.adoptBestCBLs(*replicas_corb[r - 1], this->blocks);
+			corb.applyBestCBLs(false);
+		}
+		this->generateLayout(corb, this->opt_flags.alignment);
+
+		// evaluate solution; the max cost terms are initialized w/ the first
+		// solution, for comparability of further solutions
+		cost = this->evaluateLayout(corb.getAlignments(), 1.0, true, (best_replica == -1));
+
+		if (this->logMed()) {
+			std::cout << "SA>  Replica " << r << "; cost: " << cost.total_cost << ", fits outline: " << cost.fits_fixed_outline << std::endl;
+		}
+
+		if (cost.fits_fixed_outline && (best_replica == -1 || cost.total_cost < best_cost)) {
+			best_cost = cost.total_cost;
+			best_replica = r;
+		}
+	}
+
+	// finally memorize best solution across all replicas
+	if (best_replica == 0) {
+		corb.restoreCBLs();
+		corb.storeBestCBLs();
+	}
+	else if (best_replica > 0) {
+		corb.adoptBestCBLs(*replicas_corb[best_replica - 1], this->blocks);
+	}
+	done = (best_replica != -1);
+
+	if (this->logMed()) {
+		std::cout << "SA>  Best solution from replica: " << best_replica << std::endl;
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Done" << std::endl;
+		std::cout << std::endl;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::performParallelTemperingSA : " << done << std::endl;
+	}
+
+	return done;
+}
+
+void FloorPlanner::synchronizeReplicas(PTHandler& PT, std::function<void()> const& handler) {
+	std::unique_lock<std::mutex> lock(PT.mutex);
+	unsigned generation;
+
+	generation = PT.generation;
+	PT.arrived++;
+
+	// last replica to arrive performs the handler, all others wait for it
+	if (PT.arrived == PT.instances.size()) {
+
+		handler();
+
+		// release other replicas
+		PT.arrived = 0;
+		PT.generation++;
+		PT.barrier.notify_all();
+	}
+	else {
+		PT.barrier.wait(lock, [&PT, &generation]() {
+				return PT.generation != generation;
+			});
+	}
+}
+
+void FloorPlanner::exchangeReplicas(PTHandler& PT, unsigned const& replica, CorblivarCore& corb, double const& fitting_layouts_ratio, bool const& SA_phase_two,
+		bool const& thermal_solver, unsigned& thermal_level, double& cur_cost, double& best_cost, double& cur_temp) {
+	bool renormalize;
+	double ratio;
+
+	// memorize state of this replica
+	PT.SA_phase_two[replica] = SA_phase_two;
+	PT.thermal_level[replica] = thermal_level;
+	PT.thermal_solver[replica] = thermal_solver;
+
+	// first synchronization: determine the shared cost normalization and the shared
+	// thermal schedule
+	FloorPlanner::synchronizeReplicas(PT, [&PT]() {
+			unsigned r;
+
+			// the first replica to reach SA phase two serves as reference for
+			// the cost normalization; for multiple such replicas, the one w/
+			// lowest id
+			if (PT.reference == nullptr) {
+				for (r = 0; r < PT.instances.size(); r++) {
+					if (PT.SA_phase_two[r]) {
+						PT.reference = PT.instances[r];
+						PT.normalized[r] = true;
+						break;
+					}
+				}
+			}
+
+			// thermal schedule is shared: all replicas apply the most refined
+			// thermal maps requested by any replica, and 3D thermal analysis as
+			// soon as requested by any replica
+			for (r = 0; r < PT.instances.size(); r++) {
+				PT.thermal_level_shared = std::max(PT.thermal_level_shared, PT.thermal_level[r]);
+				PT.thermal_solver_shared = PT.thermal_solver_shared || PT.thermal_solver[r];
+			}
+		});
+
+	// replicas which have reached SA phase two independently from the reference
+	// replica adopt the shared normalization; the cost of their best solution is
+	// re-determined accordingly
+	if (SA_phase_two && !PT.normalized[replica]) {
+
+		this->adoptMaxCost(*PT.reference);
+		PT.normalized[replica] = true;
+
+		corb.backupCBLs();
+		corb.applyBestCBLs(false);
+		this->generateLayout(corb, this->opt_flags.alignment);
+		best_cost = this->evaluateLayout(corb.getAlignments(), 1.0, true).total_cost;
+		corb.restoreCBLs();
+	}
+
+	// current layout, for the thermal schedule and the cost below
+	this->generateLayout(corb, this->opt_flags.alignment && SA_phase_two);
+
+	// apply shared thermal schedule; the ratios of thermal cost w/ the new and the
+	// previous thermal analysis are determined by all normalized replicas, for
+	// re-normalization of the shared max thermal cost
+	//
+	// note that the thermal schedule is applied for all replicas, also those in
+	// SA phase one, such that they adopt the shared normalization consistently once
+	// they reach SA phase two
+	PT.thermal_ratio[replica] = 0.0;
+
+	if (this->opt_flags.thermal) {
+
+		renormalize = SA_phase_two && PT.normalized[replica];
+		ratio = 1.0;
+
+		if (this->thermal_schedule.level != PT.thermal_level_shared) {
+			ratio *= this->applyThermalSchedule(PT.thermal_level_shared, renormalize);
+		}
+		if (PT.thermal_solver_shared && !this->thermal_schedule.solver) {
+
+			// note that thermal cost is to be re-determined for the ratio
+			// w/ power blurring, if not provided by applyThermalSchedule
+			if (renormalize) {
+				ratio *= this->applyThermalSolver();
+			}
+			else {
+				this->applyThermalSolver();
+			}
+		}
+
+		if (renormalize && ratio != 1.0) {
+			PT.thermal_ratio[replica] = ratio;
+		}
+
+		thermal_level = this->thermal_schedule.level;
+	}
+
+	// second synchronization: re-normalize the shared max thermal cost by the
+	// geometric mean of the replicas' ratios
+	FloorPlanner::synchronizeReplicas(PT, [&PT]() {
+			unsigned r;
+			unsigned count = 0;
+			double log_ratio = 0.0;
+
+			for (r = 0; r < PT.instances.size(); r++) {
+				if (PT.thermal_ratio[r] > 0.0) {
+					log_ratio += std::log(PT.thermal_ratio[r]);
+					count++;
+				}
+			}
+
+			if (count > 0) {
+				PT.reference->max_cost_thermal *= std::exp(log_ratio / count);
+			}
+		});
+
+	// adopt (possibly re-normalized) shared normalization, and re-determine cost of
+	// current layout accordingly; also required for replicas which have just
+	// reached SA phase two, for which the cost of the current layout is still
+	// related to SA phase one
+	if (SA_phase_two) {
+
+		if (PT.reference != this) {
+			this->adoptMaxCost(*PT.reference);
+		}
+
+		cur_cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, true).total_cost;
+	}
+
+	PT.cost[replica] = cur_cost;
+	PT.temp[replica] = cur_temp;
+
+	// third synchronization: replica exchange
+	FloorPlanner::synchronizeReplicas(PT, [&PT]() {
+			std::vector<unsigned> order;
+			unsigned i, j, k;
+			double delta;
+
+			// order replicas by temperature
+			for (i = 0; i < PT.instances.size(); i++) {
+				order.push_back(i);
+			}
+			std::sort(order.begin(), order.end(),
+					[&PT](unsigned const& r1, unsigned const& r2) {
+						return PT.temp[r1] < PT.temp[r2];
+					}
+				);
+
+			// try to exchange neighbouring pairs; alternate between even and
+			// odd pairs w/ each round
+			for (k = PT.rounds % 2; k + 1 < order.size(); k += 2) {
+
+				i = order[k];
+				j = order[k + 1];
+
+				// exchange only replicas which are in same SA phase, otherwise
+				// the cost are not comparable; also ignore frozen replicas
+				if (PT.SA_phase_two[i] != PT.SA_phase_two[j] || PT.temp[i] <= 0.0 || PT.temp[j] <= 0.0) {
+					continue;
+				}
+
+				PT.exchanges_attempted++;
+
+				// Metropolis criterion for exchange
+				delta = (1.0 / PT.temp[i] - 1.0 / PT.temp[j]) * (PT.cost[i] - PT.cost[j]);
+
+				if (delta >= 0.0 || PT.rng.nextF() < std::exp(delta)) {
+
+					std::swap(PT.temp[i], PT.temp[j]);
+
+					PT.exchanges_accepted++;
+				}
+			}
+
+			PT.rounds++;
+		});
+
+	// retrieve (possibly exchanged) temperature
+	cur_temp = PT.temp[replica];
+}
+
 FloorPlanner::TempPhase FloorPlanner::updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const {
 	float loop_factor;
 	double prev_temp;
@@ -524,17 +985,322 @@ FloorPlanner::TempPhase FloorPlanner::updateTemp(double& cur_temp, int const& it
 
 		cur_temp *= this->schedule.temp_factor_phase2 * loop_factor;
 
-		phase = TempPhase::PHASE_2;
+		phase = TempPhase::PHASE_2;
+	}
+
+	if (this->logMax()) {
+		std::cout << "SA>  (new) temp-update factor: " << cur_temp / prev_temp << " (phase " << phase << ")" << std::endl;
+	}
+
+	return phase;
+}
+
+FloorPlanner::~FloorPlanner() {
+}
+
+void FloorPlanner::initReplica(FloorPlanner& fp, std::unique_ptr<CorblivarCore>& corb, int const& argc, char** argv) {
+
+	// mark as replica, which is relevant for logging and files handling
+	fp.replica = true;
+
+	// same setup as for master instance, see main()
+	IO::parseParametersFiles(fp, argc, argv);
+	IO::parseBlocks(fp);
+	IO::parseNets(fp);
+	fp.initTimingPowerAnalyser();
+
+	corb.reset(new CorblivarCore(fp.getLayers(), fp.getBlocks().size()));
+
+	IO::parseAlignmentRequests(fp, corb->editAlignments());
+	fp.initThermalAnalyzer();
+	fp.initRoutingUtilAnalyzer();
+}
+
+void FloorPlanner::initBatchEvaluation(int const& argc, char** argv) {
+	int k;
+
+	if (this->schedule.batch_size <= 1) {
+		return;
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Batched evaluation; init " << this->schedule.batch_size << " workers ..." << std::endl;
+	}
+
+	// init workers; each worker is a separate instance w/ separate blocks, nets,
+	// etc., thus candidate layouts can be evaluated concurrently
+	for (k = 0; k < this->schedule.batch_size; k++) {
+
+		this->batch.fp.emplace_back(new FloorPlanner());
+		this->batch.corb.emplace_back();
+		FloorPlanner::initReplica(*this->batch.fp.back(), this->batch.corb.back(), argc, argv);
+	}
+
+	// init threads; the candidates are evaluated concurrently, one per thread
+	this->batch.threads.reset(new ThermalSolver::Workers(this->schedule.batch_size));
+
+	if (this->logMed()) {
+		std::cout << "SA> Done" << std::endl;
+		std::cout << "SA> " << std::endl;
+	}
+}
+
+void FloorPlanner::syncBatchWorker(FloorPlanner& worker) const {
+	unsigned p;
+	bool pins_scaled;
+
+	// die outline has changed, i.e., shrunk; reset the maps accordingly, see
+	// shrinkDieOutlines
+	if (worker.IC.outline_x != this->IC.outline_x || worker.IC.outline_y != this->IC.outline_y) {
+
+		worker.IC = this->IC;
+
+		worker.thermalAnalyzer.initPowerMaps(worker.IC.layers, worker.getOutline());
+		worker.routingUtil.initUtilMaps(worker.IC.layers, worker.getOutline());
+		worker.interconnects_cache.valid = false;
+	}
+	// otherwise, adopt other parameters, like the delay threshold, anyway
+	else {
+		worker.IC = this->IC;
+	}
+
+	// terminal pins are scaled along w/ the die outline, or along w/ the blocks'
+	// outline, see scaleTerminalPins
+	pins_scaled = false;
+	for (p = 0; p < this->terminals.size(); p++) {
+
+		if (worker.terminals[p].bb.ll.x != this->terminals[p].bb.ll.x || worker.terminals[p].bb.ll.y != this->terminals[p].bb.ll.y) {
+
+			worker.terminals[p].bb = this->terminals[p].bb;
+			pins_scaled = true;
+		}
+	}
+	if (pins_scaled) {
+		worker.interconnects_cache.valid = false;
+	}
+
+	// thermal-map dimensions, for multi-resolution thermal analysis
+	if (this->opt_flags.thermal && worker.thermal_schedule.level != this->thermal_schedule.level) {
+		worker.applyThermalSchedule(this->thermal_schedule.level, false);
+	}
+
+	// 3D thermal analysis for late SA phases; workers only estimate the thermal
+	// cost, the 3D thermal analysis is performed by this instance for accepted
+	// candidates
+	worker.thermal_schedule.solver = this->thermal_schedule.solver;
+	worker.thermal_schedule.solver_ratio_cost = this->thermal_schedule.solver_ratio_cost;
+	worker.thermal_schedule.solver_ratio_max_temp = this->thermal_schedule.solver_ratio_max_temp;
+
+	// max cost values, for same normalization of cost terms
+	worker.adoptMaxCost(*this);
+}
+
+bool FloorPlanner::performLayoutOpsBatch(CorblivarCore& corb, int const& layout_fit_counter, bool const& SA_phase_two, bool const& cooling_phase_three,
+		double const& fitting_layouts_ratio, double const& cur_temp, double const& cur_cost, Cost& cost, bool& accept) {
+	unsigned k;
+	int best;
+	double cost_diff;
+	std::vector<double> candidates_cost;
+	// note that std::vector<bool> is not applicable for concurrent writes
+	std::vector<char> candidates;
+	bool alignment = this->opt_flags.alignment && SA_phase_two;
+	unsigned workers = this->batch.fp.size();
+
+	candidates.resize(workers, false);
+	candidates_cost.resize(workers, 0.0);
+
+	// propose candidate ops; each op is performed on the current layout, handed
+	// over to one worker, and reverted again, thus all candidates are derived from
+	// the same layout
+	//
+	// note that the ops are proposed sequentially, such that the random
+	// operations remain reproducible
+	for (k = 0; k < workers; k++) {
+
+		if (!this->layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, false, cooling_phase_three)) {
+			continue;
+		}
+
+		this->batch.corb[k]->adoptCBLs(corb, this->batch.fp[k]->blocks);
+		this->syncBatchWorker(*this->batch.fp[k]);
+
+		candidates[k] = true;
+
+		this->layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, true);
+	}
+
+	// evaluate candidates concurrently; each partition is one worker, and the
+	// first partition is handled in the calling thread
+	this->batch.threads->run([&](unsigned const& partition) {
+			FloorPlanner& fp = *this->batch.fp[partition];
+			CorblivarCore& corb_worker = *this->batch.corb[partition];
+
+			if (!candidates[partition]) {
+				return;
+			}
+
+			fp.generateLayout(corb_worker, alignment);
+			candidates_cost[partition] = fp.evaluateLayout(corb_worker.getAlignments(), fitting_layouts_ratio, SA_phase_two).total_cost;
+		}, workers);
+
+	// determine best candidate
+	best = -1;
+	for (k = 0; k < workers; k++) {
+
+		if (candidates[k] && (best == -1 || candidates_cost[k] < candidates_cost[best])) {
+			best = k;
+		}
+	}
+
+	if (best == -1) {
+		return false;
+	}
+
+	this->batch.batches++;
+
+	// Metropolis criterion for best candidate; same as for regular, single ops
+	accept = true;
+	cost_diff = candidates_cost[best] - cur_cost;
+	if (cost_diff >= 0.0) {
+		if (Math::randF(0, 1) > exp(- cost_diff / cur_temp)) {
+			accept = false;
+		}
+	}
+
+	if (FloorPlanner::DBG_SA) {
+		std::cout << "DBG_SA> Batched evaluation; best candidate: " << best << "; cost diff: " << cost_diff << "; accept: " << accept << std::endl;
+	}
+
+	// apply accepted candidate; the layout is re-evaluated by this instance, such
+	// that all caches and the state of this instance are up-to-date; note that
+	// the candidate differs only in the tuples of one op from the current layout,
+	// thus the layout is regenerated partially and the interconnects are
+	// re-evaluated incrementally, as for regular, single ops
+	if (accept) {
+
+		this->batch.accepted++;
+
+		corb.adoptCBLs(*this->batch.corb[best], this->blocks);
+
+		this->generateLayout(corb, alignment);
+		cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two);
+	}
+
+	return true;
+}
+
+double FloorPlanner::applyThermalSchedule(unsigned const& level, bool const& renormalize) {
+	unsigned map_dim, mask_dim;
+	bool rescale;
+	double cost_prev, cost_new;
+
+	map_dim = this->thermal_schedule.map_dims[level];
+
+	// the mask dimension is scaled along w/ the map dimension, such that the mask
+	// covers the same die region as for the regular dimensions; the mask
+	// dimension has to be uneven and at least 3
+	if (map_dim == this->thermal_schedule.map_dims[2]) {
+		mask_dim = this->thermal_schedule.mask_dim;
+	}
+	else {
+		mask_dim = static_cast<unsigned>(std::lround(static_cast<double>(this->thermal_schedule.mask_dim) * map_dim / this->thermal_schedule.map_dims[2]));
+		if (mask_dim % 2 == 0) {
+			mask_dim++;
+		}
+		mask_dim = std::max(3u, mask_dim);
+	}
+
+	this->thermal_schedule.level = level;
+
+	// maps remain as is for same dimensions
+	if (map_dim == this->thermalAnalyzer.dims.thermal_map && mask_dim == this->thermalAnalyzer.dims.thermal_mask) {
+		return 1.0;
+	}
+
+	if (this->logMax()) {
+		std::cout << "SA>  Thermal analysis; switch to thermal-map dimension " << map_dim << " (thermal-mask dimension " << mask_dim << ")" << std::endl;
+	}
+
+	// thermal cost of current layout w/ previous maps
+	rescale = renormalize && this->max_cost_thermal > 0.0;
+	if (rescale) {
+		cost_prev = this->determineThermalCostBlocks();
+	}
+
+	// re-initialize masks and maps for new dimensions
+	this->thermalAnalyzer.setMapDimensions(map_dim, mask_dim);
+	this->thermalAnalyzer.initThermalMasks(this->IC.layers, false, this->power_blurring_parameters);
+	this->thermalAnalyzer.initPowerMaps(this->IC.layers, this->getOutline());
+	this->thermalAnalyzer.initThermalMap(this->getOutline());
+
+	// thermal cost of current layout w/ new maps; this way, the thermal map is also
+	// valid for subsequent evaluations, like hotspot determination during
+	// interconnects evaluation
+	cost_new = this->determineThermalCostBlocks();
+
+	// ratio for re-normalization of max cost, such that the normalized cost of
+	// the current layout remains the same
+	if (rescale && cost_prev > 0.0) {
+		return cost_new / cost_prev;
+	}
+	else {
+		return 1.0;
+	}
+}
+
+double FloorPlanner::applyThermalSolver() {
+	double cost_prev, cost_new;
+
+	if (this->logMax()) {
+		std::cout << "SA>  Thermal analysis; switch to 3D thermal analysis" << std::endl;
 	}
 
-	if (this->logMax()) {
-		std::cout << "SA>  (new) temp-update factor: " << cur_temp / prev_temp << " (phase " << phase << ")" << std::endl;
+	// thermal cost of current layout w/ power blurring
+	cost_prev = this->determineThermalCostBlocks();
+
+	this->thermal_schedule.solver = true;
+
+	// thermal cost of current layout w/ 3D thermal analysis; the solution also
+	// serves as initial warm start and as reference for estimation of candidates'
+	// thermal cost
+	cost_new = this->determineThermalCostBlocks();
+
+	// ratio for re-normalization of max cost, such that the normalized cost of
+	// the current layout remains the same
+	if (this->max_cost_thermal > 0.0 && cost_prev > 0.0) {
+		return cost_new / cost_prev;
+	}
+	else {
+		return 1.0;
 	}
+}
 
-	return phase;
+void FloorPlanner::acceptThermalSolver(Cost& cost) {
+	ThermalSolver::Result result;
+	double cost_temp, cost_diff;
+
+	// 3D thermal analysis of accepted layout, warm-started from the previously
+	// accepted layout
+	this->solveThermal(result, this->wires, this->thermalSolver.parameters.SA_tolerance, true);
+	this->thermalSolver.acceptSolution();
+
+	cost_temp = result.avg_temp * result.max_temp;
+
+	// ratios for estimation of subsequent candidates' thermal cost; the power
+	// blurring of the accepted layout is still available from its evaluation
+	this->thermal_schedule.solver_ratio_cost = cost_temp / this->thermal_analysis.cost_temp;
+	this->thermal_schedule.solver_ratio_max_temp = result.max_temp / this->thermal_analysis.max_temp;
+
+	// replace estimated thermal cost; update total cost accordingly
+	cost_diff = this->weights.thermal * (cost_temp / this->max_cost_thermal - cost.thermal);
+
+	cost.thermal = cost_temp / this->max_cost_thermal;
+	cost.thermal_actual_value = result.max_temp;
+	cost.total_cost += cost_diff;
+	cost.total_cost_fitting += cost_diff;
 }
 
-void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples, int& innerLoopMax, double& init_temp) {
+void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples, int& innerLoopMax, double& init_temp, bool const& sampling) {
 	int i;
 	int accepted_ops;
 	bool op_success;
@@ -552,12 +1318,16 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 	// reset temperature-schedule log
 	this->tempSchedule.clear();
 
-	// backup initial CBLs
-	corb.backupCBLs();
-
 	// init SA parameter: inner loop ops
 	innerLoopMax = std::pow(static_cast<double>(this->blocks.size()), this->schedule.loop_factor);
 
+	if (!sampling) {
+		return;
+	}
+
+	// backup initial CBLs
+	corb.backupCBLs();
+
 	/// initial sampling
 	//
 	if (this->logMed()) {
@@ -629,6 +1399,308 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 	corb.restoreCBLs();
 }
 
+/// the calibration follows the previous fitting procedure (see
+/// thermal_analysis_octave/optimization.m), i.e., candidate parameters are sampled
+/// around the best parameters found so far, w/ sampling ranges refined along the
+/// iterations; here, the candidates of each iteration are evaluated concurrently, and
+/// the temperature offset is fitted directly during evaluation
+void FloorPlanner::calibrateThermalMasks(CorblivarCore& corb) {
+	unsigned k;
+	int iteration;
+	int best;
+	int refinement_step;
+	double std_dev_scale;
+	Point outline;
+	std::vector<std::thread> threads;
+	std::vector<ThermalAnalyzer> analyzers;
+	std::vector<ThermalAnalyzer::CalibrationResult> candidates;
+	ThermalAnalyzer::CalibrationResult initial, fitted;
+	unsigned const candidates_count = this->thermal_calibration.candidates;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::calibrateThermalMasks(" << &corb << ")" << std::endl;
+	}
+
+	if (this->logMin()) {
+		std::cout << "Corblivar> ";
+		std::cout << "Performing thermal-mask calibration ..." << std::endl;
+	}
+
+	// parse reference thermal map; dimensions have to match the thermal map
+	IO::parseThermalReference(*this);
+
+	// generate and evaluate the layout, as for finalization; thus, the TSVs and
+	// wires are derived w/ the given parameters, as they were for the reference
+	// thermal map
+	if (!corb.applyBestCBLs(false)) {
+		std::cout << "Corblivar> ERROR: Valid solution required for thermal-mask calibration" << std::endl << std::endl;
+		exit(1);
+	}
+	this->generateLayout(corb, this->opt_flags.alignment);
+	if (this->IC.outline_shrink) {
+		this->shrinkDieOutlines();
+	}
+	this->evaluateLayout(corb.getAlignments(), 1.0, true, false, true);
+
+	// init thermal analyzers for candidates; one instance for each thread
+	outline = this->getOutline();
+	analyzers.resize(candidates_count);
+	for (ThermalAnalyzer& analyzer : analyzers) {
+		analyzer.setMapDimensions(this->thermalAnalyzer.dims.thermal_map, this->thermalAnalyzer.dims.thermal_mask);
+		analyzer.initPowerMaps(this->IC.layers, outline);
+		analyzer.initThermalMap(outline);
+	}
+	candidates.resize(candidates_count);
+
+	// evaluate given parameters, as initial solution
+	initial.parameters = this->power_blurring_parameters;
+	analyzers[0].evaluateCalibration(initial, this->IC.layers, this->blocks, outline, this->TSVs, this->dummy_TSVs, this->wires,
+			this->thermal_calibration.reference);
+	fitted = initial;
+
+	if (this->logMed()) {
+		std::cout << "Corblivar>  Initial parameters; RMS error [K]: " << initial.error_rms << std::endl;
+	}
+
+	// sampling ranges are refined ten times overall
+	refinement_step = std::max(1, this->thermal_calibration.iterations / 10);
+	std_dev_scale = 1.0;
+
+	for (iteration = 1; iteration <= this->thermal_calibration.iterations; iteration++) {
+
+		// sample candidates around currently best parameters; note that the
+		// candidates are sampled sequentially, such that the calibration
+		// remains reproducible
+		for (k = 0; k < candidates_count; k++) {
+			this->sampleThermalMaskParameters(candidates[k].parameters, fitted.parameters, std_dev_scale);
+		}
+
+		// evaluate candidates concurrently; the first candidate is evaluated in
+		// the calling thread
+		threads.clear();
+		for (k = 1; k < candidates_count; k++) {
+			threads.emplace_back(
+					[this, &analyzers, &candidates, &outline, k]() {
+						analyzers[k].evaluateCalibration(candidates[k], this->IC.layers, this->blocks, outline, this->TSVs, this->dummy_TSVs, this->wires,
+								this->thermal_calibration.reference);
+					}
+				);
+		}
+		analyzers[0].evaluateCalibration(candidates[0], this->IC.layers, this->blocks, outline, this->TSVs, this->dummy_TSVs, this->wires,
+				this->thermal_calibration.reference);
+
+		for (std::thread& t : threads) {
+			t.join();
+		}
+
+		// determine best candidate; memorize if better than best parameters
+		best = 0;
+		for (k = 1; k < candidates_count; k++) {
+			if (candidates[k].error_rms < candidates[best].error_rms) {
+				best = k;
+			}
+		}
+		if (candidates[best].error_rms < fitted.error_rms) {
+			fitted = candidates[best];
+
+			if (this->logMed()) {
+				std::cout << "Corblivar>  Iteration " << iteration << "; improved parameters; RMS error [K]: " << fitted.error_rms << std::endl;
+			}
+		}
+
+		// refine sampling ranges
+		if (iteration % refinement_step == 0) {
+			std_dev_scale *= FloorPlanner::CALIBRATION_STD_DEV_REFINEMENT;
+		}
+	}
+
+	// logging
+	if (this->logMin()) {
+		std::cout << "Corblivar> Thermal-mask calibration against reference thermal map: " << this->IO_conf.thermal_reference_file << std::endl;
+		std::cout << "Corblivar>  Evaluated parameters: " << 1 + this->thermal_calibration.iterations * candidates_count << std::endl;
+		std::cout << "Corblivar>  Initial parameters; RMS error / max error / peak-temp error [K]: ";
+		std::cout << initial.error_rms << " / " << initial.error_max << " / " << initial.error_peak << std::endl;
+		std::cout << "Corblivar>  Calibrated parameters; RMS error / max error / peak-temp error [K]: ";
+		std::cout << fitted.error_rms << " / " << fitted.error_max << " / " << fitted.error_peak << std::endl;
+		std::cout << "Corblivar>   Impulse factor: " << fitted.parameters.impulse_factor << std::endl;
+		std::cout << "Corblivar>   Impulse scaling-factor: " << fitted.parameters.impulse_factor_scaling_exponent << std::endl;
+		std::cout << "Corblivar>   Mask-boundary value: " << fitted.parameters.mask_boundary_value << std::endl;
+		std::cout << "Corblivar>   Power-density scaling factor (padding zone): " << fitted.parameters.power_density_scaling_padding_zone << std::endl;
+		std::cout << "Corblivar>   Power-density down-scaling factor (TSV regions): " << fitted.parameters.power_density_scaling_TSV_region << std::endl;
+		std::cout << "Corblivar>   Temperature offset: " << fitted.parameters.temp_offset << std::endl;
+		std::cout << std::endl;
+
+		this->IO_conf.results << "Thermal-mask calibration against reference thermal map: " << this->IO_conf.thermal_reference_file << std::endl;
+		this->IO_conf.results << " Initial parameters; RMS error / max error / peak-temp error [K]: ";
+		this->IO_conf.results << initial.error_rms << " / " << initial.error_max << " / " << initial.error_peak << std::endl;
+		this->IO_conf.results << " Calibrated parameters; RMS error / max error / peak-temp error [K]: ";
+		this->IO_conf.results << fitted.error_rms << " / " << fitted.error_max << " / " << fitted.error_peak << std::endl;
+		this->IO_conf.results << std::endl;
+	}
+
+	// write out calibrated parameters
+	IO::writeThermalCalibration(*this, fitted);
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::calibrateThermalMasks" << std::endl;
+	}
+}
+
+/// log-normal sampling is applied for the mask parameters, which are all positive and
+/// vary over orders of magnitude; normal sampling is applied for the power-maps
+/// parameters, w/in their valid ranges
+void FloorPlanner::sampleThermalMaskParameters(ThermalAnalyzer::MaskParameters& candidate, ThermalAnalyzer::MaskParameters const& parameters, double const& std_dev_scale) const {
+	unsigned tries;
+	double impulse_factor, mask_boundary_value, scaling;
+	double const std_dev_mask = FloorPlanner::CALIBRATION_STD_DEV_MASK * std_dev_scale;
+	double const std_dev_power_maps = FloorPlanner::CALIBRATION_STD_DEV_POWER_MAPS * std_dev_scale;
+
+	candidate = parameters;
+
+	// impulse factor and mask-boundary value; the latter has to remain below the
+	// former
+	for (tries = 0; tries < FloorPlanner::CALIBRATION_SAMPLING_TRIES; tries++) {
+
+		impulse_factor = parameters.impulse_factor * std::exp(Math::randN(0.0, std_dev_mask));
+		mask_boundary_value = parameters.mask_boundary_value * std::exp(Math::randN(0.0, std_dev_mask));
+
+		if (mask_boundary_value < impulse_factor) {
+			candidate.impulse_factor = impulse_factor;
+			candidate.mask_boundary_value = mask_boundary_value;
+			break;
+		}
+	}
+
+	// impulse-scaling factor
+	candidate.impulse_factor_scaling_exponent = parameters.impulse_factor_scaling_exponent * std::exp(Math::randN(0.0, std_dev_mask));
+
+	// power-density scaling factor in padding zone; 1.0 represents no scaling
+	for (tries = 0; tries < FloorPlanner::CALIBRATION_SAMPLING_TRIES; tries++) {
+
+		scaling = Math::randN(parameters.power_density_scaling_padding_zone, std_dev_power_maps);
+
+		if (1.0 <= scaling && scaling <= FloorPlanner::CALIBRATION_PADDING_ZONE_SCALING_MAX) {
+			candidate.power_density_scaling_padding_zone = scaling;
+			break;
+		}
+	}
+
+	// power-density down-scaling factor for TSV regions; ranges b/w 0.0 and 1.0
+	for (tries = 0; tries < FloorPlanner::CALIBRATION_SAMPLING_TRIES; tries++) {
+
+		scaling = Math::randN(parameters.power_density_scaling_TSV_region, std_dev_power_maps);
+
+		if (0.0 <= scaling && scaling <= 1.0) {
+			candidate.power_density_scaling_TSV_region = scaling;
+			break;
+		}
+	}
+}
+
+/// the stack is modelled as for the HotSpot files, see IO::writeHotSpotFiles, thus the
+/// results are comparable to HotSpot's results as well
+void FloorPlanner::solveThermal(ThermalSolver::Result& result, std::vector<Block> const& wires, double const& tolerance, bool const& warm_start) {
+	ThermalSolver::Stack stack;
+	std::vector< Map2D<double> > TSV_density_maps;
+	unsigned const dim = this->thermalAnalyzer.dims.thermal_map;
+
+	stack.BEOL_thickness = this->techParameters.BEOL_thickness;
+	stack.Si_active_thickness = this->techParameters.Si_active_thickness;
+	stack.Si_passive_thickness = this->techParameters.Si_passive_thickness;
+	stack.bond_thickness = this->techParameters.bond_thickness;
+	stack.TSV_group_Cu_area_ratio = this->techParameters.TSV_group_Cu_area_ratio;
+
+	// the solver's grid matches the thermal map; only effective for changed
+	// dimensions or die outline
+	this->thermalSolver.initSolver(this->IC.layers, dim, this->getOutline(), stack);
+
+	// for thermal-analysis fitting runs, we consider one common TSV density for the
+	// whole chip outline; for regular runs, we consider the TSV densities of the
+	// power-maps bins
+	if (this->thermal_analyser_run) {
+		TSV_density_maps.assign(this->IC.layers, Map2D<double>(dim, dim, this->power_blurring_parameters.TSV_density));
+
+		this->thermalSolver.solve(result, this->blocks, wires, TSV_density_maps, 0, tolerance, warm_start);
+	}
+	else {
+		this->thermalSolver.solve(result, this->blocks, wires, this->thermalAnalyzer.getTSVDensityMaps(), this->thermalAnalyzer.dims.power_maps_padded_bins,
+				tolerance, warm_start);
+	}
+}
+
+void FloorPlanner::evaluateThermalSolver() {
+	std::chrono::steady_clock::time_point start, end;
+	unsigned x, y;
+	double diff, error_rms, error_max;
+	ThermalSolver::Result result;
+	unsigned const dim = this->thermalAnalyzer.dims.thermal_map;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::evaluateThermalSolver()" << std::endl;
+	}
+
+	start = std::chrono::steady_clock::now();
+
+	// final solution is solved from scratch, w/ regular tolerance
+	this->solveThermal(result, this->wires, ThermalSolver::TOLERANCE, false);
+
+	end = std::chrono::steady_clock::now();
+
+	if (this->logMin()) {
+		std::cout << "Corblivar> 3D thermal analysis:" << std::endl;
+		std::cout << "Corblivar>  Temp (max temp for lowest layer [K]): " << result.max_temp << std::endl;
+		std::cout << "Corblivar>  Solver iterations: " << result.iterations << "; relative residual: " << result.residual;
+		if (!result.converged) {
+			std::cout << " (not converged)";
+		}
+		std::cout << std::endl;
+		std::cout << "Corblivar>  Runtime [s]: " << std::chrono::duration<double>(end - start).count() << std::endl;
+
+		this->IO_conf.results << "3D thermal analysis:" << std::endl;
+		this->IO_conf.results << " Temp (max temp for lowest layer [K]): " << result.max_temp << std::endl;
+		this->IO_conf.results << " Solver iterations: " << result.iterations << "; relative residual: " << result.residual;
+		if (!result.converged) {
+			this->IO_conf.results << " (not converged)";
+		}
+		this->IO_conf.results << std::endl;
+	}
+
+	// compare to power blurring, for the lowest layer; only if performed for the
+	// same dimensions
+	if (this->opt_flags.thermal && this->thermal_analysis.thermal_map != nullptr && this->thermal_analysis.thermal_map->dimX() == dim) {
+
+		error_rms = error_max = 0.0;
+
+		for (x = 0; x < dim; x++) {
+			for (y = 0; y < dim; y++) {
+
+				diff = (*this->thermal_analysis.thermal_map)[x][y].temp - this->thermalSolver.getThermalMaps()[0][x][y];
+
+				error_rms += diff * diff;
+				error_max = std::max(error_max, std::abs(diff));
+			}
+		}
+		error_rms = std::sqrt(error_rms / (dim * dim));
+
+		if (this->logMin()) {
+			std::cout << "Corblivar>  Power blurring vs 3D thermal analysis; RMS error / max error / peak-temp error [K]: ";
+			std::cout << error_rms << " / " << error_max << " / " << this->thermal_analysis.max_temp - result.max_temp << std::endl;
+
+			this->IO_conf.results << " Power blurring vs 3D thermal analysis; RMS error / max error / peak-temp error [K]: ";
+			this->IO_conf.results << error_rms << " / " << error_max << " / " << this->thermal_analysis.max_temp - result.max_temp << std::endl;
+		}
+	}
+
+	if (this->logMin()) {
+		std::cout << std::endl;
+		this->IO_conf.results << std::endl;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::evaluateThermalSolver" << std::endl;
+	}
+}
+
 void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost, bool const& handle_corblivar) {
 	struct timeb end;
 	std::stringstream runtime;
@@ -759,7 +1831,7 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 					avg_base_temp += cur_hotspot.base_temp;
 					avg_temp_gradient += cur_hotspot.temp_gradient;
 					avg_score += cur_hotspot.score;
-					avg_bins_count += cur_hotspot.bins.size();
+					avg_bins_count += cur_hotspot.bins;
 				}
 
 				avg_peak_temp /= this->clustering.hotspots.size();
@@ -846,6 +1918,11 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 				this->IO_conf.results << " Pearson correlation of power and thermal map for lowest layer: " << cost.thermal_leakage_correlation_actual_value << std::endl;
 			}
 		}
+
+		// 3D thermal analysis, as reference for power blurring
+		if (this->thermalSolver.parameters.enabled && this->IO_conf.power_density_file_avail) {
+			this->evaluateThermalSolver();
+		}
 	}
 
 	// generate temperature-schedule data
@@ -879,6 +1956,10 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 		runtime << "Runtime: " << (1000.0 * (end.time - this->time_start.time) + (end.millitm - this->time_start.millitm)) / 1000.0 << " s";
 		std::cout << "Corblivar> " << runtime.str() << std::endl;
 		this->IO_conf.results << runtime.str() << std::endl;
+
+		// log seed, for reproducible runs
+		std::cout << "Corblivar> Seed: " << this->schedule.seed << std::endl;
+		this->IO_conf.results << "Seed: " << this->schedule.seed << std::endl;
 	}
 
 	// close IO_conf.results file
@@ -1168,12 +2249,11 @@ void FloorPlanner::evaluateTiming(Cost& cost, bool const& set_max_cost, bool con
 			}
 		}
 
-		// evaluate timing for all possible scenarios, i.e., when all various voltages are assigned to the blocks
+		// evaluate timing for all possible scenarios, i.e., when all various voltages are assigned to the blocks; all scenarios are evaluated in one pass over
+		// the DAG
 		// also consider the threshold as required global arrival time
 		//
-		for (int voltage_index = 0; voltage_index < static_cast<int>(this->voltageAssignment.parameters.voltages.size()); voltage_index++) {
-			this->timingPowerAnalyser.updateTiming(this->opt_flags.voltage_assignment, this->IC.delay_threshold, voltage_index);
-		}
+		this->timingPowerAnalyser.updateTimingAllVoltages(this->opt_flags.voltage_assignment, this->IC.delay_threshold);
 
 		// store actual max delay value; considering the default voltage
 		cost.timing_actual_value = this->timingPowerAnalyser.getGlobalAAT(this->voltageAssignment.parameters.voltages.size() - 1);
@@ -1348,6 +2428,7 @@ void FloorPlanner::evaluateVoltageAssignment(Cost& cost, double const& fitting_l
 }
 
 void FloorPlanner::evaluateThermalDistr(Cost& cost, bool const& set_max_cost) {
+	double cost_temp, max_temp;
 
 	// generate power maps based on layout and blocks' power densities; only required
 	// here if interconnects are not evaluated, otherwise this is already done in
@@ -1364,20 +2445,34 @@ void FloorPlanner::evaluateThermalDistr(Cost& cost, bool const& set_max_cost) {
 	this->thermalAnalyzer.performPowerBlurring(this->thermal_analysis, this->IC.layers,
 			this->power_blurring_parameters);
 
+	// 3D thermal analysis for late SA phases; the thermal cost is estimated from
+	// power blurring, scaled to the 3D analysis of the last accepted layout; the
+	// 3D analysis itself is only performed once the layout is accepted, see
+	// acceptThermalSolver
+	if (this->thermal_schedule.solver) {
+		cost_temp = this->thermal_analysis.cost_temp * this->thermal_schedule.solver_ratio_cost;
+		max_temp = this->thermal_analysis.max_temp * this->thermal_schedule.solver_ratio_max_temp;
+	}
+	else {
+		cost_temp = this->thermal_analysis.cost_temp;
+		max_temp = this->thermal_analysis.max_temp;
+	}
+
 	// memorize max cost; initial sampling
 	if (set_max_cost) {
-		this->max_cost_thermal = this->thermal_analysis.cost_temp;
+		this->max_cost_thermal = cost_temp;
 	}
 
 	// store normalized temp cost
-	cost.thermal = this->thermal_analysis.cost_temp / this->max_cost_thermal;
+	cost.thermal = cost_temp / this->max_cost_thermal;
 	// store actual temp value
-	cost.thermal_actual_value = this->thermal_analysis.max_temp;
+	cost.thermal_actual_value = max_temp;
 }
 
 void FloorPlanner::evaluateLeakage(Cost& cost, double const& fitting_layouts_ratio, bool const& set_max_cost) {
 	double entropy;
 	double correlation;
+	std::vector<double> layers_entropy;
 
 	// sanity checks, only when thermal analysis is conducted as well
 	if (!this->opt_flags.thermal) {
@@ -1400,9 +2495,27 @@ void FloorPlanner::evaluateLeakage(Cost& cost, double const& fitting_layouts_rat
 	}
 
 	// Avg spatial entropy
+	//
+	// the layers are evaluated concurrently, if multiple threads are available and the maps are large enough; the first layer is evaluated in the calling thread
+	this->leakageAnalyzer.initLayers(this->IC.layers, this->thermalAnalyzer.getPowerMapsOrig()[0].dimX());
+
+	layers_entropy.resize(this->IC.layers, 0.0);
+	if (this->availableThreads() > 1 && this->thermalAnalyzer.getPowerMapsOrig()[0].size() >= FloorPlanner::LEAKAGE_BINS_PER_THREAD_MIN) {
+
+		this->editWorkers().run([&](unsigned const& partition) {
+				layers_entropy[partition] = this->leakageAnalyzer.determineSpatialEntropy(partition, this->thermalAnalyzer.getPowerMapsOrig()[partition]);
+			}, this->IC.layers);
+	}
+	else {
+		for (int d = 0; d < this->IC.layers; d++) {
+			layers_entropy[d] = this->leakageAnalyzer.determineSpatialEntropy(d, this->thermalAnalyzer.getPowerMapsOrig()[d]);
+		}
+	}
+
+	// sum up in order of layers, such that the result is independent of the threads
 	entropy = 0.0;
 	for (int d = 0; d < this->IC.layers; d++) {
-		entropy += this->leakageAnalyzer.determineSpatialEntropy(d, this->thermalAnalyzer.getPowerMapsOrig()[d]);
+		entropy += layers_entropy[d];
 	}
 	entropy /= this->IC.layers;
 
@@ -1556,9 +2669,91 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 	}
 }
 
+unsigned FloorPlanner::availableThreads() const {
+	// querying the cores is not for free, thus done only once
+	static unsigned const cores = std::thread::hardware_concurrency();
+
+	// replicas and batch workers are running concurrently, each in its own thread
+	return std::max(1u, cores / static_cast<unsigned>(std::max(1, this->schedule.PT_replicas * this->schedule.batch_size)));
+}
+
+ThermalSolver::Workers& FloorPlanner::editWorkers() {
+
+	// workers are kept for subsequent calls
+	if (!this->workers) {
+		this->workers.reset(new ThermalSolver::Workers(this->availableThreads()));
+	}
+
+	return *this->workers;
+}
+
+unsigned FloorPlanner::interconnectsThreads() const {
+
+	// dbg output would be interleaved for concurrent evaluation
+	if (Net::DBG) {
+		return 1;
+	}
+
+	// each thread is to handle a reasonable count of nets
+	return std::max(1u, std::min(
+				this->availableThreads(),
+				static_cast<unsigned>(this->nets.size()) / FloorPlanner::INTERCONNECTS_NETS_PER_THREAD_MIN
+			));
+}
+
+void FloorPlanner::evaluateNetsConcurrently(std::function<void(unsigned const& first, unsigned const& last)> const& handler) {
+	unsigned threads_count = this->interconnectsThreads();
+
+	if (threads_count <= 1) {
+		handler(0, this->nets.size());
+		return;
+	}
+
+	// each partition is one contiguous range of nets, i.e., each worker handles
+	// one range; the first range is handled in the calling thread
+	this->editWorkers().run([&](unsigned const& partition) {
+			handler(
+				this->nets.size() * partition / threads_count,
+				this->nets.size() * (partition + 1) / threads_count
+			);
+		}, threads_count);
+}
+
+void FloorPlanner::applyUtilContributions() {
+	int i;
+	unsigned contributions = 0;
+
+	// each layer's map is adapted separately, in the order of memorized contributions,
+	// i.e., the resulting maps are the same as for sequential evaluation
+	auto applyLayer = [this](int const& layer) {
+
+		for (auto const& contribution : this->interconnects_buffers.util_contributions[layer]) {
+			this->routingUtil.adaptUtilMap(layer, contribution.bb, contribution.weight);
+		}
+	};
+
+	for (i = 0; i < this->IC.layers; i++) {
+		contributions += this->interconnects_buffers.util_contributions[i].size();
+	}
+
+	// the layers are handled concurrently, if multiple cores are available and
+	// enough contributions are to be applied
+	if (this->interconnectsThreads() > 1 && contributions >= FloorPlanner::INTERCONNECTS_NETS_PER_THREAD_MIN) {
+
+		this->editWorkers().run([&](unsigned const& partition) {
+				applyLayer(partition);
+			}, this->IC.layers);
+	}
+	else {
+		for (i = 0; i < this->IC.layers; i++) {
+			applyLayer(i);
+		}
+	}
+}
+
 void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const& frequency, std::vector<CorblivarAlignmentReq> const& alignments, bool const& set_max_cost, bool const& finalize) {
 	int i;
-	std::vector<Rect const*> blocks_to_consider;
+	unsigned n;
 	std::vector< std::vector<Clustering::Segments> > nets_segments;
 	Rect bb, prev_bb;
 	double prev_TSVs;
@@ -1568,6 +2763,9 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 	double WL_cur_net;
 	double x, y;
 	bool TSV_in_frame;
+	bool full_eval, net_dirty;
+	bool clustering = this->layoutOp.parameters.signal_TSV_clustering && !this->layoutOp.parameters.trivial_HPWL;
+	auto& buffers = this->interconnects_buffers;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		std::cout << "-> FloorPlanner::evaluateInterconnects(" << &cost << ", " << frequency << ", " << &alignments << ", " << set_max_cost << ", " << finalize << ")" << std::endl;
@@ -1598,6 +2796,31 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 		this->wires.push_back(std::move(wire));
 	}
 
+	// incremental evaluation: determine blocks moved since the previous evaluation;
+	// only nets connected to such blocks have to be re-evaluated
+	//
+	// a full evaluation is enforced for finalize calls and after changes of the
+	// die outline or the terminal pins
+	full_eval = finalize || !this->interconnects_cache.valid;
+
+	if (full_eval) {
+		this->interconnects_cache.layout.resize(this->blocks.size());
+		this->interconnects_cache.blocks_moved.resize(this->blocks.size());
+	}
+
+	for (Block const& b : this->blocks) {
+
+		if (full_eval || this->interconnects_cache.layout.differs(&b)) {
+			this->interconnects_cache.layout.capture(&b);
+			this->interconnects_cache.blocks_moved[b.numerical_id] = true;
+		}
+		else {
+			this->interconnects_cache.blocks_moved[b.numerical_id] = false;
+		}
+	}
+
+	this->interconnects_cache.valid = true;
+
 	// reset routing-utilization estimation
 	if (this->opt_flags.routing_util) {
 		this->routingUtil.resetUtilMaps(this->IC.layers);
@@ -1610,24 +2833,129 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 				this->getOutline(), this->power_blurring_parameters);
 	}
 
-	// allocate vector for blocks to be considered
-	blocks_to_consider.reserve(this->blocks.size());
 	// allocate vector for nets' segments
 	for (i = 0; i < this->IC.layers; i++) {
 		nets_segments.emplace_back(std::vector<Clustering::Segments>());
 	}
 
+	// reset contributions to routing-utilization maps
+	buffers.util_contributions.resize(this->IC.layers);
+	for (auto& contributions : buffers.util_contributions) {
+		contributions.clear();
+	}
+
+	// determine nets to be re-evaluated along w/ their bounding boxes; the nets are
+	// independent of each other, thus they are handled concurrently, if multiple
+	// cores are available
+	//
+	buffers.nets_dirty.resize(this->nets.size());
+
+	this->evaluateNetsConcurrently(
+		[this, &buffers, &full_eval](unsigned const& first, unsigned const& last) {
+			std::vector<Rect const*> blocks_to_consider;
+			bool net_dirty;
+
+			for (unsigned n = first; n < last; n++) {
+
+				Net& cur_net = this->nets[n];
+
+				// reset TSVs also from nets
+				cur_net.TSVs.clear();
+
+				// incremental evaluation: re-evaluate net only if any of its
+				// blocks was moved
+				net_dirty = full_eval;
+				if (!net_dirty) {
+					for (Block const* b : cur_net.blocks) {
+						if (this->interconnects_cache.blocks_moved[b->numerical_id]) {
+							net_dirty = true;
+							break;
+						}
+					}
+				}
+				buffers.nets_dirty[n] = net_dirty;
+
+				if (!net_dirty) {
+					continue;
+				}
+
+				// reset set layer boundaries, i.e., determine lowest and
+				// uppermost layer; only required for nets w/ moved blocks
+				cur_net.resetLayerBoundaries();
+
+				// trivial HPWL estimation, considering one global bounding box;
+				// required to compare w/ other 3D floorplanning tools
+				if (this->layoutOp.parameters.trivial_HPWL) {
+
+					// resets blocks to be considered for each cur_net
+					blocks_to_consider.clear();
+
+					// blocks for cur_net on all layer
+					for (Block const* b : cur_net.blocks) {
+						blocks_to_consider.push_back(&b->bb);
+					}
+
+					// consider routes to terminal pins
+					for (Pin const* pin :  cur_net.terminals) {
+						blocks_to_consider.push_back(&pin->bb);
+					}
+
+					// determine HPWL of related blocks using their bounding
+					// box; consider center points of blocks instead their
+					// whole outline
+					cur_net.bbs_cache.assign(1, Rect::determBoundingBox(blocks_to_consider, true));
+				}
+				// more detailed estimate; consider HPWL on each layer
+				// separately using layer-related bounding boxes
+				else {
+					cur_net.bbs_cache.clear();
+
+					for (int i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
+						// also consider the centers of the blocks, as we do
+						// for interconnect estimation in general
+						cur_net.bbs_cache.push_back(cur_net.determBoundingBox(i, true));
+					}
+				}
+			}
+		}
+	);
+
 	WL_largest_net = WL_cur_net = 0.0;
 
 	// determine HPWL and TSVs for each net
 	//
-	for (Net& cur_net : this->nets) {
+	// the remaining evaluation is sequential, in the order of nets, such that the
+	// summation of cost terms is independent of the threads
+	//
+	for (n = 0; n < this->nets.size(); n++) {
+
+		Net& cur_net = this->nets[n];
+
+		net_dirty = buffers.nets_dirty[n];
+
+		// incremental evaluation: nets w/ an empty bb on their lowermost layer
+		// consider the bb of the previous net instead, see below, i.e., their
+		// contributions to the routing-utilization maps depend on the previous
+		// net as well; thus, such nets are always re-evaluated
+		if (!net_dirty && !this->layoutOp.parameters.trivial_HPWL && cur_net.bbs_cache[0].area == 0.0) {
+			net_dirty = true;
+		}
 
-		// reset TSVs also from nets
-		cur_net.TSVs.clear();
+		// incremental evaluation: contributions to routing-utilization maps
+		// are only re-determined for nets to be re-evaluated, whereas the
+		// cached contributions are considered for all other nets; since all
+		// contributions are thus applied in the order of nets, the maps are
+		// the same as for full evaluation; not required for clustering, where
+		// the maps are handled by clustering itself
+		if (net_dirty) {
+			cur_net.util_cache.clear();
+		}
+		else if (!clustering && this->opt_flags.routing_util) {
 
-		// reset set layer boundaries, i.e., determine lowest and uppermost layer
-		cur_net.resetLayerBoundaries();
+			for (auto const& contribution : cur_net.util_cache) {
+				buffers.util_contributions[contribution.first].push_back({contribution.second, cur_net.util_cache_weight});
+			}
+		}
 
 		// determine net weight, for routing-utilization and wire-power estimation
 		// across multiple layers
@@ -1641,22 +2969,9 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 		// to compare w/ other 3D floorplanning tools
 		if (this->layoutOp.parameters.trivial_HPWL) {
 
-			// resets blocks to be considered for each cur_net
-			blocks_to_consider.clear();
-
-			// blocks for cur_net on all layer
-			for (Block const* b : cur_net.blocks) {
-				blocks_to_consider.push_back(&b->bb);
-			}
-
-			// consider routes to terminal pins
-			for (Pin const* pin :  cur_net.terminals) {
-				blocks_to_consider.push_back(&pin->bb);
-			}
-
-			// determine HPWL of related blocks using their bounding box;
-			// consider center points of blocks instead their whole outline
-			bb = Rect::determBoundingBox(blocks_to_consider, true);
+			// incremental evaluation: bounding box only determined for nets
+			// w/ moved blocks, otherwise cached
+			bb = cur_net.bbs_cache[0];
 			WL_cur_net = (bb.w + bb.h);
 			cost.HPWL += WL_cur_net;
 
@@ -1685,8 +3000,13 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 			// layers but with accordingly down-scaled weight
 			for (i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
 
-				if (this->opt_flags.routing_util) {
-					this->routingUtil.adaptUtilMap(i, bb, net_weight);
+				// incremental evaluation: only nets w/ moved blocks
+				// require updates of the maps
+				if (this->opt_flags.routing_util && net_dirty) {
+					buffers.util_contributions[i].push_back({bb, net_weight});
+
+					cur_net.util_cache.push_back({i, bb});
+					cur_net.util_cache_weight = net_weight;
 				}
 				// (TODO) revise; lead to inf power-density values;
 				// deactivated for now since not essential
@@ -1716,14 +3036,19 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 			// that at least one block is in that lowermost layer, i.e., that
 			// a non-empty bb can be constructed
 
+			// incremental evaluation: bounding boxes only determined for
+			// nets w/ moved blocks, otherwise cached; note that the bb on
+			// the lowermost layer may still have no area, e.g., when only
+			// the center of one block is considered there, in which case
+			// prev_bb from the previous net is considered, see above
+
 			// determine HPWL on each related layer separately
 			WL_cur_net = 0.0;
 			for (i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
 
 				// determine HPWL using the net's bounding box on the
 				// current layer
-				// also consider the centers of the blocks, as we do for interconnect estimation in general
-				bb = cur_net.determBoundingBox(i, true);
+				bb = cur_net.bbs_cache[i - cur_net.layer_bottom];
 				WL_cur_net += (bb.w + bb.h);
 
 				// update power values accordingly, only for driver nets,
@@ -1783,8 +3108,14 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 					// for ignored clustering, the net shall impact
 					// the routing utilization on all affected layers
 					// but with accordingly down-scaled weight
-					if (this->opt_flags.routing_util) {
-						this->routingUtil.adaptUtilMap(i, bb, net_weight);
+					//
+					// incremental evaluation: only nets w/ moved
+					// blocks require updates of the maps
+					if (this->opt_flags.routing_util && net_dirty) {
+						buffers.util_contributions[i].push_back({bb, net_weight});
+
+						cur_net.util_cache.push_back({i, bb});
+						cur_net.util_cache_weight = net_weight;
 					}
 					// the power maps have to be adapted similarly;
 					// this way, the wires' power is tracked (but not
@@ -1873,7 +3204,8 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 	if (this->layoutOp.parameters.signal_TSV_clustering && !this->layoutOp.parameters.trivial_HPWL) {
 
 		// actual clustering
-		this->clustering.clusterSignalTSVs(this->nets, nets_segments, this->TSVs, this->techParameters.TSV_pitch, this->techParameters.TSV_per_cluster_limit, this->thermal_analysis);
+		this->clustering.clusterSignalTSVs(this->nets, nets_segments, this->TSVs, this->techParameters.TSV_pitch, this->techParameters.TSV_per_cluster_limit, this->thermal_analysis,
+				(this->availableThreads() > 1) ? &this->editWorkers() : nullptr);
 
 		// after clustering, we can obtain a more accurate wirelength and
 		// routing-utilization estimation by considering TSVs' positions as well
@@ -1887,8 +3219,37 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 		// note that previous routing util and dummy blocks for wires don't require
 		// resets, since they are only affected now, during clustering itself
 
+		// determine the nets' bounding boxes on all related layers, now also
+		// considering the TSVs; again, the nets are handled concurrently, if
+		// multiple cores are available
+		//
+		buffers.nets_bbs_offsets.resize(this->nets.size() + 1);
+		buffers.nets_bbs_offsets[0] = 0;
+		for (n = 0; n < this->nets.size(); n++) {
+			buffers.nets_bbs_offsets[n + 1] = buffers.nets_bbs_offsets[n] + (this->nets[n].layer_top + 1 - this->nets[n].layer_bottom);
+		}
+		buffers.nets_bbs.resize(buffers.nets_bbs_offsets.back());
+
+		this->evaluateNetsConcurrently(
+			[this, &buffers](unsigned const& first, unsigned const& last) {
+
+				for (unsigned n = first; n < last; n++) {
+
+					Net const& cur_net = this->nets[n];
+
+					for (int i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
+						// also consider the centers of the blocks, as we do
+						// for interconnect estimation in general
+						buffers.nets_bbs[buffers.nets_bbs_offsets[n] + i - cur_net.layer_bottom] = cur_net.determBoundingBox(i, true);
+					}
+				}
+			}
+		);
+
 		// determine HPWL for each net
-		for (Net& cur_net : this->nets) {
+		for (n = 0; n < this->nets.size(); n++) {
+
+			Net& cur_net = this->nets[n];
 
 			if (Net::DBG) {
 				std::cout << "DBG_NET> Determine HPWL (w/ consideration of TSV positions) for net " << cur_net.id << std::endl;
@@ -1899,9 +3260,8 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 			WL_cur_net = 0.0;
 			for (i = cur_net.layer_bottom; i <= cur_net.layer_top; i++) {
 
-				// determine the net's bounding box on the current layer
-				// also consider the centers of the blocks, as we do for interconnect estimation in general
-				bb = cur_net.determBoundingBox(i, true);
+				// the net's bounding box on the current layer
+				bb = buffers.nets_bbs[buffers.nets_bbs_offsets[n] + i - cur_net.layer_bottom];
 				WL_cur_net += (bb.w + bb.h);
 
 				// update power values accordingly, only for driver nets,
@@ -1916,7 +3276,7 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 				// update related routing-utilization map; each single net
 				// has default weight of 1.0
 				if (this->opt_flags.routing_util) {
-					this->routingUtil.adaptUtilMap(i, bb, 1.0);
+					buffers.util_contributions[i].push_back({bb, 1.0});
 				}
 				// the power maps have to be adapted similarly; this way,
 				// the wires' power is tracked (but not for input nets)
@@ -1953,6 +3313,11 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 		}
 	}
 
+	// adapt routing-utilization maps by contributions of all nets
+	if (this->opt_flags.routing_util) {
+		this->applyUtilContributions();
+	}
+
 	// after considering all nets, apply the related power footprint to the power maps
 	this->thermalAnalyzer.adaptPowerMapsWires(this->wires);
 
@@ -29,9 +29,12 @@
 #include "Net.hpp"
 #include "LayoutOperations.hpp"
 #include "ThermalAnalyzer.hpp"
+#include "ThermalSolver.hpp"
 #include "LeakageAnalyzer.hpp"
 #include "Clustering.hpp"
 #include "RoutingUtilization.hpp"
+#include "LayoutState.hpp"
+#include "Math.hpp"
 // forward declarations, if any
 class Block;
 class CorblivarCore;
@@ -132,6 +135,8 @@ class FloorPlanner {
 		/// IO files and parameters
 		struct IO_conf {
 			std::string blocks_file, GT_fp_file, alignments_file, pins_file, GT_pins_file, power_density_file, GT_power_file, nets_file, solution_file;
+			/// reference thermal map for thermal-mask calibration runs
+			std::string thermal_reference_file;
 			std::ofstream results, solution_out;
 			std::ifstream solution_in;
 			/// flag whether power density file is available / was handled /
@@ -150,6 +155,43 @@ class FloorPlanner {
 		/// run mode; represents thermal analyser runs where TSV density is given
 		/// as command-line parameter
 		bool thermal_analyser_run;
+		/// run mode; represents thermal-mask calibration runs where a reference
+		/// thermal map is given as command-line parameter, in addition to the
+		/// parameters for thermal analyser runs
+		bool thermal_calibration_run;
+
+		/// thermal-mask calibration: parameters, parsed in
+		/// IO::parseParametersFiles, and reference thermal map (lowest layer),
+		/// parsed in IO::parseThermalReference
+		struct thermal_calibration {
+			/// iterations, i.e., generations of sampled parameters
+			int iterations;
+			/// candidate parameters sampled per iteration, each evaluated in
+			/// its own thread
+			int candidates;
+			/// reference thermal map, e.g., from HotSpot
+			Map2D<double> reference;
+		} thermal_calibration;
+		/// thermal-mask calibration: sampling of candidate parameters; std dev
+		/// of the log-normal sampling for the mask parameters, i.e., relative
+		/// std dev, and std dev of the normal sampling for the power-maps
+		/// parameters; these std devs are refined along the iterations, the
+		/// refinement is applied ten times overall
+		static constexpr double CALIBRATION_STD_DEV_MASK = 0.5;
+		/// thermal-mask calibration: sampling of candidate parameters
+		static constexpr double CALIBRATION_STD_DEV_POWER_MAPS = 0.25;
+		/// thermal-mask calibration: sampling of candidate parameters
+		static constexpr double CALIBRATION_STD_DEV_REFINEMENT = 0.8;
+		/// thermal-mask calibration: sampling of candidate parameters; upper
+		/// limit for power-density scaling factor in padding zone
+		static constexpr double CALIBRATION_PADDING_ZONE_SCALING_MAX = 2.0;
+		/// thermal-mask calibration: sampling of candidate parameters; tries
+		/// for sampling within the valid ranges, the previous parameter is
+		/// retained otherwise
+		static constexpr unsigned CALIBRATION_SAMPLING_TRIES = 100;
+		/// thermal-mask calibration: helper for sampling of candidate
+		/// parameters around the given parameters
+		void sampleThermalMaskParameters(ThermalAnalyzer::MaskParameters& candidate, ThermalAnalyzer::MaskParameters const& parameters, double const& std_dev_scale) const;
 
 		/// time logging
 		struct timeb time_start;
@@ -157,6 +199,8 @@ class FloorPlanner {
 		/// logging
 		int log;
 		/// logging
+		static constexpr int LOG_NONE = 0;
+		/// logging
 		static constexpr int LOG_MINIMAL = 1;
 		/// logging
 		static constexpr int LOG_MEDIUM = 2;
@@ -173,8 +217,149 @@ class FloorPlanner {
 
 			/// SA parameters: temperature-scaling factors
 			double temp_factor_phase1, temp_factor_phase1_limit, temp_factor_phase2, temp_factor_phase3;
+
+			/// SA parameters: parallel tempering; count of replicas, each
+			/// annealed in its own thread
+			int PT_replicas;
+
+			/// SA parameters: batched evaluation; count of candidate layout
+			/// operations, each evaluated in its own thread
+			int batch_size;
+
+			/// SA parameters: seed for random-number generator; time-based
+			/// seed if not given
+			std::uint64_t seed;
 		} schedule;
 
+		/// SA parameters: multi-resolution thermal analysis, i.e., thermal-map
+		/// dimensions tied to the cooling phases; parsed in
+		/// IO::parseParametersFiles
+		struct thermal_schedule {
+			/// thermal-map dimensions for cooling phases 1, 2 and 3; the
+			/// latter is the regular dimension, also used for finalization
+			std::array<unsigned, 3> map_dims;
+			/// thermal-mask dimension related to the regular map dimension
+			unsigned mask_dim;
+			/// currently applied level, i.e., index into map_dims
+			unsigned level;
+			/// 3D thermal analysis applied for thermal cost, instead of power
+			/// blurring; only for late SA phases, see applyThermalSolver
+			bool solver;
+			/// 3D thermal analysis: ratios of thermal cost and of max temp, w/
+			/// 3D thermal analysis over w/ power blurring, for the last
+			/// accepted layout; the thermal cost of candidate layouts is
+			/// estimated by power blurring, scaled by these ratios, whereas
+			/// the 3D thermal analysis is only performed for accepted layouts,
+			/// see acceptThermalSolver
+			double solver_ratio_cost, solver_ratio_max_temp;
+		} thermal_schedule;
+
+		/// SA parallel tempering: run mode; represents replicas which are
+		/// annealed alongside the master instance, replicas neither log nor
+		/// write any files
+		bool replica;
+
+		/// SA parallel tempering: handler for synchronization and replica
+		/// exchange, shared by all replicas
+		struct PTHandler {
+			std::mutex mutex;
+			std::condition_variable barrier;
+			unsigned arrived, generation;
+
+			/// instances of all replicas, indexed by replica id
+			std::vector<FloorPlanner*> instances;
+
+			/// per-replica state, as of last synchronization
+			std::vector<double> cost, temp;
+			/// per-replica state, as of last synchronization
+			std::vector<bool> SA_phase_two;
+
+			/// initial sampling; performed once by the master instance, such
+			/// that all replicas anneal along the same temperature ladder
+			std::vector<double> cost_samples;
+			/// initial sampling; initial temperature of the master replica
+			double init_temp;
+
+			/// shared cost normalization; the max cost values of the reference
+			/// replica, i.e., the first replica to reach SA phase two, are
+			/// adopted by all other replicas in SA phase two, such that the
+			/// replicas' cost are comparable for exchanges
+			FloorPlanner* reference;
+			/// shared cost normalization; per-replica flag whether the shared
+			/// max cost values are adopted already
+			///
+			/// note that std::vector<bool> is not applicable for concurrent
+			/// writes
+			std::vector<char> normalized;
+
+			/// shared thermal schedule; thermal-map level and 3D thermal
+			/// analysis as requested by each replica, applied to all replicas
+			/// w/ the next synchronization
+			std::vector<unsigned> thermal_level;
+			/// shared thermal schedule
+			std::vector<char> thermal_solver;
+			/// shared thermal schedule; the most refined level requested by any
+			/// replica, and whether 3D thermal analysis is requested by any
+			/// replica
+			unsigned thermal_level_shared;
+			/// shared thermal schedule
+			bool thermal_solver_shared;
+			/// shared thermal schedule; ratio of each replica's thermal cost w/
+			/// the new and the previous thermal analysis, 0.0 if not applicable
+			std::vector<double> thermal_ratio;
+
+			/// count of exchange rounds; exchanges alternate between even and
+			/// odd pairs of replicas
+			unsigned rounds;
+
+			/// statistics
+			unsigned exchanges_attempted, exchanges_accepted;
+
+			/// random-number generator for exchanges; separate from the
+			/// replicas' generators since the exchanges are performed by
+			/// whichever replica arrives last
+			Math::RNG rng;
+
+			PTHandler(unsigned const& replicas) :
+				arrived(0), generation(0),
+				instances(replicas, nullptr),
+				cost(replicas, 0.0), temp(replicas, 0.0), SA_phase_two(replicas, false),
+				init_temp(0.0), reference(nullptr), normalized(replicas, false),
+				thermal_level(replicas, 0), thermal_solver(replicas, false), thermal_level_shared(0), thermal_solver_shared(false),
+				thermal_ratio(replicas, 0.0),
+				rounds(0),
+				exchanges_attempted(0), exchanges_accepted(0) {
+
+				// the stream following the replicas' streams
+				this->rng.seed(Math::randSeed(), replicas);
+			};
+		};
+
+		/// SA parallel tempering: upper limit for staggering the replicas'
+		/// temperatures; the hottest replica starts at this factor times the
+		/// initial temperature, the others are geometrically spaced in between
+		static constexpr double SA_PT_TEMP_STAGGER_MAX = 10.0;
+
+		/// SA parallel tempering: barrier for all replicas; the handler is
+		/// performed by the last replica to arrive, while all other replicas
+		/// are waiting
+		static void synchronizeReplicas(PTHandler& PT, std::function<void()> const& handler);
+
+		/// SA parallel tempering: synchronization and replica exchange; to be
+		/// called by all replicas after each temperature step; also applies the
+		/// shared cost normalization and the shared thermal schedule, and
+		/// re-evaluates the current layout (and the best layout, if required)
+		/// accordingly
+		/// note that thermal_level, cur_cost, best_cost and cur_temp are
+		/// return-by-reference
+		void exchangeReplicas(PTHandler& PT, unsigned const& replica, CorblivarCore& corb, double const& fitting_layouts_ratio, bool const& SA_phase_two,
+				bool const& thermal_solver, unsigned& thermal_level, double& cur_cost, double& best_cost, double& cur_temp);
+
+		/// SA parallel tempering and batched evaluation: set up another
+		/// instance from the same program parameters, see main(); the related
+		/// CorblivarCore is returned-by-reference
+		static void initReplica(FloorPlanner& fp, std::unique_ptr<CorblivarCore>& corb, int const& argc, char** argv);
+
 		/// SA parameters: optimization flags
 		struct opt_flags {
 			bool thermal, interconnects, routing_util, alignment, voltage_assignment, timing, alignment_WL_estimate, thermal_leakage;
@@ -191,6 +376,19 @@ class FloorPlanner {
 		double max_cost_thermal, max_cost_WL, max_cost_alignments, max_cost_routing_util, max_cost_timing, max_cost_voltage_assignment, max_cost_thermal_leakage;
 		int max_cost_TSVs;
 
+		/// SA cost variables: adopt max cost values of other instance, for same
+		/// normalization of cost terms
+		inline void adoptMaxCost(FloorPlanner const& other) {
+			this->max_cost_thermal = other.max_cost_thermal;
+			this->max_cost_WL = other.max_cost_WL;
+			this->max_cost_alignments = other.max_cost_alignments;
+			this->max_cost_routing_util = other.max_cost_routing_util;
+			this->max_cost_timing = other.max_cost_timing;
+			this->max_cost_voltage_assignment = other.max_cost_voltage_assignment;
+			this->max_cost_thermal_leakage = other.max_cost_thermal_leakage;
+			this->max_cost_TSVs = other.max_cost_TSVs;
+		};
+
 		/// SA cost; POD declaration
 		struct Cost {
 			double total_cost;
@@ -260,6 +458,94 @@ class FloorPlanner {
 		void evaluateAreaOutline(Cost& cost,
 				double const& fitting_layouts_ratio = 0.0,
 				bool const& SA_phase_two = false) const;
+		/// SA: incremental evaluation of interconnects; blocks' placement as of
+		/// previous evaluation, and blocks moved since then
+		struct interconnects_cache {
+			bool valid;
+			LayoutState layout;
+			std::vector<bool> blocks_moved;
+		} interconnects_cache;
+
+		/// SA: concurrent evaluation of interconnects; buffers kept for all
+		/// evaluations
+		struct interconnects_buffers {
+			/// nets to be re-evaluated; note that std::vector<bool> is not
+			/// applicable for concurrent writes
+			std::vector<char> nets_dirty;
+			/// nets' bounding boxes after clustering; the boxes of each net
+			/// are stored consecutively, one for each of its layers, starting
+			/// at the net's offset
+			std::vector<Rect> nets_bbs;
+			std::vector<unsigned> nets_bbs_offsets;
+			/// contributions to routing-utilization maps, separately for each
+			/// layer and in the order of nets; the maps are adapted for all
+			/// layers concurrently, w/ the same order of summation as for
+			/// sequential evaluation
+			struct UtilContribution {
+				Rect bb;
+				double weight;
+			};
+			std::vector< std::vector<UtilContribution> > util_contributions;
+		} interconnects_buffers;
+
+		/// SA: concurrent evaluation of interconnects; min count of nets per
+		/// thread, and min count of contributions to routing-utilization maps,
+		/// such that small workloads are handled w/o parallelization overhead
+		static constexpr unsigned INTERCONNECTS_NETS_PER_THREAD_MIN = 256;
+		/// SA: concurrent evaluation of thermal leakage; min count of bins
+		/// per layer, such that small maps are handled w/o parallelization
+		/// overhead
+		static constexpr unsigned LEAKAGE_BINS_PER_THREAD_MIN = 256;
+
+		/// SA: concurrent evaluation of interconnects, clustering and thermal
+		/// leakage; workers, kept for all evaluations; only initialized if
+		/// multiple threads are applicable
+		std::unique_ptr<ThermalSolver::Workers> workers;
+
+		/// SA: concurrent evaluation; count of threads available to this
+		/// instance, such that the cores are shared w/ concurrently running
+		/// replicas and batch workers
+		unsigned availableThreads() const;
+		/// SA: concurrent evaluation; getter for workers, initialized on
+		/// demand w/ all available threads
+		ThermalSolver::Workers& editWorkers();
+		/// SA: concurrent evaluation of interconnects; count of threads, such
+		/// that each thread handles a reasonable count of nets
+		unsigned interconnectsThreads() const;
+		/// SA: concurrent evaluation of interconnects; applies the handler to
+		/// contiguous ranges of nets, one range per thread
+		void evaluateNetsConcurrently(std::function<void(unsigned const& first, unsigned const& last)> const& handler);
+		/// SA: concurrent evaluation of interconnects; adapts the
+		/// routing-utilization maps by all memorized contributions
+		void applyUtilContributions();
+
+		/// SA batched evaluation: worker instances, set up like replicas; each
+		/// worker evaluates one candidate layout operation per batch
+		struct batch {
+			std::vector<std::unique_ptr<FloorPlanner>> fp;
+			std::vector<std::unique_ptr<CorblivarCore>> corb;
+			/// threads evaluating the candidates, one per worker; kept for
+			/// all batches
+			std::unique_ptr<ThermalSolver::Workers> threads;
+
+			/// statistics
+			unsigned batches, accepted;
+		} batch;
+
+		/// SA batched evaluation: hand over the current state relevant for
+		/// layout evaluation, i.e., die outline, terminal pins, max cost values
+		/// and thermal-map dimensions, to the given worker
+		void syncBatchWorker(FloorPlanner& worker) const;
+
+		/// SA batched evaluation: propose candidate layout operations from the
+		/// current layout, evaluate them concurrently by the workers, and apply
+		/// the best candidate w/ Metropolis acceptance; returns false if no
+		/// candidate operation could be performed at all
+		/// note that cost and accept are return-by-reference; cost is only
+		/// valid for accepted candidates
+		bool performLayoutOpsBatch(CorblivarCore& corb, int const& layout_fit_counter, bool const& SA_phase_two, bool const& cooling_phase_three,
+				double const& fitting_layouts_ratio, double const& cur_temp, double const& cur_cost, Cost& cost, bool& accept);
+
 		/// SA: cost functions, i.e., layout-evaluations
 		void evaluateInterconnects(Cost& cost, double const& frequency,
 				std::vector<CorblivarAlignmentReq> const& alignments,
@@ -286,6 +572,7 @@ class FloorPlanner {
 			double avg_cost;
 			bool new_best_sol_found;
 			double cost_best_sol;
+			unsigned thermal_map_dim;
 		};
 
 		/// SA-related temperature phase; POD declaration
@@ -320,12 +607,59 @@ class FloorPlanner {
 		///
 		static constexpr unsigned FP_AREA_RATIO_LIMIT = 50;
 
-		/// SA: init helper
+		/// SA: init helper; the initial sampling, which determines the initial
+		/// temperature, is only performed if sampling is set
 		/// note that various parameters are return-by-reference
-		void initSA(CorblivarCore& corb, std::vector<double>& cost_samples, int& innerLoopMax, double& init_temp);
+		void initSA(CorblivarCore& corb, std::vector<double>& cost_samples, int& innerLoopMax, double& init_temp, bool const& sampling = true);
 		/// SA: helper for annealing schedule
 		/// note that various parameters are return-by-reference
 		TempPhase updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const;
+		/// SA: helper for multi-resolution thermal analysis; (re-)initializes
+		/// the thermal analyzer for the given level of the thermal schedule;
+		/// for renormalize, the ratio of the current layout's thermal cost w/
+		/// the new and the previous maps is returned, 1.0 otherwise; scaling the
+		/// max thermal cost by this ratio retains the normalized thermal cost of
+		/// the current layout
+		double applyThermalSchedule(unsigned const& level, bool const& renormalize);
+		/// SA: helper for 3D thermal analysis during late SA phases; switches
+		/// the thermal cost from power blurring to 3D thermal analysis; the
+		/// ratio of the current layout's thermal cost w/ 3D thermal analysis and
+		/// w/ power blurring is returned, for re-normalization of the max
+		/// thermal cost, see applyThermalSchedule
+		double applyThermalSolver();
+		/// SA: helper for 3D thermal analysis during late SA phases; to be
+		/// called for accepted layouts, i.e., w/ cost of the current layout as
+		/// determined by evaluateLayout; the estimated thermal cost is replaced
+		/// by the cost from 3D thermal analysis, the ratios for estimation of
+		/// subsequent candidates are updated, and the solution serves as warm
+		/// start
+		void acceptThermalSolver(Cost& cost);
+		/// SA: helper for multi-resolution thermal analysis; thermal cost of
+		/// current layout, considering only the blocks' power and TSVs
+		inline double determineThermalCostBlocks() {
+			ThermalSolver::Result result;
+
+			this->thermalAnalyzer.generatePowerMaps(this->IC.layers, this->blocks,
+					this->getOutline(), this->power_blurring_parameters);
+			this->thermalAnalyzer.adaptPowerMapsTSVs(this->IC.layers, this->TSVs, this->dummy_TSVs, this->power_blurring_parameters);
+			this->thermalAnalyzer.performPowerBlurring(this->thermal_analysis, this->IC.layers,
+					this->power_blurring_parameters);
+
+			// 3D thermal analysis, if applied; cost as for power blurring; the
+			// current layout serves as reference for estimation of candidates'
+			// thermal cost, see acceptThermalSolver
+			if (this->thermal_schedule.solver) {
+				this->solveThermal(result, std::vector<Block>(), this->thermalSolver.parameters.SA_tolerance, true);
+				this->thermalSolver.acceptSolution();
+
+				this->thermal_schedule.solver_ratio_cost = (result.avg_temp * result.max_temp) / this->thermal_analysis.cost_temp;
+				this->thermal_schedule.solver_ratio_max_temp = result.max_temp / this->thermal_analysis.max_temp;
+
+				return result.avg_temp * result.max_temp;
+			}
+
+			return this->thermal_analysis.cost_temp;
+		}
 
 		/// thermal analyzer instance
 		ThermalAnalyzer thermalAnalyzer;
@@ -340,6 +674,19 @@ class FloorPlanner {
 		// (TODO) encapsulate in thermalAnalyzer
 		ThermalAnalyzer::ThermalAnalysisResult thermal_analysis;
 
+		/// 3D thermal solver instance; steady-state analysis of the final
+		/// solution, as in-process reference for power blurring and HotSpot,
+		/// and thermal cost during late SA phases, if configured
+		ThermalSolver thermalSolver;
+		/// 3D thermal solver: helper; solves the current layout w/ the given
+		/// tolerance, where the solver is (re-)initialized for the current
+		/// thermal-map dimensions and die outline, if required
+		void solveThermal(ThermalSolver::Result& result, std::vector<Block> const& wires,
+				double const& tolerance, bool const& warm_start);
+		/// 3D thermal solver: handler; solves the current layout, compares the
+		/// result to power blurring, and logs both
+		void evaluateThermalSolver();
+
 		/// instance for thermal-related leakage analyzer
 		LeakageAnalyzer leakageAnalyzer;
 
@@ -362,16 +709,36 @@ class FloorPlanner {
 	public:
 		/// default constructor
 		FloorPlanner() {
+			// by default, no replica but master instance
+			this->replica = false;
+
+			// no interconnects evaluated yet
+			this->interconnects_cache.valid = false;
+
+			// no batches evaluated yet
+			this->batch.batches = this->batch.accepted = 0;
+
+			// by default, regular thermal-map dimensions for all cooling
+			// phases
+			this->thermal_schedule.map_dims.fill(ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT);
+			this->thermal_schedule.mask_dim = ThermalAnalyzer::THERMAL_MASK_DIM_DEFAULT;
+			this->thermal_schedule.level = 2;
+			this->thermal_schedule.solver = false;
+			this->thermal_schedule.solver_ratio_cost = this->thermal_schedule.solver_ratio_max_temp = 1.0;
+
 			// memorize start time
 			ftime(&(this->time_start));
-
-			// init random number generator
-			srand(time(0));
 		}
 
+		/// destructor; defined along w/ the SA handlers, since the batch
+		/// workers require the full CorblivarCore declaration
+		~FloorPlanner();
+
 	// public data, functions
 	public:
 		friend class IO;
+		/// microbenchmark for voltage assignment, see src_aux
+		friend class VoltageAssignmentBenchmark;
 
 		/// logging
 		inline bool logMin() const {
@@ -410,6 +777,9 @@ class FloorPlanner {
 		/// RoutingUtilization: handler
 		inline void initRoutingUtilAnalyzer() {
 			this->routingUtil.initUtilMaps(this->IC.layers, this->getOutline());
+
+			// maps are reset, thus full evaluation of interconnects required
+			this->interconnects_cache.valid = false;
 		}
 
 		/// getter
@@ -514,6 +884,7 @@ class FloorPlanner {
 
 				// and the routing-estimation maps have to be reset as well
 				this->routingUtil.initUtilMaps(this->IC.layers, this->getOutline());
+				this->interconnects_cache.valid = false;
 
 				// reset related die properties
 				this->IC.die_AR = this->IC.outline_x / this->IC.outline_y;
@@ -550,6 +921,10 @@ class FloorPlanner {
 				pin.bb.ur.x = pin.bb.ll.x;
 				pin.bb.ur.y = pin.bb.ll.y;
 			}
+
+			// nets' bounding boxes may change along w/ pins, thus full
+			// evaluation of interconnects required
+			this->interconnects_cache.valid = false;
 		}
 
 		/// file helper
@@ -558,8 +933,35 @@ class FloorPlanner {
 			return this->IO_conf.solution_in.is_open();
 		};
 
+		/// getter
+		inline bool const& thermalCalibrationRun() const {
+			return this->thermal_calibration_run;
+		};
+
+		/// getter
+		inline int const& getSAReplicas() const {
+			return this->schedule.PT_replicas;
+		};
+
+		/// SA batched evaluation: init handler; sets up the workers, only if
+		/// batched evaluation is configured
+		void initBatchEvaluation(int const& argc, char** argv);
+
 		/// SA: main handler
-		bool performSA(CorblivarCore& corb);
+		/// note that PT and replica parameters are only to be given for parallel
+		/// tempering, see performParallelTemperingSA
+		bool performSA(CorblivarCore& corb, PTHandler* PT = nullptr, unsigned const& replica = 0);
+		/// SA: main handler for parallel tempering, i.e., multiple SA replicas
+		/// annealed concurrently at staggered temperatures w/ replica exchange;
+		/// the replicas are set up from the same program parameters, the best
+		/// solution across all replicas is finally handed over to corb
+		bool performParallelTemperingSA(CorblivarCore& corb, int const& argc, char** argv);
+		/// thermal-mask calibration: main handler; fits the thermal-mask
+		/// parameters against the reference thermal map, for the layout given
+		/// by corb; candidate parameters are evaluated concurrently; the fitted
+		/// parameters are written out but not applied
+		void calibrateThermalMasks(CorblivarCore& corb);
+
 		/// SA: finalize handler
 		void finalize(CorblivarCore& corb, bool const& determ_overall_cost = true, bool const& handle_corblivar = true);
 };
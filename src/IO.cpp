@@ -30,6 +30,10 @@
 /// parse program parameter, config file, and further files
 void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	int file_version;
+	int thermal_map_dim, thermal_mask_dim, util_maps_dim;
+	int thermal_map_dim_phase1, thermal_map_dim_phase2;
+	int calibration_iterations, calibration_candidates;
+	int thermal_solver_threads;
 	size_t last_slash;
 	std::ifstream in;
 	std::string config_file, technology_file;
@@ -49,26 +53,37 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 	// print command-line parameters
 	if (argc < 4) {
-		std::cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density]" << std::endl;
+		std::cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density] [thermal_reference_file]" << std::endl;
 		std::cout << "IO> " << std::endl;
 		std::cout << "IO> Mandatory parameter ``benchmark_name'': any name, should be same as benchmark's files names" << std::endl;
 		std::cout << "IO> Mandatory parameter ``config_file'' format: see provided Corblivar.conf" << std::endl;
 		std::cout << "IO> Mandatory parameter ``benchmarks_dir'': folder containing actual benchmark files" << std::endl;
 		std::cout << "IO> Optional parameter ``solution_file'': re-evaluate w/ given Corblivar solution" << std::endl;
 		std::cout << "IO> Optional parameter ``TSV density'': average TSV density to be considered across all dies, to be given in \%" << std::endl;
+		std::cout << "IO> Optional parameter ``thermal_reference_file'': calibrate thermal-mask parameters against given thermal map of lowest die, e.g., HotSpot's *_HotSpot.steady.grid.gp_data.layer_1" << std::endl;
 
 		exit(1);
 	}
 
 	// TSV density given; note special run mode where only thermal-analysis result is
 	// output, not all other (time-consuming) date
-	if (argc == 6) {
+	if (argc >= 6) {
 		fp.thermal_analyser_run = true;
 	}
 	else {
 		fp.thermal_analyser_run = false;
 	}
 
+	// reference thermal map given; special run mode where thermal-mask parameters are
+	// calibrated, in addition to the thermal-analyser run
+	if (argc == 7) {
+		fp.thermal_calibration_run = true;
+		fp.IO_conf.thermal_reference_file = argv[6];
+	}
+	else {
+		fp.thermal_calibration_run = false;
+	}
+
 	// initially assume benchmark not to be in GATech format/syntax
 	fp.IO_conf.GT_benchmark = false;
 
@@ -92,8 +107,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	nets_file << argv[3] << fp.benchmark << ".nets";
 	fp.IO_conf.nets_file = nets_file.str();
 
-	results_file << fp.benchmark << ".results";
-	fp.IO_conf.results.open(results_file.str().c_str());
+	// replicas (for parallel tempering) shall not overwrite the master's results
+	if (!fp.replica) {
+		results_file << fp.benchmark << ".results";
+		fp.IO_conf.results.open(results_file.str().c_str());
+	}
 
 	GT_fp_file << argv[3] << fp.benchmark << ".fpi";
 	fp.IO_conf.GT_fp_file = GT_fp_file.str();
@@ -114,8 +132,14 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		technology_file = config_file.substr(0, last_slash) + "/";
 	}
 
-	// assume minimal log level; actual level to be parsed later on
-	fp.log = FloorPlanner::LOG_MINIMAL;
+	// assume minimal log level; actual level to be parsed later on; replicas (for
+	// parallel tempering) don't log at all
+	if (fp.replica) {
+		fp.log = FloorPlanner::LOG_NONE;
+	}
+	else {
+		fp.log = FloorPlanner::LOG_MINIMAL;
+	}
 
 	// test files
 	//
@@ -220,6 +244,17 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		in.close();
 	}
 
+	// reference thermal map; only for calibration runs
+	if (fp.thermal_calibration_run) {
+		in.open(fp.IO_conf.thermal_reference_file.c_str());
+		if (!in.good()) {
+			std::cout << "IO> ";
+			std::cout << "No such reference thermal-map file: " << fp.IO_conf.thermal_reference_file << std::endl;
+			exit(1);
+		}
+		in.close();
+	}
+
 	// additional command-line parameters
 	//
 	// additional parameter for solution file given; consider file for readin
@@ -235,14 +270,14 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 			exit(1);
 		}
 	}
-	// open new solution file
-	else {
+	// open new solution file; not for replicas
+	else if (!fp.replica) {
 		fp.IO_conf.solution_file = fp.benchmark + ".solution";
 		fp.IO_conf.solution_out.open(fp.IO_conf.solution_file.c_str());
 	}
 
 	// additional parameter for TSV density given, in percent
-	if (argc == 6) {
+	if (argc >= 6) {
 		mask_parameters.TSV_density = atof(argv[5]);
 	}
 	// otherwise assume a setup w/o regularly spread TSVs, i.e., TSV density is zero
@@ -282,6 +317,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		in >> tmpstr;
 	in >> fp.log;
 
+	// replicas don't log, independent of config
+	if (fp.replica) {
+		fp.log = FloorPlanner::LOG_NONE;
+	}
+
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
@@ -358,6 +398,44 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		exit(1);
 	}
 
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.schedule.PT_replicas;
+
+	// sanity check for replicas count
+	if (fp.schedule.PT_replicas < 1) {
+		std::cout << "IO> Provide a positive count of SA replicas, or set 1 to disable parallel tempering!" << std::endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.schedule.batch_size;
+
+	// sanity check for batch size
+	if (fp.schedule.batch_size < 1) {
+		std::cout << "IO> Provide a positive count of candidate ops for batched evaluation, or set 1 to disable batched evaluation!" << std::endl;
+		exit(1);
+	}
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.schedule.seed;
+
+	// time-based seed, if not given
+	if (fp.schedule.seed == 0) {
+		fp.schedule.seed = static_cast<std::uint64_t>(time(0));
+	}
+	// seed random-number generator; replicas are seeded separately, such that
+	// they don't interfere w/ the master's random-number sequence, see
+	// FloorPlanner::performParallelTemperingSA
+	if (!fp.replica) {
+		Math::seedRand(fp.schedule.seed);
+	}
+
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
@@ -665,6 +743,139 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	// store power-blurring parameters
 	fp.power_blurring_parameters = mask_parameters;
 
+	// maps' dimensions
+	//
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> thermal_map_dim;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> thermal_mask_dim;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> thermal_map_dim_phase1;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> thermal_map_dim_phase2;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> util_maps_dim;
+
+	// sanity check for positive, non-zero dimensions
+	if (thermal_map_dim <= 0 || thermal_mask_dim <= 0 || util_maps_dim <= 0) {
+		std::cout << "IO> Provide positive, non-zero dimensions for thermal map, thermal mask, and routing-utilization maps!" << std::endl;
+		exit(1);
+	}
+	// sanity check for uneven mask dimension
+	if (thermal_mask_dim % 2 == 0) {
+		std::cout << "IO> Provide an uneven dimension for the thermal mask!" << std::endl;
+		exit(1);
+	}
+
+	// multi-resolution thermal analysis; zero values refer to the regular dimension
+	if (thermal_map_dim_phase1 == 0) {
+		thermal_map_dim_phase1 = thermal_map_dim;
+	}
+	if (thermal_map_dim_phase2 == 0) {
+		thermal_map_dim_phase2 = thermal_map_dim;
+	}
+
+	// sanity check for refining thermal-map dimensions
+	if (
+		thermal_map_dim_phase1 < 0 || thermal_map_dim_phase2 < 0 ||
+		thermal_map_dim_phase1 > thermal_map_dim_phase2 || thermal_map_dim_phase2 > thermal_map_dim
+	   ) {
+		std::cout << "IO> Provide positive thermal-map dimensions for the cooling phases, which are not decreasing over the phases and not larger than the regular dimension!" << std::endl;
+		exit(1);
+	}
+
+	// store maps' dimensions
+	fp.thermalAnalyzer.setMapDimensions(thermal_map_dim, thermal_mask_dim);
+	fp.routingUtil.util_maps_dim = util_maps_dim;
+	fp.thermal_schedule.map_dims = {{
+		static_cast<unsigned>(thermal_map_dim_phase1),
+		static_cast<unsigned>(thermal_map_dim_phase2),
+		static_cast<unsigned>(thermal_map_dim)
+	}};
+	fp.thermal_schedule.mask_dim = thermal_mask_dim;
+	fp.thermal_schedule.level = 2;
+
+	// thermal-mask calibration
+	//
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> calibration_iterations;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> calibration_candidates;
+
+	// sanity check for positive, non-zero parameters
+	if (calibration_iterations < 1 || calibration_candidates < 1) {
+		std::cout << "IO> Provide positive, non-zero counts of calibration iterations and candidates!" << std::endl;
+		exit(1);
+	}
+
+	// store calibration parameters
+	fp.thermal_calibration.iterations = calibration_iterations;
+	fp.thermal_calibration.candidates = calibration_candidates;
+
+	// 3D thermal analysis
+	//
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.thermalSolver.parameters.enabled;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> thermal_solver_threads;
+
+	// sanity check for positive, non-zero threads
+	if (thermal_solver_threads < 1) {
+		std::cout << "IO> Provide a positive, non-zero count of threads for the 3D thermal analysis!" << std::endl;
+		exit(1);
+	}
+
+	fp.thermalSolver.parameters.threads = thermal_solver_threads;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.thermalSolver.parameters.SA;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.thermalSolver.parameters.SA_progress;
+
+	in >> tmpstr;
+	while (tmpstr != "value" && !in.eof())
+		in >> tmpstr;
+	in >> fp.thermalSolver.parameters.SA_tolerance;
+
+	// sanity checks for SA progress and convergence criterion
+	if (fp.thermalSolver.parameters.SA_progress < 0.0 || fp.thermalSolver.parameters.SA_progress > 1.0) {
+		std::cout << "IO> Provide an SA progress within [0, 1] for the 3D thermal analysis!" << std::endl;
+		exit(1);
+	}
+	if (fp.thermalSolver.parameters.SA_tolerance <= 0.0) {
+		std::cout << "IO> Provide a positive, non-zero convergence criterion for the 3D thermal analysis during SA!" << std::endl;
+		exit(1);
+	}
+
 	in.close();
 
 	// technology file parsing
@@ -1008,6 +1219,9 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		// SA loop setup
 		std::cout << "IO>  SA -- Inner-loop operation-factor a (ops = N^a for N blocks): " << fp.schedule.loop_factor << std::endl;
 		std::cout << "IO>  SA -- Outer-loop upper limit: " << fp.schedule.loop_limit << std::endl;
+		std::cout << "IO>  SA -- Parallel tempering; replicas count: " << fp.schedule.PT_replicas << std::endl;
+		std::cout << "IO>  SA -- Batched evaluation; candidate ops per batch: " << fp.schedule.batch_size << std::endl;
+		std::cout << "IO>  SA -- Seed for random-number generator: " << fp.schedule.seed << std::endl;
 
 		// SA cooling schedule
 		std::cout << "IO>  SA -- Start temperature scaling factor: " << fp.schedule.temp_init_factor << std::endl;
@@ -1054,6 +1268,18 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		std::cout << "IO>  Power-blurring mask parameterization -- Power-density scaling factor (padding zone): " << mask_parameters.power_density_scaling_padding_zone << std::endl;
 		std::cout << "IO>  Power-blurring mask parameterization -- Power-density down-scaling factor (TSV regions): " << mask_parameters.power_density_scaling_TSV_region << std::endl;
 		std::cout << "IO>  Power-blurring mask parameterization -- Temperature offset: " << mask_parameters.temp_offset << std::endl;
+		std::cout << "IO>  Power blurring -- Dimension of thermal map and power maps: " << fp.thermalAnalyzer.dims.thermal_map << std::endl;
+		std::cout << "IO>  Power blurring -- Dimension of thermal mask: " << fp.thermalAnalyzer.dims.thermal_mask << std::endl;
+		std::cout << "IO>  Power blurring -- Dimension of thermal map during cooling phase 1: " << fp.thermal_schedule.map_dims[0] << std::endl;
+		std::cout << "IO>  Power blurring -- Dimension of thermal map during cooling phase 2: " << fp.thermal_schedule.map_dims[1] << std::endl;
+		std::cout << "IO>  Routing utilization -- Dimension of utilization maps: " << fp.routingUtil.util_maps_dim << std::endl;
+		std::cout << "IO>  Thermal-mask calibration -- Iterations: " << fp.thermal_calibration.iterations << std::endl;
+		std::cout << "IO>  Thermal-mask calibration -- Candidates per iteration: " << fp.thermal_calibration.candidates << std::endl;
+		std::cout << "IO>  3D thermal analysis -- Analysis of final solution: " << fp.thermalSolver.parameters.enabled << std::endl;
+		std::cout << "IO>  3D thermal analysis -- Threads: " << fp.thermalSolver.parameters.threads << std::endl;
+		std::cout << "IO>  3D thermal analysis -- Thermal cost during late SA phases: " << fp.thermalSolver.parameters.SA << std::endl;
+		std::cout << "IO>  3D thermal analysis -- SA progress for thermal cost: " << fp.thermalSolver.parameters.SA_progress << std::endl;
+		std::cout << "IO>  3D thermal analysis -- Convergence criterion for SA: " << fp.thermalSolver.parameters.SA_tolerance << std::endl;
 
 		std::cout << std::endl;
 	}
@@ -1177,6 +1403,73 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 	}
 }
 
+/// parse reference thermal map of lowest die, for thermal-mask calibration; the file
+/// syntax follows HotSpot's grid data as prepared for gnuplot, see IO::writeMaps
+void IO::parseThermalReference(FloorPlanner& fp) {
+	std::ifstream in;
+	std::string line;
+	int x, y;
+	double temp;
+	unsigned bins;
+	int const dim = fp.thermalAnalyzer.dims.thermal_map;
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Parsing reference thermal map ..." << std::endl;
+	}
+
+	in.open(fp.IO_conf.thermal_reference_file.c_str());
+
+	// init map; bins not covered by the file are marked by negative temperatures
+	fp.thermal_calibration.reference.resize(dim, dim, -1.0);
+
+	// parse file
+	//
+	// syntax: X Y TEMP; comment lines and empty lines are ignored, such that
+	// Corblivar's own thermal maps may serve as reference as well
+	bins = 0;
+	while (std::getline(in, line)) {
+
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+
+		std::istringstream line_in(line);
+		if (!(line_in >> x >> y >> temp)) {
+			continue;
+		}
+
+		// drop the dummy data points, inserted for gnuplot
+		if (x == dim || y == dim) {
+			continue;
+		}
+
+		// sanity check for dimensions
+		if (x < 0 || x > dim || y < 0 || y > dim) {
+			std::cout << "IO> Parsing error: reference thermal map contains bin (" << x << ", " << y << "); thermal map is set for " << dim << " x " << dim << " bins!" << std::endl;
+			exit(1);
+		}
+
+		if (fp.thermal_calibration.reference[x][y] < 0.0) {
+			bins++;
+		}
+		fp.thermal_calibration.reference[x][y] = temp;
+	}
+
+	in.close();
+
+	// sanity check for complete map
+	if (bins != fp.thermal_calibration.reference.size()) {
+		std::cout << "IO> Parsing error: reference thermal map contains " << bins << " bins; thermal map is set for " << dim << " x " << dim << " bins!" << std::endl;
+		exit(1);
+	}
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done; parsed " << bins << " bins" << std::endl << std::endl;
+	}
+}
+
 /// parse alignment-requests file
 void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments) {
 	std::ifstream al_in;
@@ -1357,11 +1650,22 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 			}
 		}
 
-		// memorize pointer to vertical-bus requests
+		// memorize pointer to requests, for lookup of requests covering a
+		// block during layout generation; note that RBOD is not considered
+		// since layout generation is never handling RBOD as current block
 		//
 		// link pointer to blocks only now, i.e., after all blocks are handled;
 		// otherwise, some new alignments will trigger reallocation of alignments
 		// vector and thus invalidate previous pointer
+		if (req.s_i != &fp.RBOD) {
+			req.s_i->alignments.push_back(&req);
+		}
+		// requests covering the same block twice are memorized only once
+		if (req.s_j != &fp.RBOD && req.s_j != req.s_i) {
+			req.s_j->alignments.push_back(&req);
+		}
+
+		// memorize pointer to vertical-bus requests
 		if (req.vertical_bus()) {
 
 			if (req.s_i != &fp.RBOD) {
@@ -2220,6 +2524,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 	// flag == 3: generate TSV-density map
 	// flag == 4: generate original power maps (not padded, not adapted)
 	// flag == 5: generate routing-utilization map
+	// flag == 6: generate thermal maps using 3D thermal-analysis results
 	//
 	// for regular runs, generate all sets; for thermal-analyzer runs, only generate
 	// the required thermal map
@@ -2240,14 +2545,20 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 		flag_stop = MAPS_FLAGS::POWER_ORIG;
 	}
 	//
-	// actual map generation	
-	for (flag = flag_start; flag <= flag_stop; flag++) {
+	// actual map generation; the thermal maps from the 3D thermal analysis are
+	// generated in addition, if available
+	for (flag = flag_start; flag <= MAPS_FLAGS::THERMAL_SOLVER; flag++) {
+
+		if (flag > flag_stop && !(flag == MAPS_FLAGS::THERMAL_SOLVER && !fp.thermalSolver.thermal_maps.empty() && flag_parameter == -1)) {
+			continue;
+		}
 
 		// thermal map (power blurring) only for layer 0
 		if (flag == MAPS_FLAGS::THERMAL) {
 			layer_limit = 1;
 		}
-		// power, thermal (HotSpot), routing-utilization and TSV-density maps for all layers
+		// power, thermal (HotSpot, 3D thermal analysis), routing-utilization and
+		// TSV-density maps for all layers
 		else {
 			layer_limit = fp.IC.layers;
 		}
@@ -2288,6 +2599,10 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 				gp_out_name << fp.benchmark << benchmark_suffix << "_" << cur_layer + 1 << "_routing_util.gp";
 				data_out_name << fp.benchmark << benchmark_suffix << "_" << cur_layer + 1 << "_routing_util.data";
 			}
+			else if (flag == MAPS_FLAGS::THERMAL_SOLVER) {
+				gp_out_name << fp.benchmark << benchmark_suffix << "_" << cur_layer + 1 << "_thermal_solver.gp";
+				data_out_name << fp.benchmark << benchmark_suffix << "_" << cur_layer + 1 << "_thermal_solver.data";
+			}
 
 			// init file stream for gnuplot script
 			gp_out.open(gp_out_name.str().c_str());
@@ -2301,7 +2616,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 			if (flag == MAPS_FLAGS::POWER || flag == MAPS_FLAGS::POWER_ORIG) {
 				data_out << "# X Y power" << std::endl;
 			}
-			else if (flag == MAPS_FLAGS::THERMAL) {
+			else if (flag == MAPS_FLAGS::THERMAL || flag == MAPS_FLAGS::THERMAL_SOLVER) {
 				data_out << "# X Y thermal" << std::endl;
 			}
 			else if (flag == MAPS_FLAGS::TSV_DENSITY) {
@@ -2314,21 +2629,21 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 			// output grid values for power maps
 			if (flag == MAPS_FLAGS::POWER) {
 
-				for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x][y].power_density << std::endl;
+				for (x = 0; x < fp.thermalAnalyzer.dims.power_maps; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.dims.power_maps; y++) {
+						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x][y] << std::endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::POWER_MAPS_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.thermalAnalyzer.dims.power_maps << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-					data_out << ThermalAnalyzer::POWER_MAPS_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.thermalAnalyzer.dims.power_maps; y++) {
+					data_out << fp.thermalAnalyzer.dims.power_maps << "	" << y << "	" << "0.0" << std::endl;
 				}
 
 			}
@@ -2336,21 +2651,21 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 			else if (flag == MAPS_FLAGS::POWER_ORIG) {
 
 				// not padded, dimensions like thermal map
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.dims.thermal_map; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.dims.thermal_map; y++) {
 						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps_orig[cur_layer][x][y].power_density << std::endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.thermalAnalyzer.dims.thermal_map << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.thermalAnalyzer.dims.thermal_map; y++) {
+					data_out << fp.thermalAnalyzer.dims.thermal_map << "	" << y << "	" << "0.0" << std::endl;
 				}
 
 			}
@@ -2359,8 +2674,8 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 				max_temp = 0.0;
 				min_temp = 1.0e6;
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.dims.thermal_map; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.dims.thermal_map; y++) {
 						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.thermal_map[x][y].temp << std::endl;
 						// also track max and min temp
 						max_temp = std::max(max_temp, fp.thermalAnalyzer.thermal_map[x][y].temp);
@@ -2368,61 +2683,83 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.thermalAnalyzer.dims.thermal_map << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.thermalAnalyzer.dims.thermal_map; y++) {
+					data_out << fp.thermalAnalyzer.dims.thermal_map << "	" << y << "	" << "0.0" << std::endl;
 				}
 			}
 			// output grid values for TSV-density maps; consider only bin bins
 			// w/in die outline, not in padded zone
 			else if (flag == MAPS_FLAGS::TSV_DENSITY) {
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.dims.thermal_map; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.dims.thermal_map; y++) {
 						// access map bins w/ offset related to
 						// padding zone
-						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.power_maps[cur_layer][x + ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y + ThermalAnalyzer::POWER_MAPS_PADDED_BINS].TSV_density << std::endl;
+						data_out << x << "	" << y << "	" << fp.thermalAnalyzer.TSV_density_maps[cur_layer][x + fp.thermalAnalyzer.dims.power_maps_padded_bins][y + fp.thermalAnalyzer.dims.power_maps_padded_bins] << std::endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.thermalAnalyzer.dims.thermal_map << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-					data_out << ThermalAnalyzer::THERMAL_MAP_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.thermalAnalyzer.dims.thermal_map; y++) {
+					data_out << fp.thermalAnalyzer.dims.thermal_map << "	" << y << "	" << "0.0" << std::endl;
 				}
 			}
 			// output grid values for routing-utilization maps
 			else if (flag == MAPS_FLAGS::ROUTING) {
 
-				for (x = 0; x < RoutingUtilization::UTIL_MAPS_DIM; x++) {
-					for (y = 0; y < RoutingUtilization::UTIL_MAPS_DIM; y++) {
+				for (x = 0; x < fp.routingUtil.util_maps_dim; x++) {
+					for (y = 0; y < fp.routingUtil.util_maps_dim; y++) {
 						data_out << x << "	" << y << "	" << fp.routingUtil.util_maps[cur_layer][x][y].utilization << std::endl;
 					}
 
 					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
-					data_out << x << "	" << RoutingUtilization::UTIL_MAPS_DIM << "	" << "0.0" << std::endl;
+					data_out << x << "	" << fp.routingUtil.util_maps_dim << "	" << "0.0" << std::endl;
 
 					// blank line marks new row for gnuplot
 					data_out << std::endl;
 				}
 
 				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
-				for (y = 0; y <= RoutingUtilization::UTIL_MAPS_DIM; y++) {
-					data_out << RoutingUtilization::UTIL_MAPS_DIM << "	" << y << "	" << "0.0" << std::endl;
+				for (y = 0; y <= fp.routingUtil.util_maps_dim; y++) {
+					data_out << fp.routingUtil.util_maps_dim << "	" << y << "	" << "0.0" << std::endl;
 				}
 
 			}
+			// output grid values for thermal maps of 3D thermal analysis; note
+			// that this format is also suitable as reference for thermal-mask
+			// calibration, see parseThermalReference
+			else if (flag == MAPS_FLAGS::THERMAL_SOLVER) {
+
+				for (x = 0; x < fp.thermalAnalyzer.dims.thermal_map; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.dims.thermal_map; y++) {
+						data_out << x << "	" << y << "	" << fp.thermalSolver.thermal_maps[cur_layer][x][y] << std::endl;
+					}
+
+					// add dummy data point, required since gnuplot option corners2color cuts last row and column of dataset
+					data_out << x << "	" << fp.thermalAnalyzer.dims.thermal_map << "	" << "0.0" << std::endl;
+
+					// blank line marks new row for gnuplot
+					data_out << std::endl;
+				}
+
+				// add dummy data row, required since gnuplot option corners2color cuts last row and column of dataset
+				for (y = 0; y <= fp.thermalAnalyzer.dims.thermal_map; y++) {
+					data_out << fp.thermalAnalyzer.dims.thermal_map << "	" << y << "	" << "0.0" << std::endl;
+				}
+			}
 
 			// close file stream for data file
 			if (flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
@@ -2436,7 +2773,7 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 			else if (flag == MAPS_FLAGS::POWER_ORIG) {
 				gp_out << "set title \"Power Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
 			}
-			else if (flag == MAPS_FLAGS::THERMAL || flag == MAPS_FLAGS::THERMAL_HOTSPOT) {
+			else if (flag == MAPS_FLAGS::THERMAL || flag == MAPS_FLAGS::THERMAL_HOTSPOT || flag == MAPS_FLAGS::THERMAL_SOLVER) {
 				gp_out << "set title \"Thermal Map - " << fp.benchmark << benchmark_suffix << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
 			}
 			else if (flag == MAPS_FLAGS::TSV_DENSITY) {
@@ -2454,21 +2791,21 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 			// column, since gnuplot option corners2color cuts off last row
 			// and column
 			if (flag == MAPS_FLAGS::POWER) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::POWER_MAPS_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << fp.thermalAnalyzer.dims.power_maps << "]" << std::endl;
+				gp_out << "set yrange [0:" << fp.thermalAnalyzer.dims.power_maps << "]" << std::endl;
 			}
 			// other dimensions, not padded
 			else if (flag == MAPS_FLAGS::POWER_ORIG) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << fp.thermalAnalyzer.dims.thermal_map << "]" << std::endl;
+				gp_out << "set yrange [0:" << fp.thermalAnalyzer.dims.thermal_map << "]" << std::endl;
 			}
-			else if (flag == MAPS_FLAGS::THERMAL	|| flag == MAPS_FLAGS::THERMAL_HOTSPOT || flag == MAPS_FLAGS::TSV_DENSITY) {
-				gp_out << "set xrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << ThermalAnalyzer::THERMAL_MAP_DIM << "]" << std::endl;
+			else if (flag == MAPS_FLAGS::THERMAL	|| flag == MAPS_FLAGS::THERMAL_HOTSPOT || flag == MAPS_FLAGS::THERMAL_SOLVER || flag == MAPS_FLAGS::TSV_DENSITY) {
+				gp_out << "set xrange [0:" << fp.thermalAnalyzer.dims.thermal_map << "]" << std::endl;
+				gp_out << "set yrange [0:" << fp.thermalAnalyzer.dims.thermal_map << "]" << std::endl;
 			}
 			else if (flag == MAPS_FLAGS::ROUTING) {
-				gp_out << "set xrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << std::endl;
-				gp_out << "set yrange [0:" << RoutingUtilization::UTIL_MAPS_DIM << "]" << std::endl;
+				gp_out << "set xrange [0:" << fp.routingUtil.util_maps_dim << "]" << std::endl;
+				gp_out << "set yrange [0:" << fp.routingUtil.util_maps_dim << "]" << std::endl;
 			}
 
 			// power maps
@@ -2488,6 +2825,10 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 				// label for HotSpot results
 				gp_out << "set cblabel \"Temperature [K], from HotSpot\"" << std::endl;
 			}
+			// thermal maps (3D thermal analysis)
+			else if (flag == MAPS_FLAGS::THERMAL_SOLVER) {
+				gp_out << "set cblabel \"Temperature [K], from 3D thermal analysis\"" << std::endl;
+			}
 			// TSV-density maps
 			else if (flag == MAPS_FLAGS::TSV_DENSITY) {
 				// fixed scale
@@ -2531,11 +2872,11 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 			gp_out << "8 \"#7f0000\")" << std::endl;
 
 			// for padded power maps: draw rectangle for unpadded core
-			if (flag == MAPS_FLAGS::POWER && ThermalAnalyzer::POWER_MAPS_PADDED_BINS > 0) {
+			if (flag == MAPS_FLAGS::POWER && fp.thermalAnalyzer.dims.power_maps_padded_bins > 0) {
 				gp_out << "set obj 1 rect from ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", " << ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " to ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << ", ";
-				gp_out << ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS << " ";
+				gp_out << fp.thermalAnalyzer.dims.power_maps_padded_bins << ", " << fp.thermalAnalyzer.dims.power_maps_padded_bins << " to ";
+				gp_out << fp.thermalAnalyzer.dims.power_maps - fp.thermalAnalyzer.dims.power_maps_padded_bins << ", ";
+				gp_out << fp.thermalAnalyzer.dims.power_maps - fp.thermalAnalyzer.dims.power_maps_padded_bins << " ";
 				gp_out << "front fillstyle empty border rgb \"white\" linewidth 3" << std::endl;
 			}
 
@@ -2556,7 +2897,9 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 
 					id = 1;
 
-					for (auto& cur_part : fp.leakageAnalyzer.power_partitions[cur_layer]) {
+					LeakageAnalyzer::PowerPartitions const& power_partitions = fp.leakageAnalyzer.power_partitions[cur_layer];
+
+					for (auto const& cur_part : power_partitions.partitions) {
 
 						// determine random color for each partition, in order to (hopefully) have clear visual separation between adjacent partitions
 						int r,g,b;
@@ -2565,7 +2908,8 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 						g = Math::randI(0, 256);
 						b = Math::randI(0, 256);
 
-						for (auto& bin : cur_part.second) {
+						for (unsigned i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+							LeakageAnalyzer::Bin const& bin = power_partitions.power_values[i];
 
 							gp_out << "set obj " << id << " rect from ";
 							gp_out << bin.x << ", " << bin.y << " to ";
@@ -2590,8 +2934,8 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 
 				// determine scaling factor to map real coordinates to gridded thermal map
 				//
-				double scaling_factor_x = static_cast<double>(ThermalAnalyzer::THERMAL_MAP_DIM) / fp.IC.outline_x;
-				double scaling_factor_y = static_cast<double>(ThermalAnalyzer::THERMAL_MAP_DIM) / fp.IC.outline_y;
+				double scaling_factor_x = static_cast<double>(fp.thermalAnalyzer.dims.thermal_map) / fp.IC.outline_x;
+				double scaling_factor_y = static_cast<double>(fp.thermalAnalyzer.dims.thermal_map) / fp.IC.outline_y;
 
 				// output blocks
 				for (Block const& cur_block : fp.blocks) {
@@ -2615,8 +2959,8 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 
 				id = 1;
 
-				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (x = 0; x < fp.thermalAnalyzer.dims.thermal_map; x++) {
+					for (y = 0; y < fp.thermalAnalyzer.dims.thermal_map; y++) {
 
 						// mark bins belonging to a hotspot region
 						if (fp.thermalAnalyzer.thermal_map[x][y].hotspot_id != ThermalAnalyzer::HOTSPOT_UNDEFINED &&
@@ -2655,12 +2999,13 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 				}
 			}
 
-			// for thermal maps (HotSpot): draw rectangles for floorplan
-			// blocks, which have to scaled to grid dimensions; also plot TSVs
-			else if (flag == MAPS_FLAGS::THERMAL_HOTSPOT) {
+			// for thermal maps (HotSpot, 3D thermal analysis): draw rectangles
+			// for floorplan blocks, which have to scaled to grid dimensions;
+			// also plot TSVs
+			else if (flag == MAPS_FLAGS::THERMAL_HOTSPOT || flag == MAPS_FLAGS::THERMAL_SOLVER) {
 
-				double scaling_factor_x = static_cast<double>(ThermalAnalyzer::THERMAL_MAP_DIM) / fp.IC.outline_x;
-				double scaling_factor_y = static_cast<double>(ThermalAnalyzer::THERMAL_MAP_DIM) / fp.IC.outline_y;
+				double scaling_factor_x = static_cast<double>(fp.thermalAnalyzer.dims.thermal_map) / fp.IC.outline_x;
+				double scaling_factor_y = static_cast<double>(fp.thermalAnalyzer.dims.thermal_map) / fp.IC.outline_y;
 
 				// output blocks
 				for (Block const& cur_block : fp.blocks) {
@@ -2749,11 +3094,12 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 	// init file stream for data file
 	data_out.open(data_out_name.str().c_str());
 
-	// output data: SA step and SA temp
-	data_out << "# Step Temperature (index 0)" << std::endl;
+	// output data: SA step and SA temp, along w/ thermal-map dimension applied
+	// during that step
+	data_out << "# Step Temperature Thermal_Map_Dim (index 0)" << std::endl;
 
 	for (FloorPlanner::TempStep step : fp.tempSchedule) {
-		data_out << step.step << " " << step.temp << std::endl;
+		data_out << step.step << " " << step.temp << " " << step.thermal_map_dim << std::endl;
 	}
 
 	// two blank lines trigger gnuplot to interpret data file as separate data sets
@@ -2912,6 +3258,50 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 	}
 }
 
+/// generate config-file section w/ calibrated thermal-mask parameters; may be pasted
+/// into config file as is
+void IO::writeThermalCalibration(FloorPlanner const& fp, ThermalAnalyzer::CalibrationResult const& fitted) {
+	std::ofstream file;
+	std::stringstream file_name;
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Generating config-file section w/ calibrated thermal-mask parameters ..." << std::endl;
+	}
+
+	file_name << fp.benchmark << "_ThermalCalibration.conf";
+	file.open(file_name.str().c_str());
+
+	file << "## Power blurring (thermal analysis) -- Default thermal-mask parameters" << std::endl;
+	file << "# Impulse factor I, for the dominant mask (lowest layer)" << std::endl;
+	file << "value" << std::endl;
+	file << fitted.parameters.impulse_factor << std::endl;
+	file << "# Impulse-scaling factor If, I(layer) = I / (layer^If)" << std::endl;
+	file << "value" << std::endl;
+	file << fitted.parameters.impulse_factor_scaling_exponent << std::endl;
+	file << "# Mask-boundary /value/ b, gauss function would provide b at mask boundaries x = y, i.e., gauss(x = y) = b" << std::endl;
+	file << "value" << std::endl;
+	file << fitted.parameters.mask_boundary_value << std::endl;
+	file << "## Power blurring -- Power maps parameters" << std::endl;
+	file << "# Power-density scaling factor in padding zone" << std::endl;
+	file << "value" << std::endl;
+	file << fitted.parameters.power_density_scaling_padding_zone << std::endl;
+	file << "# Power-density down-scaling factor for TSV regions" << std::endl;
+	file << "value" << std::endl;
+	file << fitted.parameters.power_density_scaling_TSV_region << std::endl;
+	file << "# Temperature offset (for die regions w/o direct impact of power blurring, i.e., steady" << std::endl;
+	file << "# temperature offset) [K]" << std::endl;
+	file << "value" << std::endl;
+	file << fitted.parameters.temp_offset << std::endl;
+
+	file.close();
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done" << std::endl << std::endl;
+	}
+}
+
 /// generate gnuplot for floorplans
 void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignment, std::string const& benchmark_suffix) {
 	std::ofstream gp_out;
@@ -3533,7 +3923,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 	unsigned x, y;
 	unsigned map_x, map_y;
 	float x_ll, y_ll;
-	float bin_w, bin_h;
+	float bin_w = 0.0, bin_h = 0.0;
 
 	if (fp.logMed()) {
 		std::cout << "IO> Generating files for HotSpot 3D-thermal simulation..." << std::endl;
@@ -3639,10 +4029,10 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		// TSV densities for each grid bin, given in the power_maps
 		else {
 			// walk power-map grid to obtain specific TSV densities of bins
-			for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+			for (x = fp.thermalAnalyzer.dims.power_maps_padded_bins; x < fp.thermalAnalyzer.dims.thermal_map + fp.thermalAnalyzer.dims.power_maps_padded_bins; x++) {
 
 				// adapt index for final thermal map according to padding
-				map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+				map_x = x - fp.thermalAnalyzer.dims.power_maps_padded_bins;
 
 				// pre-calculate bin's lower-left corner coordinates;
 				// float precision required to avoid grid coordinate
@@ -3655,19 +4045,19 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 				//
 				// lower bound, regular bin dimension; value also used
 				// until reaching upper bound
-				if (x == ThermalAnalyzer::POWER_MAPS_PADDED_BINS) {
+				if (x == fp.thermalAnalyzer.dims.power_maps_padded_bins) {
 					bin_w = static_cast<float>(fp.thermalAnalyzer.power_maps_dim_x * Math::SCALE_UM_M);
 				}
 				// upper bound, limit bin dimension according to overall
 				// chip outline; scale down slightly is required to avoid
 				// rounding errors during HotSpot's grid mapping
-				else if (x == (ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
+				else if (x == (fp.thermalAnalyzer.dims.thermal_map + fp.thermalAnalyzer.dims.power_maps_padded_bins - 1)) {
 					bin_w = 0.999 * static_cast<float>(fp.IC.outline_x * Math::SCALE_UM_M - x_ll);
 				}
 
-				for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+				for (y = fp.thermalAnalyzer.dims.power_maps_padded_bins; y < fp.thermalAnalyzer.dims.thermal_map + fp.thermalAnalyzer.dims.power_maps_padded_bins; y++) {
 					// adapt index for final thermal map according to padding
-					map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+					map_y = y - fp.thermalAnalyzer.dims.power_maps_padded_bins;
 
 					// pre-calculate bin's lower-left corner
 					// coordinates; float precision required to avoid
@@ -3680,14 +4070,14 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 					//
 					// lower bound, regular bin dimension; value also used
 					// until reaching upper bound
-					if (y == ThermalAnalyzer::POWER_MAPS_PADDED_BINS) {
+					if (y == fp.thermalAnalyzer.dims.power_maps_padded_bins) {
 						bin_h = static_cast<float>(fp.thermalAnalyzer.power_maps_dim_y * Math::SCALE_UM_M);
 					}
 					// upper bound, limit bin dimension according to
 					// overall chip outline; scale down slightly is
 					// required to avoid rounding errors during
 					// HotSpot's grid mapping
-					else if (y == (ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
+					else if (y == (fp.thermalAnalyzer.dims.thermal_map + fp.thermalAnalyzer.dims.power_maps_padded_bins - 1)) {
 						bin_h = 0.999 * static_cast<float>(fp.IC.outline_y * Math::SCALE_UM_M - y_ll);
 					}
 
@@ -3700,8 +4090,8 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 					file << "	" << x_ll;
 					file << "	" << y_ll;
 					// thermal properties, depending on bin's TSV density
-					file << "	" << ThermalAnalyzer::heatCapSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file << "	" << ThermalAnalyzer::thermResSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
+					file << "	" << ThermalAnalyzer::heatCapSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.TSV_density_maps[cur_layer][x][y]);
+					file << "	" << ThermalAnalyzer::thermResSi(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.TSV_density_maps[cur_layer][x][y]);
 					file << std::endl;
 
 					// put grid block as floorplan blocks; bonding layer
@@ -3713,8 +4103,8 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 					file_bond << "	" << x_ll;
 					file_bond << "	" << y_ll;
 					// thermal properties, depending on bin's TSV density
-					file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
-					file_bond << "	" << ThermalAnalyzer::thermResBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.power_maps[cur_layer][x][y].TSV_density);
+					file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.TSV_density_maps[cur_layer][x][y]);
+					file_bond << "	" << ThermalAnalyzer::thermResBond(fp.techParameters.TSV_group_Cu_area_ratio, fp.thermalAnalyzer.TSV_density_maps[cur_layer][x][y]);
 					file_bond << std::endl;
 				}
 			}
@@ -27,6 +27,7 @@
 #include "Corblivar.incl.hpp"
 #include <boost/polygon/polygon.hpp>
 // Corblivar includes, if any
+#include "ThermalAnalyzer.hpp"
 // forward declarations, if any
 class FloorPlanner;
 class CorblivarCore;
@@ -47,7 +48,7 @@ class IO {
 
 	// private data, functions
 	private:
-		static constexpr int CONFIG_VERSION = 23;
+		static constexpr int CONFIG_VERSION = 31;
 		static constexpr int TECHNOLOGY_VERSION = 7;
 
 	// constructors, destructors, if any non-implicit
@@ -58,18 +59,20 @@ class IO {
 
 	// public data, functions
 	public:
-		enum MAPS_FLAGS : int {POWER = 0, THERMAL = 1, THERMAL_HOTSPOT = 2, TSV_DENSITY = 3, POWER_ORIG = 4, ROUTING = 5};
+		enum MAPS_FLAGS : int {POWER = 0, THERMAL = 1, THERMAL_HOTSPOT = 2, TSV_DENSITY = 3, POWER_ORIG = 4, ROUTING = 5, THERMAL_SOLVER = 6};
 
 		static void parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv);
 		static void parseBlocks(FloorPlanner& fp);
 		static void parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments);
 		static void parseNets(FloorPlanner& fp);
 		static void parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb);
+		static void parseThermalReference(FloorPlanner& fp);
 		static void writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignment, std::string const& benchmark_suffix = "");
 		static void writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_suffix = "");
 		/// non-const reference due to map acces via []
 		static void writeMaps(FloorPlanner& fp, int const& flag_parameter = -1, std::string const& benchmark_suffix = "");
 		static void writeTempSchedule(FloorPlanner const& fp);
+		static void writeThermalCalibration(FloorPlanner const& fp, ThermalAnalyzer::CalibrationResult const& fitted);
 };
 
 #endif
@@ -1061,7 +1061,10 @@ bool LayoutOperations::performOpShapeBlock(bool const& revert, CorblivarCore& co
 		shape_block = corb.getDie(die1).getBlock(tuple1);
 
 		// backup current shape
-		shape_block->bb_backup = shape_block->bb;
+		this->last_op_bb_backup = shape_block->bb;
+
+		// placement becomes invalid from the shaped block onwards
+		corb.editDie(die1).invalidatePlacement(tuple1);
 
 		// soft blocks: enhanced block shaping
 		if (shape_block->soft) {
@@ -1097,8 +1100,8 @@ bool LayoutOperations::performOpShapeBlock(bool const& revert, CorblivarCore& co
 		}
 
 		// revert by restoring backup bb
-		corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1)->bb =
-			corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1)->bb_backup;
+		corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1)->bb = this->last_op_bb_backup;
+		corb.editDie(this->last_op_die1).invalidatePlacement(this->last_op_tuple1);
 	}
 
 	return true;
@@ -27,6 +27,7 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Point.hpp"
+#include "Rect.hpp"
 // forward declarations, if any
 class CorblivarCore;
 class Block;
@@ -115,6 +116,9 @@ class LayoutOperations {
 
 		/// layout-operation handler variables
 		mutable int last_op, last_op_die1, last_op_die2, last_op_tuple1, last_op_tuple2, last_op_juncts;
+		/// layout-operation handler variables; backup of shape for block
+		/// affected by last shaping op
+		mutable Rect last_op_bb_backup;
 		/// layout-operation handler
 		/// note that die and tuple parameters are return-by-reference; non-const
 		/// reference for CorblivarCore in order to enable operations on CBL-encode data
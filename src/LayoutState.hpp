@@ -0,0 +1,91 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar layout state; placement snapshot
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_LAYOUT_STATE
+#define _CORBLIVAR_LAYOUT_STATE
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Block.hpp"
+// forward declarations, if any
+
+/// Corblivar layout state; flat snapshot of the placement of all blocks, indexed by
+/// the blocks' numerical ids and organized as structure of arrays; used for
+/// determining which blocks have moved since some previous layout
+class LayoutState {
+	private:
+		/// debugging code switch (private)
+		static constexpr bool DBG = false;
+
+	// private data, functions
+	private:
+		/// placement data; geometry
+		std::vector<double> ll_x, ll_y, ur_x, ur_y;
+		/// placement data; layer assignment
+		std::vector<int> layer;
+
+	// constructors, destructors, if any non-implicit
+	public:
+
+	// public data, functions
+	public:
+		/// allocate memory
+		inline void resize(unsigned const& blocks) {
+			this->ll_x.resize(blocks, 0.0);
+			this->ll_y.resize(blocks, 0.0);
+			this->ur_x.resize(blocks, 0.0);
+			this->ur_y.resize(blocks, 0.0);
+			this->layer.resize(blocks, -1);
+		};
+
+		/// capture placement of given block into snapshot
+		inline void capture(Block const* b) {
+			int const& id = b->numerical_id;
+
+			if (DBG) {
+				std::cout << "DBG_LAYOUT_STATE> capture; block " << b->id << "; numerical id " << id << std::endl;
+			}
+
+			this->ll_x[id] = b->bb.ll.x;
+			this->ll_y[id] = b->bb.ll.y;
+			this->ur_x[id] = b->bb.ur.x;
+			this->ur_y[id] = b->bb.ur.y;
+			this->layer[id] = b->layer;
+		};
+
+		/// helper; checks whether the placement of given block differs from the
+		/// snapshot
+		inline bool differs(Block const* b) const {
+			int const& id = b->numerical_id;
+
+			return (
+				this->layer[id] != b->layer ||
+				this->ll_x[id] != b->bb.ll.x ||
+				this->ll_y[id] != b->bb.ll.y ||
+				this->ur_x[id] != b->bb.ur.x ||
+				this->ur_y[id] != b->bb.ur.y
+			);
+		};
+};
+
+#endif
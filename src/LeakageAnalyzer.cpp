@@ -27,79 +27,105 @@
 // required Corblivar headers
 #include "ThermalAnalyzer.hpp"
 
-double LeakageAnalyzer::determineSpatialEntropy(int const& layer, std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map) {
+void LeakageAnalyzer::initLayers(unsigned const& layers, unsigned const& dim) {
+
+	// (re-)init look-up table, if required for changed map dimensions
+	this->initDistances(dim);
+
+	// allocate data structures for all layers; partitions are reserved for the worst case, i.e., one partition for each bin, such
+	// that no memory is allocated during evaluations
+	//
+	// note that the histograms are always reset after use, thus they contain only zeros here
+	this->power_partitions.resize(layers);
+	for (auto& layer : this->power_partitions) {
+		layer.power_values.resize(dim * dim);
+		layer.partitions.reserve(dim * dim);
+		layer.coordinate_bins.resize(2 * dim, 0);
+	}
+}
+
+double LeakageAnalyzer::determineSpatialEntropy(int const& layer, Map2D<ThermalAnalyzer::PowerMapBin> const& power_map) {
 	double d_int;
-	int cur_d_int;
 	double d_ext;
+	unsigned long long cur_d_int;
+	unsigned long long cur_d_summed;
 	double cur_entropy, entropy;
 	double ratio_bins;
 	
 	// for more efficient access into data structures, especially within partitionPowerMap and partitionPowerMapHelper
 	unsigned l = static_cast<unsigned>(layer);
+	unsigned dim = power_map.dimX();
+
+	// (re-)init data structures, if required for changed map dimensions or for layer not evaluated yet
+	if (this->distances_summed.dimX() != dim || this->power_partitions.size() <= l) {
+		this->initLayers(std::max(l + 1, static_cast<unsigned>(this->power_partitions.size())), dim);
+	}
+
+	PowerPartitions& power_partitions = this->power_partitions[l];
+	unsigned* bins_x = power_partitions.coordinate_bins.data();
+	unsigned* bins_y = bins_x + dim;
 
 	// first, the power map has to be partitioned/classified
 	//
-	this->partitionPowerMap(l, power_map);
+	this->partitionPowerMap(power_partitions, power_map);
 
 	if (DBG_BASIC) {
-		std::cout << "DBG> Partitions on layer " << layer << ": " << this->power_partitions[l].size() << std::endl;
+		std::cout << "DBG> Partitions on layer " << layer << ": " << power_partitions.partitions.size() << std::endl;
 	}
 
 	// calculate spatial entropy for each partition and sum it up
 	//
 	entropy = 0.0;
-	for (auto const& cur_part : this->power_partitions[l]) {
+	for (auto const& cur_part : power_partitions.partitions) {
 
 		// first, calculate the avg internal and external distances for partition;
 		// internal distance: distance between all elements in same partition
 		// external distance: distance between all elements in this current partition and all elements in all other partitions
 		//
 
-		// calculate step wise for each bin of current partition
+		// internal distances are given by the distances between all pairs of bins in partition; Manhattan distances separate by
+		// axis, thus the distances are summed up separately for x and y dimensions, based on the histograms of bins over the
+		// coordinates; this is linear in the size of the partition, instead of quadratic for comparing each bin to all other bins
+		//
+		// external distances are given by the pre-calculated sums of distances for each bin to all other bins, minus the internal
+		// distances; this provides the distances between bins in partition and all other bins _not_ in the current partition
 		//
-		d_int = d_ext = 0.0;
-		for (auto const& b1 : cur_part.second) {
+		// note that all distances are integers, thus the sums are exact and independent of the order of summation
+		//
+		cur_d_summed = 0;
+		for (unsigned i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+			Bin const& b = power_partitions.power_values[i];
 
-			// for calculation of internal distances, compare each bin to all other bins in partition
-			//
-			cur_d_int = 0;
-			for (auto const& b2 : cur_part.second) {
-
-				// incurs larger overhead than simply adding internal distance of 0 for one bin to itself
-				//// ignore comparison with itself
-				//if (b1.x == b2.x && b1.y == b2.y) {
-				//	continue;
-				//}
-
-				// use look-up table/array for x and y dimensions separately
-				cur_d_int += this->distances[b1.x][b2.x];
-				cur_d_int += this->distances[b1.y][b2.y];
-			}
+			bins_x[b.x]++;
+			bins_y[b.y]++;
 
-			// sum up distances over partition
-			//
-			// for calculation of external distances, simply subtract internal distance from pre-calculated sum of distances for this bin to all other bins, to obtain
-			// the distance between this bin and all other bins _not_ in the current partition
-			d_ext += static_cast<double>(this->distances_summed[b1.x][b1.y] - cur_d_int);
-			// sum up internal distances
-			d_int += static_cast<double>(cur_d_int);
+			cur_d_summed += this->distances_summed[b.x][b.y];
 		}
+
+		cur_d_int = LeakageAnalyzer::sumDistances(bins_x, dim) + LeakageAnalyzer::sumDistances(bins_y, dim);
+
+		// reset histograms for next partition
+		std::fill(bins_x, bins_x + 2 * dim, 0);
+
+		d_int = static_cast<double>(cur_d_int);
+		d_ext = static_cast<double>(cur_d_summed - cur_d_int);
+
 		// normalize to obtain avg dist; over all compared pairs of elements
-		d_int /= (cur_part.second.size() * (cur_part.second.size() - 1));
+		d_int /= (static_cast<double>(cur_part.size()) * (cur_part.size() - 1));
 		// normalize to obtain avg dist; over all compared pairs of elements
-		d_ext /= (cur_part.second.size() *
+		d_ext /= (static_cast<double>(cur_part.size()) *
 				// size of all other partitions taken together, equals whole grid minus this partition
-				(std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2) - cur_part.second.size())
+				(power_map.size() - cur_part.size())
 			);
 
 		// now, calculate the partial entropy for this partition
 		//
-		ratio_bins = cur_part.second.size() / std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+		ratio_bins = cur_part.size() / static_cast<double>(power_map.size());
 		cur_entropy = (d_int / d_ext) * ratio_bins * std::log2(ratio_bins);
 
 		// dbg logging
 		if (DBG) {
-			std::cout << "DBG>  Partition: " << cur_part.first << std::endl;
+			std::cout << "DBG>  Partition: " << cur_part.lower_bound << "," << cur_part.upper_bound << std::endl;
 			std::cout << "DBG>   Avg internal dist: " << d_int << std::endl;
 			std::cout << "DBG>   Avg external dist: " << d_ext << std::endl;
 			std::cout << "DBG>   Partial entropy: " << cur_entropy << std::endl;
@@ -121,42 +147,33 @@ double LeakageAnalyzer::determineSpatialEntropy(int const& layer, std::array< st
 	return entropy;
 }
 
-void LeakageAnalyzer::partitionPowerMap(unsigned const& layer, std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map) {
+void LeakageAnalyzer::partitionPowerMap(PowerPartitions& power_partitions, Map2D<ThermalAnalyzer::PowerMapBin> const& power_map) {
 	double power_avg;
 	double power_std_dev;
-	unsigned m;
-	std::vector<Bin> power_values;
-
-	// check if vector for this layer is to be allocated first
-	if (this->power_partitions.size() <= layer) {
+	unsigned m, i;
+	std::vector<Bin>& power_values = power_partitions.power_values;
 
-		// allocate empty vector for current layer
-		this->power_partitions.push_back(
-				// vector of partitions in this layer
-				std::vector< std::pair<std::string, std::vector<Bin>> >()
-			);
-	}
-	// otherwise clear previously used vector
-	else {
-		this->power_partitions[layer].clear();
-	}
+	// clear previously determined partitions; memory is kept, as allocated along w/ initLayers
+	power_partitions.partitions.clear();
 
 	// put power values along with their coordinates into vector; also track avg power
 	//
-	power_values.reserve(std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2));
+	// note that the vector is sized along w/ initLayers and simply overwritten here
 	power_avg = 0.0;
-	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	i = 0;
+	for (unsigned x = 0; x < power_map.dimX(); x++) {
+		for (unsigned y = 0; y < power_map.dimY(); y++) {
 
-			power_values.push_back({
+			power_values[i] = {
 					x, y,
 					power_map[x][y].power_density
-				});
+				};
 
-			power_avg += power_values.back().value;
+			power_avg += power_values[i].value;
+			i++;
 		}
 	}
-	power_avg /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+	power_avg /= power_map.size();
 
 	// sort vector according to power values
 	std::sort(power_values.begin(), power_values.end(),
@@ -185,46 +202,46 @@ void LeakageAnalyzer::partitionPowerMap(unsigned const& layer, std::array< std::
 	// start recursive calls; partition these two ranges iteratively further
 	//
 	// note that upper-boundary element is left out for actual calculations, but required as upper boundary for traversal of data structures
-	this->partitionPowerMapHelper(layer, 0, m, power_values);
-	this->partitionPowerMapHelper(layer, m, power_values.size(), power_values);
+	this->partitionPowerMapHelper(power_partitions, 0, m);
+	this->partitionPowerMapHelper(power_partitions, m, power_values.size());
 
 	// now, all partitions along with their power bins are determined and stored in power_partitions
 	//
 
 	// dbg logging
 	if (DBG) {
-		std::cout << "DBG> Partitions on layer " << layer << ": " << this->power_partitions[layer].size() << std::endl;
+		std::cout << "DBG> Partitions: " << power_partitions.partitions.size() << std::endl;
 
-		for (auto const& cur_part : this->power_partitions[layer]) {
+		for (auto const& cur_part : power_partitions.partitions) {
 
 			// determine avg power for current partition
 			power_avg = 0.0;
-			for (auto const& bin : cur_part.second) {
-				power_avg += bin.value;
+			for (i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+				power_avg += power_values[i].value;
 			}
-			power_avg /= cur_part.second.size();
+			power_avg /= cur_part.size();
 
 			// determine sum of squared diffs for std dev
 			power_std_dev = 0.0;
-			for (auto const& bin : cur_part.second) {
-				power_std_dev += std::pow(bin.value - power_avg, 2.0);
+			for (i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+				power_std_dev += std::pow(power_values[i].value - power_avg, 2.0);
 			}
 			// determine std dev
-			power_std_dev /= cur_part.second.size();
+			power_std_dev /= cur_part.size();
 			power_std_dev = std::sqrt(power_std_dev);
 			
-			std::cout << "DBG>  Partition: " << cur_part.first << std::endl;
-			std::cout << "DBG>   Size: " << cur_part.second.size() << std::endl;
+			std::cout << "DBG>  Partition: " << cur_part.lower_bound << "," << cur_part.upper_bound << std::endl;
+			std::cout << "DBG>   Size: " << cur_part.size() << std::endl;
 			std::cout << "DBG>   Std dev power: " << power_std_dev << std::endl;
 			std::cout << "DBG>   Avg power: " << power_avg << std::endl;
 			// min value is represented by first bin, since the underlying data of power_values was sorted by power
-			std::cout << "DBG>   Min power: " << cur_part.second.front().value << std::endl;
+			std::cout << "DBG>   Min power: " << power_values[cur_part.lower_bound].value << std::endl;
 			// max value is represented by last bin, since the underlying data of power_values was sorted by power
-			std::cout << "DBG>   Max power: " << cur_part.second.back().value << std::endl;
+			std::cout << "DBG>   Max power: " << power_values[cur_part.upper_bound - 1].value << std::endl;
 
 			if (DBG_VERBOSE) {
-				for (auto const& bin : cur_part.second) {
-					std::cout << "DBG>   Power[" << bin.x << "][" << bin.y << "]: " << bin.value << std::endl;
+				for (i = cur_part.lower_bound; i < cur_part.upper_bound; i++) {
+					std::cout << "DBG>   Power[" << power_values[i].x << "][" << power_values[i].y << "]: " << power_values[i].value << std::endl;
 				}
 			}
 		}
@@ -232,7 +249,8 @@ void LeakageAnalyzer::partitionPowerMap(unsigned const& layer, std::array< std::
 }
 
 /// note that power_partitions are updated in this function
-inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsigned const& lower_bound, unsigned const& upper_bound, std::vector<Bin> const& power_values) {
+inline void LeakageAnalyzer::partitionPowerMapHelper(PowerPartitions& power_partitions, unsigned const& lower_bound, unsigned const& upper_bound) {
+	std::vector<Bin> const& power_values = power_partitions.power_values;
 	double avg, std_dev;
 	unsigned range;
 	unsigned m, i;
@@ -285,23 +303,16 @@ inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsi
 			//
 			// note that some partitions may be much smaller in case their previous cut was largely skewed towards one boundary; a possible countermeasure here would be
 			// to implement the check as look-ahead, but this also triggers some partitions to have a rather large leakage in practice
-			(range < MIN_PARTITION_SIZE) ||
+			(range < this->min_partition_size) ||
 			// look-ahead checks still required, to avoid trivial sub-partitions with only one element
 			((m - lower_bound) == 1) ||
 			((upper_bound - m) == 1)
 	   ) {
 
-		// if criterion reached, then memorize this current partition as new partition
+		// if criterion reached, then memorize this current partition as new partition; the range of bins is sufficient, since
+		// the underlying power_values remain sorted
 		//
-		std::vector<Bin> partition;
-		for (i = lower_bound; i < upper_bound; i++) {
-			partition.push_back(power_values[i]);
-		}
-		this->power_partitions[layer].push_back(
-				std::pair<std::string, std::vector<Bin>>(
-					std::string(std::to_string(lower_bound) + "," + std::to_string(upper_bound)),
-					partition
-				));
+		power_partitions.partitions.push_back({lower_bound, upper_bound});
 		
 		return;
 	}
@@ -311,12 +322,12 @@ inline void LeakageAnalyzer::partitionPowerMapHelper(unsigned const& layer, unsi
 
 		// recursive call for the two new sub-partitions
 		// note that upper-boundary element is left out for actual calculations, but required as upper boundary for traversal of data structures
-		this->partitionPowerMapHelper(layer, lower_bound, m, power_values);
-		this->partitionPowerMapHelper(layer, m, upper_bound, power_values);
+		this->partitionPowerMapHelper(power_partitions, lower_bound, m);
+		this->partitionPowerMapHelper(power_partitions, m, upper_bound);
 	}
 }
 
-double LeakageAnalyzer::determinePearsonCorr(std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map, std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const* thermal_map) {
+double LeakageAnalyzer::determinePearsonCorr(Map2D<ThermalAnalyzer::PowerMapBin> const& power_map, Map2D<ThermalAnalyzer::ThermalMapBin> const* thermal_map) {
 	double avg_power, avg_temp;
 	double max_temp;
 	double std_dev_power, std_dev_temp;
@@ -336,16 +347,16 @@ double LeakageAnalyzer::determinePearsonCorr(std::array< std::array<ThermalAnaly
 
 	// first pass: determine avg values
 	//
-	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (unsigned x = 0; x < power_map.dimX(); x++) {
+		for (unsigned y = 0; y < power_map.dimY(); y++) {
 
 			avg_power += power_map[x][y].power_density;
 			avg_temp += (*thermal_map)[x][y].temp;
 			max_temp = std::max(max_temp, (*thermal_map)[x][y].temp);
 		}
 	}
-	avg_power /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
-	avg_temp /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+	avg_power /= power_map.size();
+	avg_temp /= power_map.size();
 
 	// dbg output
 	if (DBG) {
@@ -357,8 +368,8 @@ double LeakageAnalyzer::determinePearsonCorr(std::array< std::array<ThermalAnaly
 	
 	// second pass: determine covariance and standard deviations
 	//
-	for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (unsigned x = 0; x < power_map.dimX(); x++) {
+		for (unsigned y = 0; y < power_map.dimY(); y++) {
 
 			// deviations of current values from avg values
 			cur_power_dev = power_map[x][y].power_density - avg_power;
@@ -372,9 +383,9 @@ double LeakageAnalyzer::determinePearsonCorr(std::array< std::array<ThermalAnaly
 			std_dev_temp += std::pow(cur_temp_dev, 2.0);
 		}
 	}
-	cov /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
-	std_dev_power /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
-	std_dev_temp /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+	cov /= power_map.size();
+	std_dev_power /= power_map.size();
+	std_dev_temp /= power_map.size();
 
 	std_dev_power = std::sqrt(std_dev_power);
 	std_dev_temp = std::sqrt(std_dev_temp);
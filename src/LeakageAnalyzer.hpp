@@ -42,9 +42,6 @@ class LeakageAnalyzer {
 		/// debugging code switch (private)
 		static constexpr bool DBG_GP = false;
 
-		/// minimal size of partitions, equal to 1% of power-map size/bins
-		static constexpr int MIN_PARTITION_SIZE = (ThermalAnalyzer::THERMAL_MAP_DIM * ThermalAnalyzer::THERMAL_MAP_DIM) / 100;
-
 	// public data
 	public:
 		struct Parameters {
@@ -68,78 +65,113 @@ class LeakageAnalyzer {
 			unsigned y;
 			double value;
 		};
+		/// partition of power map, given as range of bins; the upper bound is excluded
+		struct Partition {
+			unsigned lower_bound;
+			unsigned upper_bound;
+
+			inline unsigned size() const {
+				return this->upper_bound - this->lower_bound;
+			}
+		};
 
 	// private data, functions
 	private:
-		/// power partitions; outer vector: layers; middle vector: partitions (of layer), inner pair: id and vector of coordinates/indices of bins (of partition), related
-		/// to indices of ThermalAnalyzer::power_maps_orig
-		std::vector< std::vector< std::pair<std::string, std::vector<Bin>> > > power_partitions;
+		/// power partitions of one layer; all data structures are kept and reused for all evaluations, thus no memory is allocated
+		/// once the data structures are sized for the power-map dimension
+		struct PowerPartitions {
+			/// power values along with their coordinates, related to indices of ThermalAnalyzer::power_maps_orig; sorted by power
+			/// value, such that all partitions are consecutive ranges
+			std::vector<Bin> power_values;
+			/// partitions, as ranges of power_values
+			std::vector<Partition> partitions;
+			/// histograms of partition bins over x- and y-coordinates, in one vector (x: [0, dim), y: [dim, 2 * dim)); used for
+			/// calculation of spatial entropy
+			std::vector<unsigned> coordinate_bins;
+		};
 
-		/// sum of Manhattan distances from each array bin to all other bins; used for calculation of spatial entropy
-		std::array< std::array<int, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> distances_summed;
+		/// power partitions; separate for each layer such that layers can be evaluated concurrently
+		std::vector<PowerPartitions> power_partitions;
 
-		/// Manhattan distances, in 1D, for one bin to another bin; used for calculation of spatial entropy
-		std::array< std::array<int, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> distances;
+		/// minimal size of partitions, equal to 1% of power-map size/bins; set along w/ distance arrays
+		unsigned min_partition_size;
+
+		/// sum of Manhattan distances from each array bin to all other bins; used for calculation of spatial entropy
+		Map2D<int> distances_summed;
 
 		/// nested-means based partitioning of power maps
 		///
 		/// the values of power maps are sorted in a 1D data structure and then ``natural'' breaks are determined by
 		/// recursively bi-partitioning these values, where the mean is the boundary; the partitioning stops once the min/max values are
-		void partitionPowerMap(unsigned const& layer,
-				std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map);
+		void partitionPowerMap(PowerPartitions& power_partitions,
+				Map2D<ThermalAnalyzer::PowerMapBin> const& power_map);
 
 		/// helper for recursive calls for partitioning of power maps
 		///
 		/// note that the upper bound is excluded
-		inline void partitionPowerMapHelper(unsigned const& layer, unsigned const& lower_bound, unsigned const& upper_bound, std::vector<Bin> const& power_values);
+		inline void partitionPowerMapHelper(PowerPartitions& power_partitions, unsigned const& lower_bound, unsigned const& upper_bound);
 
-		/// helper to init distance arrays, which are used as look-up tables for spatial entropy
-		inline void initDistances() {
-			int dist;
+		/// helper to init distance array, which is used as look-up table for spatial entropy; the array is sized according to
+		/// the given power-map dimension, and only (re-)initialized if that dimension changes
+		inline void initDistances(unsigned const& dim) {
+			std::vector<int> dist;
 
-			// sum of distances for one bin in 2D array to all other bins in same 2D array
-			//
-			for (int x = 0; x < static_cast<int>(ThermalAnalyzer::THERMAL_MAP_DIM); x++) {
-				for (int y = 0; y < static_cast<int>(ThermalAnalyzer::THERMAL_MAP_DIM); y++) {
+			if (this->distances_summed.dimX() == dim) {
+				return;
+			}
 
-					// for each bin, calculate the sum of distances to all other bins
-					dist = 0;
+			this->distances_summed.resize(dim, dim);
+			this->min_partition_size = (dim * dim) / 100;
 
-					for (int i = 0; i < static_cast<int>(ThermalAnalyzer::THERMAL_MAP_DIM); i++) {
-						for (int j = 0; j < static_cast<int>(ThermalAnalyzer::THERMAL_MAP_DIM); j++) {
+			// sum of distances for one bin in 1D array to all other bins in same 1D array
+			//
+			dist.resize(dim);
+			for (int x = 0; x < static_cast<int>(dim); x++) {
+				for (int i = 0; i < static_cast<int>(dim); i++) {
 
-							// Manhattan distance should suffice for grid coordinates/distances
-							//
-							dist += std::abs(x - i) + std::abs(y - j);
-						}
-					}
+					// Manhattan distance should suffice for grid coordinates/distances
+					//
+					dist[x] += std::abs(x - i);
+				}
+			}
 
-					this->distances_summed[x][y] = dist;
+			// sum of distances for one bin in 2D array to all other bins in same 2D array; Manhattan distances separate by axis,
+			// thus each 1D sum is covered once for each of the dim rows/columns
+			//
+			for (unsigned x = 0; x < dim; x++) {
+				for (unsigned y = 0; y < dim; y++) {
+					this->distances_summed[x][y] = static_cast<int>(dim) * (dist[x] + dist[y]);
 				}
 			}
+		}
+
+		/// helper to determine the sum of Manhattan distances over all ordered pairs of bins, along one axis; based on
+		/// histogram of bins over the coordinates of this axis
+		inline static unsigned long long sumDistances(unsigned const* bins, unsigned const& dim) {
+			unsigned long long bins_below, coordinates_below;
+			unsigned long long dist;
 
-			// all distances for one bin in 1D array to all other bins in same 1D array
+			// walk coordinates in ascending order; the bins of the current coordinate have the difference in coordinates as
+			// distance to all bins below
 			//
-			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+			bins_below = coordinates_below = dist = 0;
+			for (unsigned c = 0; c < dim; c++) {
 
-				// no need to walk ranges [x][0--x]; they will be covered by symmetric counterparts below;
-				// also, the result of (y - x) is >= 0, so no std::abs call required
-				for (unsigned y = x; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				dist += bins[c] * (c * bins_below - coordinates_below);
 
-					// Manhattan distance should suffice for grid coordinates/distances
-					//
-					this->distances[x][y] = y - x;
-					// symmetric counterparts
-					this->distances[y][x] = this->distances[x][y];
-				}
+				bins_below += bins[c];
+				coordinates_below += static_cast<unsigned long long>(bins[c]) * c;
 			}
+
+			// each pair is covered twice, as (b1, b2) and (b2, b1)
+			return 2 * dist;
 		}
 
 	// constructors, destructors, if any non-implicit
 	public:
 		/// default constructor
 		LeakageAnalyzer() {
-			this->initDistances();
+			this->initDistances(ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT);
 		}
 
 	// public data, functions
@@ -148,13 +180,18 @@ class LeakageAnalyzer {
 	
 		/// Pearson correlation of power and thermal map
 		static double determinePearsonCorr(
-				std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map,
-				std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const* thermal_map
+				Map2D<ThermalAnalyzer::PowerMapBin> const& power_map,
+				Map2D<ThermalAnalyzer::ThermalMapBin> const* thermal_map
 			);
 		
+		/// (re-)init data structures for given layers and power-map dimension; required before layers are evaluated concurrently
+		void initLayers(unsigned const& layers, unsigned const& dim);
+
 		/// Spatial entropy of original power map, as proposed by Claramunt
+		///
+		/// different layers may be evaluated concurrently, once initLayers was called
 		double determineSpatialEntropy(int const& layer,
-				std::array< std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> const& power_map
+				Map2D<ThermalAnalyzer::PowerMapBin> const& power_map
 			);
 };
 
@@ -0,0 +1,121 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar 2D map; contiguous, dynamically sized grid of bins
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_MAP2D
+#define _CORBLIVAR_MAP2D
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+/// Corblivar 2D map; grid of bins w/ dimensions defined at runtime, stored
+/// contiguously in row-major order, i.e., bins [x][0..dim_y-1] are adjacent; bins are
+/// accessed as map[x][y], similar to nested std::array
+template<typename T>
+class Map2D {
+	// private data, functions
+	private:
+		std::vector<T> bins;
+		unsigned dim_x, dim_y;
+
+	// constructors, destructors, if any non-implicit
+	public:
+		/// default constructor; empty map
+		Map2D() {
+			this->dim_x = this->dim_y = 0;
+		};
+
+		/// constructor; allocated map, w/ bins initialized as given
+		Map2D(unsigned const& dim_x, unsigned const& dim_y, T const& init = T()) {
+			this->resize(dim_x, dim_y, init);
+		};
+
+	// public data, functions
+	public:
+		/// (re-)allocation of map; all bins are (re-)initialized as given
+		inline void resize(unsigned const& dim_x, unsigned const& dim_y, T const& init = T()) {
+			this->dim_x = dim_x;
+			this->dim_y = dim_y;
+			this->bins.assign(dim_x * dim_y, init);
+		};
+
+		/// reset all bins to given value
+		inline void fill(T const& value) {
+			std::fill(this->bins.begin(), this->bins.end(), value);
+		};
+
+		/// bin access; returns pointer to first bin of column x, such that
+		/// map[x][y] addresses bin (x,y)
+		inline T* operator[](unsigned const& x) {
+			return &this->bins[x * this->dim_y];
+		};
+		/// bin access; returns pointer to first bin of column x, such that
+		/// map[x][y] addresses bin (x,y)
+		inline T const* operator[](unsigned const& x) const {
+			return &this->bins[x * this->dim_y];
+		};
+
+		/// getter
+		inline unsigned const& dimX() const {
+			return this->dim_x;
+		};
+		/// getter
+		inline unsigned const& dimY() const {
+			return this->dim_y;
+		};
+		/// getter
+		inline unsigned size() const {
+			return this->bins.size();
+		};
+		/// getter
+		inline bool empty() const {
+			return this->bins.empty();
+		};
+		/// getter; raw access to contiguous bins
+		inline T* data() {
+			return this->bins.data();
+		};
+		/// getter; raw access to contiguous bins
+		inline T const* data() const {
+			return this->bins.data();
+		};
+
+		/// iterators for all bins, in storage order
+		inline typename std::vector<T>::iterator begin() {
+			return this->bins.begin();
+		};
+		/// iterators for all bins, in storage order
+		inline typename std::vector<T>::iterator end() {
+			return this->bins.end();
+		};
+		/// iterators for all bins, in storage order
+		inline typename std::vector<T>::const_iterator begin() const {
+			return this->bins.begin();
+		};
+		/// iterators for all bins, in storage order
+		inline typename std::vector<T>::const_iterator end() const {
+			return this->bins.end();
+		};
+};
+
+#endif
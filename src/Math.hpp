@@ -48,6 +48,120 @@ class Math {
 		/// division by zero
 		static constexpr double epsilon = 1.0e-10;
 
+		/// random-number generator; xoshiro256** by Blackman and Vigna, i.e., a
+		/// small-state, fast generator w/ good statistical quality; one instance
+		/// is maintained per thread, see rng()
+		class RNG {
+			private:
+				std::uint64_t s[4];
+
+				inline static std::uint64_t rotl(std::uint64_t const& x, int const& k) {
+					return (x << k) | (x >> (64 - k));
+				};
+
+			public:
+				/// seeding; the state is derived from the seed and the
+				/// stream via splitmix64, such that different streams of
+				/// the same seed provide independent sequences
+				inline void seed(std::uint64_t const& seed, std::uint64_t const& stream = 0) {
+					std::uint64_t z;
+					std::uint64_t x = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+
+					for (std::uint64_t& state : this->s) {
+						x += 0x9E3779B97F4A7C15ULL;
+						z = x;
+						z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+						z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+						state = z ^ (z >> 31);
+					}
+				};
+
+				/// next random number, full 64-bit range
+				inline std::uint64_t next() {
+					std::uint64_t const ret = rotl(this->s[1] * 5, 7) * 9;
+					std::uint64_t const t = this->s[1] << 17;
+
+					this->s[2] ^= this->s[0];
+					this->s[3] ^= this->s[1];
+					this->s[1] ^= this->s[2];
+					this->s[0] ^= this->s[3];
+					this->s[2] ^= t;
+					this->s[3] = rotl(this->s[3], 45);
+
+					return ret;
+				};
+
+				/// next random number, range [0, range); unbiased range
+				/// reduction by multiplication and rejection, following
+				/// Lemire
+				inline std::uint32_t next(std::uint32_t const& range) {
+					std::uint64_t m = (this->next() >> 32) * range;
+					std::uint32_t l = static_cast<std::uint32_t>(m);
+
+					if (l < range) {
+						std::uint32_t const threshold = -range % range;
+
+						while (l < threshold) {
+							m = (this->next() >> 32) * range;
+							l = static_cast<std::uint32_t>(m);
+						}
+					}
+
+					return static_cast<std::uint32_t>(m >> 32);
+				};
+
+				/// next random number, range [0, 1); considers the 53
+				/// upper bits, as required for the double mantissa
+				inline double nextF() {
+					return static_cast<double>(this->next() >> 11) * (1.0 / 9007199254740992.0);
+				};
+		};
+
+		/// random-number generator; seed applied to the generators of all
+		/// threads, see seedRand
+		inline static std::uint64_t& randSeed() {
+			static std::uint64_t seed = 1;
+			return seed;
+		};
+
+		/// random-number generator; streams of the threads' default generators;
+		/// the first thread, i.e., the main thread, uses the default stream 0,
+		/// all further threads use distinct streams, apart from the streams
+		/// explicitly selected via seedRand or RNG::seed
+		static constexpr std::uint64_t THREAD_STREAMS_OFFSET = 1ULL << 32;
+		inline static std::atomic<std::uint64_t>& threadsCount() {
+			static std::atomic<std::uint64_t> count(0);
+			return count;
+		};
+
+		/// random-number generator of the calling thread; initialized w/ the
+		/// current seed; the main thread uses the default stream 0, any
+		/// further thread uses a separate stream, such that worker threads
+		/// do not repeat the main thread's random-number sequence
+		inline static RNG& rng() {
+			static thread_local RNG rng = []() {
+				RNG ret;
+				std::uint64_t thread = Math::threadsCount()++;
+
+				if (thread == 0) {
+					ret.seed(Math::randSeed());
+				}
+				else {
+					ret.seed(Math::randSeed(), Math::THREAD_STREAMS_OFFSET + thread);
+				}
+				return ret;
+			}();
+			return rng;
+		};
+
+		/// random-number generator; (re-)seeds the generator of the calling
+		/// thread; threads w/ random-number sequences of their own, like SA
+		/// replicas, should use separate streams
+		inline static void seedRand(std::uint64_t const& seed, std::uint64_t const& stream = 0) {
+			Math::randSeed() = seed;
+			Math::rng().seed(seed, stream);
+		};
+
 		/// random-number functions
 		/// note: range is [min, max)
 		inline static int randI(int const& min, int const& max) {
@@ -55,20 +169,32 @@ class Math {
 				return min;
 			}
 			else {
-				return min + (rand() % (max - min));
+				return min + static_cast<int>(Math::rng().next(static_cast<std::uint32_t>(max - min)));
 			}
 		};
 		/// random decision
 		inline static bool randB() {
-			int const r = rand();
-			return (r < (RAND_MAX / 2));
+			return (Math::rng().next() >> 63);
 		};
 		/// random-number functions
 		/// note: range is [min, max)
 		inline static double randF(double const& min, double const& max) {
-			double const r = static_cast<double>(rand()) / RAND_MAX;
+			double const r = Math::rng().nextF();
 			return r * (max - min) + min;
 		};
+		/// random-number functions; normal distribution, based on the polar
+		/// method by Marsaglia
+		inline static double randN(double const& mean, double const& std_dev) {
+			double u, v, s;
+
+			do {
+				u = 2.0 * Math::rng().nextF() - 1.0;
+				v = 2.0 * Math::rng().nextF() - 1.0;
+				s = u * u + v * v;
+			} while (s >= 1.0 || s == 0.0);
+
+			return mean + std_dev * u * std::sqrt(-2.0 * std::log(s) / s);
+		};
 
 		/// standard deviation of samples
 		inline static double stdDev(std::vector<double> const& samples) {
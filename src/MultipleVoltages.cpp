@@ -28,15 +28,17 @@
 #include "Net.hpp"
 
 void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks, ContiguityAnalysis& cont) {
-	modules_type modules_other_voltages;
+	unsigned base_modules_count;
 
-	this->modules.clear();
+	// reset modules; the arena retains the modules' memory
+	this->modules_count = 0;
+	std::fill(this->modules_lookup.begin(), this->modules_lookup.end(), 0);
 
 	// consider each block as starting point for a compound module
 	for (Block const& start : blocks) {
 
 		// init the base compound module, containing only the block itself
-		MultipleVoltages::CompoundModule module;
+		MultipleVoltages::CompoundModule& module = this->newCompoundModule();
 
 		// copy feasible voltages
 		module.feasible_voltages = start.feasible_voltages;
@@ -51,13 +53,10 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 
 		// init block ids such that they may encode all blocks' numerical ids;
 		// also account for the offset of one, introduced by Block::DUMMY_NUM_ID
-		module.block_ids.reserve(blocks.size() + 1);
-		for (unsigned b = 0; b < blocks.size() + 1; b++) {
-			module.block_ids.push_back(false);
-		}
+		module.block_ids.resize(blocks.size() + 1);
 
 		// also, set the block-ids' flag for the current block
-		module.block_ids[start.numerical_id] = true;
+		module.block_ids.set(start.numerical_id);
 
 		// init neighbours; pointers to block's neighbour is sufficient
 		for (auto& neighbour : start.contiguous_neighbours) {
@@ -65,30 +64,29 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 		}
 
 		// init outline and corners for power rings
-		module.outline.reserve(this->parameters.layers);
-		module.corners_powerring.reserve(this->parameters.layers);
+		module.outline.resize(this->parameters.layers);
 
 		for (int l = 0; l < this->parameters.layers; l++) {
 
-			// empty bb
-			module.outline.emplace_back(std::vector<Rect>());
-
 			// any layer, also not affected layers, may be initialized with
 			// the trivial min number of corners, i.e., 4
 			module.corners_powerring.emplace_back(4);
 
+			// empty bb; note that outline[l] shall remain empty for other
+			// layers than the block's layer
+			module.outline[l].clear();
+
 			if (start.layer == l) {
 				module.outline[l].emplace_back(start.bb);
 			}
-			// note that outline[l] shall remain empty otherwise
 		}
 
 		// store base compound module
-		auto inserted_it = this->modules.insert(this->modules.begin(), {module.block_ids, std::move(module)});
+		this->addCompoundModuleLookup(this->modules_count - 1);
 
 		// perform stepwise and recursive merging of base module into larger
 		// compound modules
-		this->buildCompoundModulesHelper(inserted_it->second, inserted_it, cont);
+		this->buildCompoundModulesHelper(module, cont);
 	}
 
 	// at this point, volumes are determined, but only all volumes with their lowest feasible voltage implicitly (via min_voltage_index) assigned as their voltage of choice
@@ -101,11 +99,15 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 	//
 	if (this->parameters.weight_power_variation > 0) {
 
-		// for each module, insert another module with all other feasible voltages
+		// for each module, insert another module with all other feasible voltages;
+		// note that these modules are not required for lookup, thus they are only
+		// added to the arena
 		//
-		for (auto it = this->modules.begin(); it != this->modules.end(); ++it) {
+		base_modules_count = this->modules_count;
 
-			CompoundModule& module = it->second;
+		for (unsigned m = 0; m < base_modules_count; m++) {
+
+			CompoundModule& module = this->modules[m];
 
 			// skip the min voltage itself, since the modules already existing will have this voltage assigned
 			for (unsigned v = module.min_voltage_index() + 1; v < MAX_VOLTAGES; v++) {
@@ -113,7 +115,8 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 				// for all other feasible voltages, first copy the module
 				if (module.feasible_voltages[v]) {
 
-					CompoundModule new_module = module;
+					CompoundModule& new_module = this->newCompoundModule();
+					new_module = module;
 
 					// now reset all lower voltages; they have already been considered within other modules
 					for (unsigned w = 0; w < v; w++) {
@@ -122,24 +125,18 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 
 					// update all power values
 					new_module.updatePower(this->parameters.layers);
-
-					// and store this new module in temporary data structure
-					modules_other_voltages.insert({new_module.block_ids, std::move(new_module)});
 				}
 			}
 		}
-
-		// now, move all new modules into the global data structure
-		this->modules.insert(modules_other_voltages.begin(), modules_other_voltages.end());
 	}
 
 	if (MultipleVoltages::DBG) {
 
-		std::cout << "DBG_VOLTAGES> Compound modules (in total " << this->modules.size() << "):" << std::endl;
+		std::cout << "DBG_VOLTAGES> Compound modules (in total " << this->modules_count << "):" << std::endl;
 
-		for (auto it = this->modules.begin(); it != this->modules.end(); ++it) {
+		for (unsigned m = 0; m < this->modules_count; m++) {
 
-			CompoundModule& module = it->second;
+			CompoundModule& module = this->modules[m];
 
 			std::cout << "DBG_VOLTAGES>  Module;" << std::endl;
 			std::cout << "DBG_VOLTAGES>   Comprised blocks #: " << module.blocks.size() << std::endl;
@@ -157,7 +154,7 @@ void MultipleVoltages::determineCompoundModules(std::vector<Block> const& blocks
 std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCompoundModules(std::vector<Net> const& all_nets, bool const& finalize, bool const& merge_selected_modules) {
 	MultipleVoltages::CompoundModule* cur_selected_module;
 	MultipleVoltages::CompoundModule* module_to_check;
-	std::vector<MultipleVoltages::CompoundModule*> modules;
+	std::vector<MultipleVoltages::CompoundModule*>& modules = this->modules_to_select;
 
 	unsigned min_voltage_index;
 
@@ -184,7 +181,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 	// first, determine max/min values, required for cost terms and for ordering
 	//
 	max_power_saving = 0.0;
-	min_power_saving = this->modules.begin()->second.power_saving_avg();
+	min_power_saving = this->modules[0].power_saving_avg();
 
 	max_count = 0;
 	max_corners = 0;
@@ -193,41 +190,44 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 
 	// evaluate level shifters only if they shall be considered
 	if (this->parameters.weight_level_shifter > 0) {
-		this->modules.begin()->second.updateLevelShifter(all_nets);
-		min_level_shifter = this->modules.begin()->second.level_shifter();
+		this->modules[0].updateLevelShifter(all_nets);
+		min_level_shifter = this->modules[0].level_shifter();
 	}
 
 	for (int l = 0; l < this->parameters.layers; l++) {
 		max_power_std_dev.push_back(0.0);
 	}
 
-	for (auto it = this->modules.begin(); it != this->modules.end(); ++it) {
-		max_power_saving = std::max(max_power_saving, it->second.power_saving_avg());
-		min_power_saving = std::min(min_power_saving, it->second.power_saving_avg());
+	for (unsigned m = 0; m < this->modules_count; m++) {
+		CompoundModule& module = this->modules[m];
 
-		max_count = std::max(max_count, static_cast<int>(it->second.blocks.size()));
-		max_corners = std::max(max_corners, it->second.corners_powerring_max());
+		max_power_saving = std::max(max_power_saving, module.power_saving_avg());
+		min_power_saving = std::min(min_power_saving, module.power_saving_avg());
+
+		max_count = std::max(max_count, static_cast<int>(module.blocks.size()));
+		max_corners = std::max(max_corners, module.corners_powerring_max());
 
 		// evaluate level shifters only if they shall be considered
 		if (this->parameters.weight_level_shifter > 0) {
-			it->second.updateLevelShifter(all_nets);
-			max_level_shifter = std::max(max_level_shifter, it->second.level_shifter());
-			min_level_shifter = std::min(min_level_shifter, it->second.level_shifter());
+			module.updateLevelShifter(all_nets);
+			max_level_shifter = std::max(max_level_shifter, module.level_shifter());
+			min_level_shifter = std::min(min_level_shifter, module.level_shifter());
 		}
 
 		for (int l = 0; l < this->parameters.layers; l++) {
-			max_power_std_dev[l] = std::max(max_power_std_dev[l], it->second.power_std_dev_[l]);
+			max_power_std_dev[l] = std::max(max_power_std_dev[l], module.power_std_dev_[l]);
 		}
 	}
 
 	
 	// second, insert all modules' pointers into new vector, to be sorted next
 	//
-	for (auto it = this->modules.begin(); it != this->modules.end(); ++it) {
-		modules.push_back(&(it->second));
+	modules.clear();
+	for (unsigned m = 0; m < this->modules_count; m++) {
+		modules.push_back(&this->modules[m]);
 
 		// also set the cost for each module, now that the parameters (max values) have been determined
-		it->second.setCost(max_power_saving, min_power_saving, max_power_std_dev, max_count, max_corners, max_level_shifter, min_level_shifter, this->parameters);
+		this->modules[m].setCost(max_power_saving, min_power_saving, max_power_std_dev, max_count, max_corners, max_level_shifter, min_level_shifter, this->parameters);
 	}
 
 	// initial sort; solely based on above set cost, i.e., without consideration of inter-volume variations (via selected_modules__power_dens_avg), but still with consideration
@@ -391,27 +391,22 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 			module_to_check = *it;
 			module_to_remove = false;
 
-			for (Block const* assigned_block : cur_selected_module->blocks) {
-
-				// the module to check contains a block which is assigned
-				// in the current module; thus, we drop the module
-				//
-				if (module_to_check->block_ids[assigned_block->numerical_id] == true) {
-
-					if (MultipleVoltages::DBG_VERBOSE) {
-
-						count++;
+			// the module to check contains a block which is assigned in the
+			// current module; thus, we drop the module
+			//
+			if (module_to_check->block_ids.intersects(cur_selected_module->block_ids)) {
 
-						std::cout << "DBG_VOLTAGES>     Module to be deleted after selecting the module above: " << module_to_check->id() << std::endl;
-					}
+				if (MultipleVoltages::DBG_VERBOSE) {
 
-					// also update iterator; pointing to next element
-					// after erased element
-					it = modules.erase(it);
-					module_to_remove = true;
+					count++;
 
-					break;
+					std::cout << "DBG_VOLTAGES>     Module to be deleted after selecting the module above: " << module_to_check->id() << std::endl;
 				}
+
+				// also update iterator; pointing to next element
+				// after erased element
+				it = modules.erase(it);
+				module_to_remove = true;
 			}
 
 			// no module to remove; simply increment iterator
@@ -545,7 +540,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 				if (n_module->min_voltage_index() == module->min_voltage_index()) {
 
 					// sanity check; avoid merging with itself
-					if (n_module->block_ids == module->block_ids) {
+					if (n_module == module) {
 						continue;
 					}
 
@@ -561,7 +556,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 					for (Block const* b : n_module->blocks) {
 
 						module->blocks.push_back(b);
-						module->block_ids[b->numerical_id] = true;
+						module->block_ids.set(b->numerical_id);
 
 						// also update the module pointer for merged
 						// module's blocks
@@ -597,7 +592,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 					//
 					for (auto it = this->selected_modules.begin(); it != this->selected_modules.end(); ++it) {
 
-						if ((*it)->block_ids == n_module->block_ids) {
+						if (*it == n_module) {
 							this->selected_modules.erase(it);
 							break;
 						}
@@ -688,7 +683,7 @@ std::vector<MultipleVoltages::CompoundModule*> const& MultipleVoltages::selectCo
 /// also note that a breadth-first search is applied to determine which is the best block
 /// to be merged such that total cost (sum of local cost, where the sum differs for
 /// different starting blocks) cost remain low
-void MultipleVoltages::buildCompoundModulesHelper(MultipleVoltages::CompoundModule& module, MultipleVoltages::modules_type::iterator hint, ContiguityAnalysis& cont) {
+void MultipleVoltages::buildCompoundModulesHelper(MultipleVoltages::CompoundModule& module, ContiguityAnalysis& cont) {
 	std::bitset<MultipleVoltages::MAX_VOLTAGES> feasible_voltages;
 	ContiguityAnalysis::ContiguousNeighbour* neighbour;
 	std::vector<ContiguityAnalysis::ContiguousNeighbour*> candidates;
@@ -757,7 +752,7 @@ void MultipleVoltages::buildCompoundModulesHelper(MultipleVoltages::CompoundModu
 			// previous neighbours shall not be considered, in order to limit
 			// the search space such that only ``forward merging'' of new
 			// contiguous trivial modules is considered
-			this->insertCompoundModuleHelper(module, neighbour, false, feasible_voltages, hint, cont);
+			this->insertCompoundModuleHelper(module, neighbour, false, feasible_voltages, cont);
 
 			// this break is the ``trick'' for disabling branching: once a
 			// contiguous trivial module is extended by this relevant
@@ -782,7 +777,7 @@ void MultipleVoltages::buildCompoundModulesHelper(MultipleVoltages::CompoundModu
 			// previous neighbours shall be considered, since the related new
 			// module has a different set of voltages, i.e., no tie-braking
 			// was considered among some candidate neighbours
-			this->insertCompoundModuleHelper(module, neighbour, true, feasible_voltages, hint, cont);
+			this->insertCompoundModuleHelper(module, neighbour, true, feasible_voltages, cont);
 		}
 		// any other case, i.e., only one (trivially the highest possible) voltage
 		// applicable for the new module; to be ignored
@@ -851,31 +846,27 @@ void MultipleVoltages::buildCompoundModulesHelper(MultipleVoltages::CompoundModu
 		// would be undermined; note that in practice some blocks will still be
 		// (rightfully) considered since they are also contiguous neighbours with
 		// the now considered best-cost candidate
-		this->insertCompoundModuleHelper(module, best_candidate, false, feasible_voltages, hint, cont);
+		this->insertCompoundModuleHelper(module, best_candidate, false, feasible_voltages, cont);
 	}
 }
 
-inline void MultipleVoltages::insertCompoundModuleHelper(MultipleVoltages::CompoundModule& module, ContiguityAnalysis::ContiguousNeighbour* neighbour, bool consider_prev_neighbours, std::bitset<MultipleVoltages::MAX_VOLTAGES>& feasible_voltages, MultipleVoltages::modules_type::iterator& hint, ContiguityAnalysis& cont) {
-	MultipleVoltages::modules_type::iterator inserted;
+inline void MultipleVoltages::insertCompoundModuleHelper(MultipleVoltages::CompoundModule& module, ContiguityAnalysis::ContiguousNeighbour* neighbour, bool consider_prev_neighbours, std::bitset<MultipleVoltages::MAX_VOLTAGES>& feasible_voltages, ContiguityAnalysis& cont) {
 
 	// first, we have to check whether this potential compound module was already
 	// considered previously, i.e., during consideration of another starting module;
 	// only if the compound module is really a new one, then we continue
 	//
-	// to check if the potential module already exits, we ``leverage'' the previous
-	// module, by assigning the now-to-consider neighbour's block to the previous
-	// module's set of considered blocks; thus we avoid copying the whole set of
-	// blocks just for checking the potential module's existence; for further improved
-	// efficiency, we leverage the bool flags instead of the actual set blocks
+	// to check if the potential module already exits, we assign the now-to-consider
+	// neighbour's block to a copy of the previous module's set of considered blocks;
+	// note that the previous module itself shall not be altered, since it is held in
+	// the lookup table w/ its current set of blocks; the copy is a scratch buffer
+	// w/o memory allocation, and the set's hash is updated incrementally
 	//
-	module.block_ids[neighbour->block->numerical_id] = true;
+	this->block_ids_lookup = module.block_ids;
+	this->block_ids_lookup.set(neighbour->block->numerical_id);
 
 	// now, perform the actual check
-	if (this->modules.find(module.block_ids) != this->modules.end()) {
-
-		// the potential module does already exit; revert the just assigned
-		// neighbour from the previous module again; and return
-		module.block_ids[neighbour->block->numerical_id] = false;
+	if (this->findCompoundModule(this->block_ids_lookup) != nullptr) {
 
 		if (MultipleVoltages::DBG) {
 			std::cout << "DBG_VOLTAGES> Insertion not successful; module was already inserted previously" << std::endl;
@@ -887,14 +878,11 @@ inline void MultipleVoltages::insertCompoundModuleHelper(MultipleVoltages::Compo
 	// at this point, it's clear that we have to generate the new compound module; it
 	// comprises the previous module and the neighbour
 	//
-	MultipleVoltages::CompoundModule new_module;
-
-	// the blocks assignment is contained in the previous module, since the
-	// neighbour's block was already assigned; simply copy these flags
-	new_module.block_ids = module.block_ids;
+	MultipleVoltages::CompoundModule& new_module = this->newCompoundModule();
 
-	// only now we shall revert the neighbour's block assignment to the previous module
-	module.block_ids[neighbour->block->numerical_id] = false;
+	// the blocks assignment is already determined for the lookup; simply copy these
+	// flags
+	new_module.block_ids = this->block_ids_lookup;
 
 	// copy block pointers from previous module
 	new_module.blocks = module.blocks;
@@ -976,18 +964,70 @@ inline void MultipleVoltages::insertCompoundModuleHelper(MultipleVoltages::Compo
 	}
 
 
-	// perform actual insertion; hint provided is the iterator to the previously
-	// inserted module
+	// perform actual insertion; the module is already held in the arena, thus only
+	// the lookup table is to be updated
 	//
-	inserted = this->modules.insert(hint, {new_module.block_ids, std::move(new_module)});
+	this->addCompoundModuleLookup(this->modules_count - 1);
 
 	if (MultipleVoltages::DBG) {
 		std::cout << "DBG_VOLTAGES> Insertion successful; continue recursively with this module" << std::endl;
 	}
 
-	// recursive call; provide iterator to just inserted new module as hint for next
-	// insertion
-	this->buildCompoundModulesHelper(inserted->second, inserted, cont);
+	// recursive call
+	this->buildCompoundModulesHelper(new_module, cont);
+}
+
+MultipleVoltages::CompoundModule* MultipleVoltages::findCompoundModule(MultipleVoltages::BlockSet const& block_ids) const {
+	unsigned mask, slot;
+
+	if (this->modules_lookup.empty()) {
+		return nullptr;
+	}
+
+	// linear probing, starting from the slot defined by the hash; the table size is
+	// a power of two
+	mask = this->modules_lookup.size() - 1;
+
+	for (slot = block_ids.hash() & mask; this->modules_lookup[slot] != 0; slot = (slot + 1) & mask) {
+
+		CompoundModule const& module = this->modules[this->modules_lookup[slot] - 1];
+
+		if (module.block_ids == block_ids) {
+			return const_cast<CompoundModule*>(&module);
+		}
+	}
+
+	return nullptr;
+}
+
+void MultipleVoltages::addCompoundModuleLookup(unsigned const& index) {
+	unsigned mask, slot;
+	unsigned size;
+
+	// (re-)allocate table, such that the load factor remains below 0.5; all
+	// modules up to the given one are to be considered
+	if (2 * (index + 1) > this->modules_lookup.size()) {
+
+		size = std::max(static_cast<unsigned>(this->modules_lookup.size()), 1024u);
+		while (2 * (index + 1) > size) {
+			size *= 2;
+		}
+
+		this->modules_lookup.assign(size, 0);
+
+		// re-insert all previous modules; note that modules w/ other voltages
+		// are not considered here since they are added only after all lookups
+		for (unsigned m = 0; m < index; m++) {
+			this->addCompoundModuleLookup(m);
+		}
+	}
+
+	mask = this->modules_lookup.size() - 1;
+
+	for (slot = this->modules[index].block_ids.hash() & mask; this->modules_lookup[slot] != 0; slot = (slot + 1) & mask) {
+	}
+
+	this->modules_lookup[slot] = index + 1;
 }
 
 /// local cost, used during bottom-up merging
@@ -1544,6 +1584,26 @@ inline void MultipleVoltages::CompoundModule::setCost(
 	;
 }
 
+/// note that the die-wise outlines are only cleared, not dropped, and that the map of
+/// neighbours is replaced by a new one, such that its iteration order is the same as for
+/// a new module
+void MultipleVoltages::CompoundModule::reset() {
+
+	this->blocks.clear();
+	for (std::vector<Rect>& rects : this->outline) {
+		rects.clear();
+	}
+	this->outline_cost = 0.0;
+	this->corners_powerring.clear();
+	this->feasible_voltages.reset();
+	this->power_saving_avg_ = this->power_saving_wasted_avg_ = 0.0;
+	this->power_dens_avg_.clear();
+	this->power_std_dev_.clear();
+	this->level_shifter_upper_bound = this->level_shifter_actual = 0;
+	this->cost = -1;
+	this->contiguous_neighbours = std::unordered_map<unsigned, ContiguityAnalysis::ContiguousNeighbour*>();
+}
+
 std::string MultipleVoltages::CompoundModule::id() const {
 	std::string ret;
 
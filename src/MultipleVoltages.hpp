@@ -84,6 +84,92 @@ class MultipleVoltages {
 			double power_variation_max;
 		} max_values;
 
+	/// inner class of sets of blocks, to be declared early on; fixed-width bitset
+	/// w/ width defined at runtime, each block encoded by its numerical id; the
+	/// bitset's hash is updated incrementally, as XOR over random-like keys of all
+	/// comprised blocks (Zobrist hashing), thus adding or removing a block
+	/// requires constant time
+	class BlockSet {
+
+		// private data
+		private:
+			std::vector<std::uint64_t> words;
+			std::uint64_t hash_;
+
+			/// key of block for hashing; splitmix64 finalizer of numerical id
+			inline static std::uint64_t key(unsigned const& id) {
+				std::uint64_t z = static_cast<std::uint64_t>(id) + 0x9E3779B97F4A7C15ULL;
+
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+				return z ^ (z >> 31);
+			};
+
+		// constructors, destructors, if any non-implicit
+		public:
+			/// default constructor; empty set, not allocated yet
+			BlockSet() {
+				this->hash_ = 0;
+			};
+
+		// public functions
+		public:
+			/// (re-)allocation of set such that it may encode given count of
+			/// ids; set is reset as empty
+			inline void resize(unsigned const& ids) {
+				this->words.assign((ids + 63) / 64, 0);
+				this->hash_ = 0;
+			};
+
+			/// add block to set
+			inline void set(unsigned const& id) {
+
+				if (!this->test(id)) {
+					this->words[id / 64] |= (1ULL << (id % 64));
+					this->hash_ ^= BlockSet::key(id);
+				}
+			};
+			/// remove block from set
+			inline void reset(unsigned const& id) {
+
+				if (this->test(id)) {
+					this->words[id / 64] &= ~(1ULL << (id % 64));
+					this->hash_ ^= BlockSet::key(id);
+				}
+			};
+			/// membership test
+			inline bool test(unsigned const& id) const {
+				return (this->words[id / 64] >> (id % 64)) & 1ULL;
+			};
+			/// membership test
+			inline bool operator[](unsigned const& id) const {
+				return this->test(id);
+			};
+
+			/// check for any common block w/ other set
+			inline bool intersects(BlockSet const& other) const {
+
+				for (unsigned w = 0; w < this->words.size(); w++) {
+
+					if (this->words[w] & other.words[w]) {
+						return true;
+					}
+				}
+
+				return false;
+			};
+
+			/// getter
+			inline std::uint64_t const& hash() const {
+				return this->hash_;
+			};
+
+			/// comparison; hashes are compared first for early exit
+			inline bool operator==(BlockSet const& other) const {
+				return (this->hash_ == other.hash_) && (this->words == other.words);
+			};
+	};
+
 	/// inner class of compound modules, to be declared early on
 	class CompoundModule {
 
@@ -97,8 +183,8 @@ class MultipleVoltages {
 
 			/// flags to encode assigned blocks: each block encoded by its
 			/// numerical id will result in a `true' flag at the index related
-			/// to its numerical id
-			std::vector<bool> block_ids;
+			/// to its numerical id; also serves as key for lookup of modules
+			BlockSet block_ids;
 
 			/// die-wise bounding boxes for whole module; only the set/vector of
 			/// by other blocks not covered partial boxes are memorized; thus,
@@ -110,7 +196,7 @@ class MultipleVoltages {
 			/// the lower the better; current cost value is calculated via
 			/// updateOutlineCost()
 			///
-			double outline_cost = 0.0;
+			double outline_cost;
 
 			/// container for estimated max number of corners in power rings
 			/// per die
@@ -142,11 +228,11 @@ class MultipleVoltages {
 
 			/// values for level shifters will be memorized locally;
 			/// to avoid redundant recalculations, these values will only be updated whenever updateLevelShifter() is called
-			unsigned level_shifter_upper_bound = 0;
-			unsigned level_shifter_actual = 0;
+			unsigned level_shifter_upper_bound;
+			unsigned level_shifter_actual;
 			
 			/// memorize global cost locally, to avoid recalculation
-			double cost = -1;
+			double cost;
 
 			/// key: neighbour's numerical block id
 			///
@@ -156,6 +242,20 @@ class MultipleVoltages {
 			///
 			std::unordered_map<unsigned, ContiguityAnalysis::ContiguousNeighbour*> contiguous_neighbours;
 
+		// private functions
+		private:
+			/// reset handler; resets the module to its default-constructed
+			/// state, but memory of the data structures is retained where
+			/// possible
+			void reset();
+
+		// constructors, destructors, if any non-implicit
+		public:
+			/// default constructor; initialization via reset handler
+			CompoundModule() {
+				this->reset();
+			};
+
 		// private functions
 		private:
 			/// local cost; required during bottom-up construction
@@ -261,18 +361,36 @@ class MultipleVoltages {
 	private:
 		friend class IO;
 
-		/// map of compound modules; keys are a vector<bool>, with each
-		/// index representing a numerical block id, and each index' position set
-		/// true when the related block is comprised in the module; unordered map
-		/// is more efficient in accessing individual elements
-		typedef std::unordered_multimap< std::vector<bool>, CompoundModule > modules_type;
-		modules_type modules;
+		/// compound modules; arena of modules, where the modules are retained
+		/// across calls of determineCompoundModules such that their memory is
+		/// reused; only the first modules_count modules are valid; a deque is
+		/// used since references to modules must remain valid while further
+		/// modules are added
+		std::deque<CompoundModule> modules;
+		/// compound modules; count of valid modules in arena
+		unsigned modules_count;
+
+		/// lookup table for compound modules, keyed by the modules' sets of
+		/// comprised blocks; open addressing w/ linear probing, entries are
+		/// indices of modules in the arena, shifted by one such that zero marks
+		/// empty entries
+		std::vector<unsigned> modules_lookup;
+		/// lookup key for compound modules; scratch buffer for
+		/// insertCompoundModuleHelper()
+		BlockSet block_ids_lookup;
 
 		/// vector of selected modules, filled by selectCompoundModules()
 		std::vector<CompoundModule*> selected_modules;
+		/// vector of modules to select from, scratch buffer for
+		/// selectCompoundModules(); memory is retained
+		std::vector<CompoundModule*> modules_to_select;
 
 	// constructors, destructors, if any non-implicit
 	public:
+		/// default constructor
+		MultipleVoltages() {
+			this->modules_count = 0;
+		};
 
 	// public data, functions
 	public:
@@ -284,16 +402,35 @@ class MultipleVoltages {
 	// private helper data, functions
 	private:
 		/// internal helper to recursively build up compound modules
-		void buildCompoundModulesHelper(CompoundModule& module, modules_type::iterator hint, ContiguityAnalysis& cont);
+		void buildCompoundModulesHelper(CompoundModule& module, ContiguityAnalysis& cont);
 		/// internal helper to manage compound module in data structure
 		inline void insertCompoundModuleHelper(
 				CompoundModule& module,
 				ContiguityAnalysis::ContiguousNeighbour* neighbour,
 				bool consider_prev_neighbours,
 				std::bitset<MAX_VOLTAGES>& feasible_voltages,
-				modules_type::iterator& hint,
 				ContiguityAnalysis& cont
 			);
+
+		/// internal helper to obtain new compound module from arena; the
+		/// module is reset to its default-constructed state
+		inline CompoundModule& newCompoundModule() {
+
+			if (this->modules_count == this->modules.size()) {
+				this->modules.emplace_back();
+			}
+			else {
+				this->modules[this->modules_count].reset();
+			}
+
+			return this->modules[this->modules_count++];
+		};
+		/// internal helper for lookup of compound modules, by their sets of
+		/// comprised blocks; returns nullptr for modules not found
+		CompoundModule* findCompoundModule(BlockSet const& block_ids) const;
+		/// internal helper to add compound module (given as arena index) to
+		/// lookup table
+		void addCompoundModuleLookup(unsigned const& index);
 };
 
 #endif
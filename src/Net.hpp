@@ -48,9 +48,9 @@ class Net {
 			this->hasExternalPin = false;
 			this->layer_bottom = -1;
 			this->layer_top = -1;
-			this->clustered = false;
 			this->inputNet = this->outputNet = false;
 			this->source = nullptr;
+			this->util_cache_weight = 0.0;
 		};
 
 	// public data, functions
@@ -61,7 +61,6 @@ class Net {
 		std::vector<TSV_Island> TSVs;
 		std::vector<Pin const*> terminals;
 		mutable int layer_bottom, layer_top;
-		mutable bool clustered;
 
 		/// the first block of a net is considered the source/driver, the remaining
 		/// blocks/terminals are sinks
@@ -70,6 +69,17 @@ class Net {
 		/// terminal pin
 		bool inputNet, outputNet;
 
+		/// cache for incremental interconnects evaluation; bounding boxes w/o
+		/// consideration of TSVs for layers layer_bottom to layer_top, or one
+		/// global bounding box for trivial HPWL estimation
+		mutable std::vector<Rect> bbs_cache;
+		/// cache for incremental interconnects evaluation; contributions to
+		/// routing-utilization maps, as pairs of layer and bounding box, along
+		/// w/ the related weight
+		mutable std::vector< std::pair<int, Rect> > util_cache;
+		/// cache for incremental interconnects evaluation
+		mutable double util_cache_weight;
+
 		/// reset helper
 		inline void resetLayerBoundaries() const {
 
@@ -0,0 +1,287 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar placement stack; contiguous, preallocated stack of blocks
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_PLACEMENT_STACK
+#define _CORBLIVAR_PLACEMENT_STACK
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+class Block;
+
+/// Corblivar placement stack; replaces std::list for the placement stacks Hi, Vi,
+/// w/ the same semantics regarding order of blocks, i.e., front is the top of the
+/// stack; blocks are stored contiguously in a buffer which is preallocated once, with
+/// free space on both ends such that blocks can be added at the front as well as at
+/// the back w/o any memory allocation
+class PlacementStack {
+	// private data, functions
+	private:
+		/// buffer; the stack is held in [head, tail)
+		std::vector<Block const*> buffer;
+		/// buffer; the stack is held in [head, tail)
+		unsigned head, tail;
+
+		/// (re-)centering of stack within buffer; required in case one end of
+		/// the buffer is reached, the buffer is only enlarged if insufficient
+		/// for the current stack
+		inline void recenter() {
+			unsigned size = this->size();
+			unsigned new_head;
+
+			if (this->buffer.size() < 2 * size + 2) {
+				this->buffer.resize(2 * size + 2, nullptr);
+			}
+
+			new_head = (this->buffer.size() - size) / 2;
+
+			if (new_head < this->head) {
+				std::move(this->buffer.begin() + this->head, this->buffer.begin() + this->tail, this->buffer.begin() + new_head);
+			}
+			else if (new_head > this->head) {
+				std::move_backward(this->buffer.begin() + this->head, this->buffer.begin() + this->tail, this->buffer.begin() + new_head + size);
+			}
+
+			this->head = new_head;
+			this->tail = new_head + size;
+		};
+
+	// constructors, destructors, if any non-implicit
+	public:
+		/// default constructor; empty stack
+		PlacementStack() {
+			this->head = this->tail = 0;
+		};
+
+	// public data, functions
+	public:
+		/// iterator types; plain pointers into buffer
+		typedef Block const** iterator;
+		/// iterator types; plain pointers into buffer
+		typedef Block const* const* const_iterator;
+
+		/// allocate memory; for worst case of given count of blocks on the stack
+		inline void reserve(unsigned const& blocks) {
+			this->buffer.resize(2 * blocks + 2, nullptr);
+			this->clear();
+		};
+
+		/// reset stack; memory is retained
+		inline void clear() {
+			this->head = this->tail = this->buffer.size() / 2;
+		};
+
+		/// reset stack to given blocks, in order; memory is retained, as long as
+		/// sufficient
+		template<typename InputIterator>
+		inline void assign(InputIterator first, InputIterator last) {
+			this->clear();
+
+			for (; first != last; ++first) {
+				this->push_back(*first);
+			}
+		};
+		/// reset stack to other stack; memory is retained, as long as sufficient
+		inline void assign(PlacementStack const& other) {
+			this->assign(other.begin(), other.end());
+		};
+
+		/// getter
+		inline unsigned size() const {
+			return this->tail - this->head;
+		};
+		/// getter
+		inline bool empty() const {
+			return this->tail == this->head;
+		};
+		/// getter; top of stack
+		inline Block const* front() const {
+			return this->buffer[this->head];
+		};
+		/// getter; bottom of stack
+		inline Block const* back() const {
+			return this->buffer[this->tail - 1];
+		};
+
+		/// add block on top of stack
+		inline void push_front(Block const* b) {
+			if (this->head == 0) {
+				this->recenter();
+			}
+			this->buffer[--this->head] = b;
+		};
+		/// add block at bottom of stack
+		inline void push_back(Block const* b) {
+			if (this->tail == this->buffer.size()) {
+				this->recenter();
+			}
+			this->buffer[this->tail++] = b;
+		};
+		/// drop block from top of stack
+		inline void pop_front() {
+			this->head++;
+		};
+
+		/// drop given block from stack; returns iterator to next block
+		inline iterator erase(iterator pos) {
+			std::move(pos + 1, this->end(), pos);
+			this->tail--;
+
+			return pos;
+		};
+
+		/// stable sorting, w/ same results as std::list::sort; the latter is a
+		/// bottom-up merge sort which is mimicked here such that even for
+		/// comparators not imposing a strict weak ordering, which may occur for
+		/// comparisons of blocks' geometry, the same order of blocks results
+		///
+		/// runs are merged in place by rotation, thus w/o any memory allocation;
+		/// this is efficient for the typically short stacks
+		template<typename Compare>
+		inline void sort(Compare comp) {
+			// the std::list::sort implementation maintains bins of sorted runs,
+			// where bin i holds 2^i elements (or is empty); new elements are
+			// carried over the bins, merged w/ each non-empty bin, until an
+			// empty bin is reached; here, these bins are represented by
+			// consecutive ranges within the stack, the most recent / smallest
+			// bins are the rightmost ranges
+			//
+			// for each element, record the length of the related bins; the
+			// binary representation of the count of processed elements
+			// determines the lengths
+			unsigned n = this->size();
+			unsigned i, processed, len, run_begin;
+
+			if (n < 2) {
+				return;
+			}
+
+			// process elements one by one; elements [0, processed) are organized
+			// in sorted runs of descending powers of two (from left to right),
+			// according to the binary representation of processed
+			for (processed = 1; processed < n; processed++) {
+
+				// carry the new element, i.e., a run of length 1, and merge
+				// w/ all previous runs of same length
+				len = 1;
+				run_begin = processed;
+				while (processed & len) {
+
+					// merge run [run_begin - len, run_begin) (older) w/ carry
+					// [run_begin, processed + 1) (newer); note that
+					// std::list::merge(carry) called on the bin places the
+					// bin's elements first for equivalent elements, and
+					// elements from carry are taken only if comp(carry,
+					// bin) holds
+					this->merge(this->head + run_begin - len, this->head + run_begin, this->head + processed + 1, comp);
+
+					run_begin -= len;
+					len <<= 1;
+				}
+			}
+
+			// final merge of all remaining runs; std::list::sort merges the
+			// bins in ascending order of size, i.e., the smaller, more recent
+			// runs are merged into the next larger run, w/ the larger (older)
+			// run as merge target
+			//
+			// the runs are given by the binary representation of n, the
+			// smallest run is the rightmost
+			run_begin = n;
+			i = 0;
+			for (len = 1; len <= n; len <<= 1) {
+
+				if (!(n & len)) {
+					continue;
+				}
+
+				// first (smallest) run; nothing to merge yet, only memorize
+				// beginning of the accumulated range
+				if (i == 0) {
+					run_begin -= len;
+				}
+				// merge the older, larger run [run_begin - len, run_begin)
+				// w/ the accumulated range [run_begin, n); the latter is the
+				// carry in std::list terms, the former the merge target
+				else {
+					this->merge(this->head + run_begin - len, this->head + run_begin, this->head + n, comp);
+					run_begin -= len;
+				}
+
+				i++;
+			}
+		};
+
+		/// iterators
+		inline iterator begin() {
+			return this->buffer.data() + this->head;
+		};
+		/// iterators
+		inline iterator end() {
+			return this->buffer.data() + this->tail;
+		};
+		/// iterators
+		inline const_iterator begin() const {
+			return this->buffer.data() + this->head;
+		};
+		/// iterators
+		inline const_iterator end() const {
+			return this->buffer.data() + this->tail;
+		};
+
+	// private data, functions
+	private:
+		/// merge helper; merges the sorted ranges [first, middle) and [middle,
+		/// last) in place, same semantics as std::list::merge where [first,
+		/// middle) is the target and [middle, last) the merged list: an element
+		/// of the latter is placed before an element of the former only if
+		/// comp(latter, former) holds
+		template<typename Compare>
+		inline void merge(unsigned first, unsigned middle, unsigned const& last, Compare comp) {
+			unsigned next;
+
+			while (first < middle && middle < last) {
+
+				// element from second range to be placed before first
+				// range's current element; determine all such subsequent
+				// elements, to rotate them at once
+				if (comp(this->buffer[middle], this->buffer[first])) {
+
+					next = middle + 1;
+					while (next < last && comp(this->buffer[next], this->buffer[first])) {
+						next++;
+					}
+
+					std::rotate(this->buffer.begin() + first, this->buffer.begin() + middle, this->buffer.begin() + next);
+
+					first += next - middle + 1;
+					middle = next;
+				}
+				else {
+					first++;
+				}
+			}
+		};
+};
+
+#endif
@@ -29,9 +29,6 @@
 #include "Block.hpp"
 #include "Math.hpp"
 
-/// memory allocation
-constexpr unsigned RoutingUtilization::UTIL_MAPS_DIM;
-
 void RoutingUtilization::resetUtilMaps(int const& layers) {
 	int i;
 	RoutingUtilization::UtilBin init_bin;
@@ -39,9 +36,7 @@ void RoutingUtilization::resetUtilMaps(int const& layers) {
 	// reset the maps w/ zero values
 	init_bin.utilization = 0.0;
 	for (i = 0; i < layers; i++) {
-		for (auto& partial_map : this->util_maps[i]) {
-			partial_map.fill(init_bin);
-		}
+		this->util_maps[i].fill(init_bin);
 	}
 }
 
@@ -58,7 +53,7 @@ void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outlin
 	// allocate util-maps arrays
 	for (i = 0; i < layers; i++) {
 		this->util_maps.emplace_back(
-			std::array<std::array<RoutingUtilization::UtilBin, RoutingUtilization::UTIL_MAPS_DIM>, RoutingUtilization::UTIL_MAPS_DIM>()
+			Map2D<RoutingUtilization::UtilBin>(this->util_maps_dim, this->util_maps_dim)
 		);
 	}
 
@@ -66,16 +61,18 @@ void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outlin
 	this->resetUtilMaps(layers);
 
 	// scale of util map dimensions
-	this->util_maps_dim_x = die_outline.x / RoutingUtilization::UTIL_MAPS_DIM;
-	this->util_maps_dim_y = die_outline.y / RoutingUtilization::UTIL_MAPS_DIM;
+	this->util_maps_dim_x = die_outline.x / this->util_maps_dim;
+	this->util_maps_dim_y = die_outline.y / this->util_maps_dim;
 
 	// predetermine map bins' area and lower-left corner coordinates; note that the
 	// last bin represents the upper-right coordinates for the penultimate bin
 	this->util_maps_bin_area = this->util_maps_dim_x * this->util_maps_dim_y;
-	for (b = 0; b <= RoutingUtilization::UTIL_MAPS_DIM; b++) {
+	this->util_maps_bins_ll_x.resize(this->util_maps_dim + 1);
+	this->util_maps_bins_ll_y.resize(this->util_maps_dim + 1);
+	for (b = 0; b <= this->util_maps_dim; b++) {
 		this->util_maps_bins_ll_x[b] = b * this->util_maps_dim_x;
 	}
-	for (b = 0; b <= RoutingUtilization::UTIL_MAPS_DIM; b++) {
+	for (b = 0; b <= this->util_maps_dim; b++) {
 		this->util_maps_bins_ll_y[b] = b * this->util_maps_dim_y;
 	}
 
@@ -92,8 +89,8 @@ RoutingUtilization::UtilResult RoutingUtilization::determCost() const {
 	ret.cost = ret.avg_util = ret.max_util = 0.0;
 
 	for (layer = 0; layer < this->util_maps.size(); layer++) {
-		for (x = 0; x < this->util_maps[0].size(); x++) {
-			for (y = 0; y < this->util_maps[0][0].size(); y++) {
+		for (x = 0; x < this->util_maps[0].dimX(); x++) {
+			for (y = 0; y < this->util_maps[0].dimY(); y++) {
 
 				// determine max util
 				if (this->util_maps[layer][x][y].utilization > ret.max_util) {
@@ -107,8 +104,8 @@ RoutingUtilization::UtilResult RoutingUtilization::determCost() const {
 	}
 
 	ret.avg_util /= this->util_maps.size();
-	ret.avg_util /= this->util_maps[0].size();
-	ret.avg_util /= this->util_maps[0][0].size();
+	ret.avg_util /= this->util_maps[0].dimX();
+	ret.avg_util /= this->util_maps[0].dimY();
 
 	// cost: avg and max util
 	ret.cost = ret.avg_util * ret.max_util;
@@ -133,8 +130,8 @@ void RoutingUtilization::adaptUtilMap(int const& layer, Rect const& net_bb, doub
 	y_lower = static_cast<unsigned>(net_bb.ll.y / this->util_maps_dim_y);
 	// +1 in order to efficiently emulate the result of ceil(); limit upper
 	// bound to util-maps dimensions
-	x_upper = std::min(static_cast<unsigned>(net_bb.ur.x / this->util_maps_dim_x) + 1, RoutingUtilization::UTIL_MAPS_DIM);
-	y_upper = std::min(static_cast<unsigned>(net_bb.ur.y / this->util_maps_dim_y) + 1, RoutingUtilization::UTIL_MAPS_DIM);
+	x_upper = std::min(static_cast<unsigned>(net_bb.ur.x / this->util_maps_dim_x) + 1, this->util_maps_dim);
+	y_upper = std::min(static_cast<unsigned>(net_bb.ur.y / this->util_maps_dim_y) + 1, this->util_maps_dim);
 
 	if (RoutingUtilization::DBG) {
 		std::cout << "DBG_ROUTING_UTIL>  Affected util-map bins: " << x_lower << "," << y_lower
@@ -26,6 +26,7 @@
 // library includes
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
+#include "Map2D.hpp"
 // forward declarations, if any
 class Point;
 class Rect;
@@ -41,8 +42,8 @@ class RoutingUtilization {
 	// public data
 	public:
 
-		/// dimensions for routing-utilization map
-		static constexpr unsigned UTIL_MAPS_DIM = 64;
+		/// default dimensions for routing-utilization map
+		static constexpr unsigned UTIL_MAPS_DIM_DEFAULT = 64;
 
 	// PODs, to be declared early on
 	public:
@@ -61,14 +62,14 @@ class RoutingUtilization {
 	private:
 
 		/// utilization maps [i][x][y] whereas i relates to the layer
-		std::vector< std::array< std::array<UtilBin, UTIL_MAPS_DIM>, UTIL_MAPS_DIM> > util_maps;
+		std::vector< Map2D<UtilBin> > util_maps;
 
 		/// parameters for generating utilization maps
 		double util_maps_dim_x, util_maps_dim_y;
 		/// parameters for generating utilization maps
 		double util_maps_bin_area;
 		/// helper variables for generating utilization maps
-		std::array<double, UTIL_MAPS_DIM + 1> util_maps_bins_ll_x, util_maps_bins_ll_y;
+		std::vector<double> util_maps_bins_ll_x, util_maps_bins_ll_y;
 
 
 	// constructors, destructors, if any non-implicit
@@ -78,6 +79,11 @@ class RoutingUtilization {
 	public:
 		friend class IO;
 
+		/// dimensions for routing-utilization map; parsed in
+		/// IO::parseParametersFiles, the maps have to be (re-)initialized after
+		/// changing the dimensions
+		unsigned util_maps_dim = UTIL_MAPS_DIM_DEFAULT;
+
 		/// utilization analysis: handlers
 		void initUtilMaps(int const& layers, Point const& die_outline);
 		/// utilization analysis: handlers
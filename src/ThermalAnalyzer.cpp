@@ -31,7 +31,15 @@
 #include "CorblivarAlignmentReq.hpp"
 
 /// memory allocation
-constexpr unsigned ThermalAnalyzer::POWER_MAPS_DIM;
+constexpr unsigned ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT;
+
+/// function multi-versioning for power-blurring kernel; runtime selection of AVX-512,
+/// AVX2 or scalar code path, requires gcc >= 6 or clang >= 14 on x86-64
+#if defined(__x86_64__) && ((defined(__clang__) && __clang_major__ >= 14) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 6))
+	#define POWER_BLURRING_KERNEL_ISA __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+	#define POWER_BLURRING_KERNEL_ISA
+#endif
 
 void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 	unsigned x, y;
@@ -41,12 +49,18 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 	}
 
 	// scale of thermal map dimensions
-	this->thermal_map_dim_x = die_outline.x / ThermalAnalyzer::THERMAL_MAP_DIM;
-	this->thermal_map_dim_y = die_outline.y / ThermalAnalyzer::THERMAL_MAP_DIM;
+	this->thermal_map_dim_x = die_outline.x / this->dims.thermal_map;
+	this->thermal_map_dim_y = die_outline.y / this->dims.thermal_map;
+
+	// allocate map
+	this->thermal_map.resize(this->dims.thermal_map, this->dims.thermal_map);
+	// allocate buffers for power blurring
+	this->thermal_map_tmp.resize(this->dims.power_maps, this->dims.power_maps);
+	this->thermal_map_temps.resize(this->dims.thermal_map, this->dims.thermal_map);
 
 	// init map data structure
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (x = 0; x < this->dims.thermal_map; x++) {
+		for (y = 0; y < this->dims.thermal_map; y++) {
 
 			this->thermal_map[x][y] = {
 					// init w/ zero temp value
@@ -57,10 +71,7 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 					// dummy bb
 					Rect(),
 					// hotspot/blob region id; initialize as undefined
-					ThermalAnalyzer::HOTSPOT_UNDEFINED,
-					// allocation for neighbor's list; to be
-					// initialized during clustering
-					std::list<ThermalMapBin*>()
+					ThermalAnalyzer::HOTSPOT_UNDEFINED
 			};
 
 			// determine the bin's bb
@@ -74,82 +85,6 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 		}
 	}
 
-	// build-up neighbor relations for thermal-map grid;
-	// inner core
-	for (x = 1; x < ThermalAnalyzer::THERMAL_MAP_DIM - 1; x++) {
-		for (y = 1; y < ThermalAnalyzer::THERMAL_MAP_DIM - 1; y++) {
-
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y-1]);
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y+1]);
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y+1]);
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y+1]);
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y]);
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y-1]);
-			this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y-1]);
-      	}
-      }
-
-	// build-up neighbor relations for thermal-map grid;
-	// outer rows and columns 
-	x = 0;
-	for (y = 1; y < ThermalAnalyzer::THERMAL_MAP_DIM - 1; y++) {
-
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y+1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y+1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y-1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y-1]);
-	}
-
-	x = ThermalAnalyzer::THERMAL_MAP_DIM - 1;
-	for (y = 1; y < ThermalAnalyzer::THERMAL_MAP_DIM - 1; y++) {
-
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y-1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y+1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y+1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y-1]);
-	}
-
-	y = 0;
-	for (x = 1; x < ThermalAnalyzer::THERMAL_MAP_DIM - 1; x++) {
-
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y+1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y+1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y+1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y]);
-	}
-
-	y = ThermalAnalyzer::THERMAL_MAP_DIM - 1;
-	for (x = 1; x < ThermalAnalyzer::THERMAL_MAP_DIM - 1; x++) {
-
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y-1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x-1][y]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x+1][y-1]);
-		this->thermal_map[x][y].neighbors.push_back(&this->thermal_map[x][y-1]);
-	}
-
-	// build-up neighbor relations for thermal-map grid;
-	// corner points
-	this->thermal_map[0][0].neighbors.push_back(&this->thermal_map[0][1]);
-	this->thermal_map[0][0].neighbors.push_back(&this->thermal_map[1][1]);
-	this->thermal_map[0][0].neighbors.push_back(&this->thermal_map[1][0]);
-	this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(&this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(&this->thermal_map[1][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[0][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(&this->thermal_map[1][ThermalAnalyzer::THERMAL_MAP_DIM - 1]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(
-			&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][ThermalAnalyzer::THERMAL_MAP_DIM - 1]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(
-			&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 1].neighbors.push_back(
-			&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][ThermalAnalyzer::THERMAL_MAP_DIM - 2]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][0].neighbors.push_back(&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][0]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][0].neighbors.push_back(&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 2][1]);
-	this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][0].neighbors.push_back(&this->thermal_map[ThermalAnalyzer::THERMAL_MAP_DIM - 1][1]);
-
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "<- ThermalAnalyzer::initThermalMap" << std::endl;
 	}
@@ -164,38 +99,40 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 		std::cout << "-> ThermalAnalyzer::initPowerMaps(" << layers << ", " << die_outline.x << ", " << die_outline.y << ")" << std::endl;
 	}
 
+	// previously generated maps are dropped, thus the cached blocks' footprints are
+	// invalid as well
+	this->power_maps_cache.valid = false;
+
 	this->power_maps.clear();
+	this->power_maps_blocks.clear();
+	this->TSV_density_maps.clear();
 	this->power_maps_orig.clear();
 
-	// allocate power-maps arrays
+	// allocate power-maps arrays, and init the maps w/ zero values
+	init_bin.power_density = init_bin.TSV_density = 0.0;
 	for (i = 0; i < layers; i++) {
 		this->power_maps.emplace_back(
-			std::array<std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM>()
+			Map2D<double>(this->dims.power_maps, this->dims.power_maps, 0.0)
+		);
+		this->power_maps_blocks.emplace_back(
+			Map2D<double>(this->dims.power_maps, this->dims.power_maps, 0.0)
+		);
+		this->TSV_density_maps.emplace_back(
+			Map2D<double>(this->dims.power_maps, this->dims.power_maps, 0.0)
 		);
 		this->power_maps_orig.emplace_back(
-			std::array<std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM>()
+			Map2D<ThermalAnalyzer::PowerMapBin>(this->dims.thermal_map, this->dims.thermal_map, init_bin)
 		);
 	}
 
-	// init the maps w/ zero values
-	init_bin.power_density = init_bin.TSV_density = 0.0;
-	for (i = 0; i < layers; i++) {
-		for (auto& partial_map : this->power_maps[i]) {
-			partial_map.fill(init_bin);
-		}
-		for (auto& partial_map : this->power_maps_orig[i]) {
-			partial_map.fill(init_bin);
-		}
-	}
-
 	// scale power map dimensions to outline of thermal map; this way the padding of
 	// power maps doesn't distort the block outlines in the thermal map
-	this->power_maps_dim_x = die_outline.x / ThermalAnalyzer::THERMAL_MAP_DIM;
-	this->power_maps_dim_y = die_outline.y / ThermalAnalyzer::THERMAL_MAP_DIM;
+	this->power_maps_dim_x = die_outline.x / this->dims.thermal_map;
+	this->power_maps_dim_y = die_outline.y / this->dims.thermal_map;
 
 	// determine offset for blocks, related to padding of power maps
-	this->blocks_offset_x = this->power_maps_dim_x * ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
-	this->blocks_offset_y = this->power_maps_dim_y * ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+	this->blocks_offset_x = this->power_maps_dim_x * this->dims.power_maps_padded_bins;
+	this->blocks_offset_y = this->power_maps_dim_y * this->dims.power_maps_padded_bins;
 
 	// determine max distance for blocks' upper/right boundaries to upper/right die
 	// outline to be padded
@@ -205,10 +142,12 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 	// predetermine map bins' area and lower-left corner coordinates; note that the
 	// last bin represents the upper-right coordinates for the penultimate bin
 	this->power_maps_bin_area = this->power_maps_dim_x * this->power_maps_dim_y;
-	for (b = 0; b <= ThermalAnalyzer::POWER_MAPS_DIM; b++) {
+	this->power_maps_bins_ll_x.resize(this->dims.power_maps + 1);
+	this->power_maps_bins_ll_y.resize(this->dims.power_maps + 1);
+	for (b = 0; b <= this->dims.power_maps; b++) {
 		this->power_maps_bins_ll_x[b] = b * this->power_maps_dim_x;
 	}
-	for (b = 0; b <= ThermalAnalyzer::POWER_MAPS_DIM; b++) {
+	for (b = 0; b <= this->dims.power_maps; b++) {
 		this->power_maps_bins_ll_y[b] = b * this->power_maps_dim_y;
 	}
 
@@ -244,7 +183,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	// allocate mask arrays
 	for (i = 0; i < layers; i++) {
 		this->thermal_masks.emplace_back(
-			std::array<double,ThermalAnalyzer::THERMAL_MASK_DIM>()
+			std::vector<double>(this->dims.thermal_mask)
 		);
 	}
 
@@ -260,7 +199,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	scale = std::sqrt(SPREAD * std::log(parameters.impulse_factor / (parameters.mask_boundary_value))) / std::sqrt(2.0);
 	// normalize factor according to half of mask dimension; i.e., fit spreading of
 	// exp function
-	scale /=  ThermalAnalyzer::THERMAL_MASK_CENTER;
+	scale /=  this->dims.thermal_mask_center;
 
 	// determine all masks, starting from lowest layer, i.e., hottest layer
 	for (i = 1; i <= layers; i++) {
@@ -269,7 +208,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 		layer_impulse_factor = parameters.impulse_factor / std::pow(i, parameters.impulse_factor_scaling_exponent);
 
 		ii = 0;
-		for (x_y = -ThermalAnalyzer::THERMAL_MASK_CENTER; x_y <= static_cast<int>(ThermalAnalyzer::THERMAL_MASK_CENTER); x_y++) {
+		for (x_y = -static_cast<int>(this->dims.thermal_mask_center); x_y <= static_cast<int>(this->dims.thermal_mask_center); x_y++) {
 			// sqrt for impulse factor is mandatory since the mask is
 			// used for separated convolution (i.e., factor will be
 			// squared in final convolution result)
@@ -285,7 +224,7 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 		// dump mask
 		for (i = 0; i < layers; i++) {
 			std::cout << "DBG> Thermal 1D mask for point source on layer " << i << ":" << std::endl;
-			for (x_y = 0; x_y < ThermalAnalyzer::THERMAL_MASK_DIM; x_y++) {
+			for (x_y = 0; x_y < static_cast<int>(this->dims.thermal_mask); x_y++) {
 				std::cout << this->thermal_masks[i][x_y] << ", ";
 			}
 			std::cout << std::endl;
@@ -309,158 +248,91 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 
 void ThermalAnalyzer::generatePowerMaps(int const& layers, std::vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone) {
 	int i;
+	unsigned b;
 	unsigned x, y;
-	unsigned x_lower, x_upper, y_lower, y_upper;
-	Rect bin, intersect, block_offset;
-	bool padding_zone;
+	bool full_update;
 	ThermalAnalyzer::PowerMapBin init_bin;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		std::cout << "-> ThermalAnalyzer::generatePowerMaps(" << layers << ", " << &blocks << ", (" << die_outline.x << ", " << die_outline.y << "), " << &parameters << ", " << extend_boundary_blocks_into_padding_zone << ")" << std::endl;
 	}
 
-	init_bin.power_density = 0.0;
-	init_bin.TSV_density = 0.0;
+	// full re-generation of maps is required for invalid cache, i.e., after
+	// (re-)initializing the maps, for changed parameters or blocks, and
+	// periodically in order to limit numerical drift
+	full_update = !this->power_maps_cache.valid ||
+		this->power_maps_footprints.size() != blocks.size() ||
+		this->power_maps_cache.die_outline.x != die_outline.x ||
+		this->power_maps_cache.die_outline.y != die_outline.y ||
+		this->power_maps_cache.extend_boundary_blocks_into_padding_zone != extend_boundary_blocks_into_padding_zone ||
+		this->power_maps_cache.power_density_scaling_padding_zone != parameters.power_density_scaling_padding_zone ||
+		(++this->power_maps_cache.updates >= ThermalAnalyzer::POWER_MAPS_FULL_UPDATE_INTERVAL);
 
-	// determine maps for each layer
-	for (i = 0; i < layers; i++) {
+	if (full_update) {
 
 		// reset map to zero
 		// note: this also implicitly pads the map w/ zero power density
-		for (auto& m : this->power_maps[i]) {
-			m.fill(init_bin);
-		}
-		for (auto& m : this->power_maps_orig[i]) {
-			m.fill(init_bin);
+		for (i = 0; i < layers; i++) {
+			this->power_maps_blocks[i].fill(0.0);
 		}
 
-		// consider each block on the related layer
-		for (Block const& block : blocks) {
-
-			// drop blocks assigned to other layers
-			if (block.layer != i) {
-				continue;
-			}
+		// rasterize all blocks; note that blocks are added in the same order for
+		// each layer as they are given
+		this->power_maps_footprints.resize(blocks.size());
+		for (b = 0; b < blocks.size(); b++) {
 
-			// determine offset, i.e., shifted, block bb; relates to block's
-			// bb in padded power map
-			block_offset = block.bb;
+			this->determineBlockFootprint(blocks[b], die_outline, extend_boundary_blocks_into_padding_zone, this->power_maps_footprints[b]);
+			this->applyBlockFootprint(this->power_maps_footprints[b], 1.0, parameters);
+		}
 
-			// don't offset blocks at the left/lower chip boundaries,
-			// implicitly extend them into power-map padding zone; this way,
-			// during convolution, the thermal estimate increases for these
-			// blocks; blocks not at the boundaries are shifted
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.x == 0.0) {
-			}
-			else {
-				block_offset.ll.x += this->blocks_offset_x;
-			}
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.y == 0.0) {
-			}
-			else {
-				block_offset.ll.y += this->blocks_offset_y;
-			}
+		this->power_maps_cache.valid = true;
+		this->power_maps_cache.updates = 0;
+		this->power_maps_cache.die_outline = die_outline;
+		this->power_maps_cache.extend_boundary_blocks_into_padding_zone = extend_boundary_blocks_into_padding_zone;
+		this->power_maps_cache.power_density_scaling_padding_zone = parameters.power_density_scaling_padding_zone;
+	}
+	else {
+		// update maps only for blocks w/ changed footprint, i.e., subtract
+		// previous footprint and add new one
+		for (b = 0; b < blocks.size(); b++) {
 
-			// also consider extending blocks into right/upper padding zone if
-			// they are close to the related chip boundaries
-			if (
-					extend_boundary_blocks_into_padding_zone &&
-					std::abs(die_outline.x - block.bb.ur.x) < this->padding_right_boundary_blocks_distance
-			   ) {
-				// consider offset twice in order to reach right/uppper
-				// boundary related to layout described by padded power map
-				block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
-			}
-			// simple shift otherwise; compensate for padding of left/bottom
-			// boundaries
-			else {
-				block_offset.ur.x += this->blocks_offset_x;
-			}
+			Block const& block = blocks[b];
+			BlockFootprint& footprint = this->power_maps_footprints[b];
 
 			if (
-					extend_boundary_blocks_into_padding_zone
-					&& std::abs(die_outline.y - block.bb.ur.y) < this->padding_upper_boundary_blocks_distance
+					footprint.layer == block.layer &&
+					footprint.bb.ll.x == block.bb.ll.x && footprint.bb.ll.y == block.bb.ll.y &&
+					footprint.bb.ur.x == block.bb.ur.x && footprint.bb.ur.y == block.bb.ur.y &&
+					footprint.power_density == block.power_density()
 			   ) {
-				block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
-			}
-			else {
-				block_offset.ur.y += this->blocks_offset_y;
+				continue;
 			}
 
-			// determine index boundaries for offset block; based on boundary
-			// of blocks and the covered bins; note that casting truncates
-			// toward zero, i.e., performs like floor for positive numbers
-			x_lower = static_cast<unsigned>(block_offset.ll.x / this->power_maps_dim_x);
-			y_lower = static_cast<unsigned>(block_offset.ll.y / this->power_maps_dim_y);
-			// +1 in order to efficiently emulate the result of ceil(); limit
-			// upper bound to power-maps dimensions
-			x_upper = std::min(static_cast<unsigned>(block_offset.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-			y_upper = std::min(static_cast<unsigned>(block_offset.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
-			// walk power-map bins covering block outline
-			for (x = x_lower; x < x_upper; x++) {
-				for (y = y_lower; y < y_upper; y++) {
-
-					// determine if bin w/in padding zone
-					if (
-							x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| x >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-							|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| y >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-					   ) {
-						padding_zone = true;
-					}
-					else {
-						padding_zone = false;
-					}
-
-					// consider full block power density for fully covered bins
-					if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density() * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density();
-						}
-					}
-					// else consider block power according to
-					// intersection of current bin and block
-					else {
-						// determine real coords of map bin
-						bin.ll.x = this->power_maps_bins_ll_x[x];
-						bin.ll.y = this->power_maps_bins_ll_y[y];
-						// note that +1 is guaranteed to be within bounds
-						// of power_maps_bins_ll_x/y (size =
-						// ThermalAnalyzer::POWER_MAPS_DIM + 1); the
-						// related last tuple describes the upper-right
-						// corner coordinates of the right/top boundary
-						bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-						bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-						// determine intersection
-						intersect = Rect::determineIntersection(bin, block_offset);
-						// normalize to full bin area
-						intersect.area /= this->power_maps_bin_area;
-
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density() * intersect.area * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density() * intersect.area;
-						}
-					}
-				}
-			}
+			this->applyBlockFootprint(footprint, -1.0, parameters);
+			this->determineBlockFootprint(block, die_outline, extend_boundary_blocks_into_padding_zone, footprint);
+			this->applyBlockFootprint(footprint, 1.0, parameters);
 		}
 	}
 
+	init_bin.power_density = 0.0;
+	init_bin.TSV_density = 0.0;
+
+	// init the actual maps from the blocks' power maps; these maps are then adapted
+	// for TSVs and wires
+	for (i = 0; i < layers; i++) {
+
+		this->power_maps[i] = this->power_maps_blocks[i];
+		this->TSV_density_maps[i].fill(0.0);
+		this->power_maps_orig[i].fill(init_bin);
+	}
+
 	// copy inner, unpadded frame of just generated basic power map to power_maps_orig
 	//
 	for (i = 0; i < layers; i++) {
-		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-			for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
-				this->power_maps_orig[i][x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS][y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS].power_density +=
-					this->power_maps[i][x][y].power_density;
+		for (x = this->dims.power_maps_padded_bins; x < this->dims.thermal_map + this->dims.power_maps_padded_bins; x++) {
+			for (y = this->dims.power_maps_padded_bins; y < this->dims.thermal_map + this->dims.power_maps_padded_bins; y++) {
+				this->power_maps_orig[i][x - this->dims.power_maps_padded_bins][y - this->dims.power_maps_padded_bins].power_density +=
+					this->power_maps[i][x][y];
 			}
 		}
 	}
@@ -470,6 +342,146 @@ void ThermalAnalyzer::generatePowerMaps(int const& layers, std::vector<Block> co
 	}
 }
 
+inline void ThermalAnalyzer::determineBlockFootprint(Block const& block, Point const& die_outline, bool const& extend_boundary_blocks_into_padding_zone,
+		BlockFootprint& footprint) const {
+	Rect block_offset;
+
+	footprint.layer = block.layer;
+	footprint.bb = block.bb;
+	footprint.power_density = block.power_density();
+
+	// determine offset, i.e., shifted, block bb; relates to block's bb in padded
+	// power map
+	block_offset = block.bb;
+
+	// don't offset blocks at the left/lower chip boundaries, implicitly extend them
+	// into power-map padding zone; this way, during convolution, the thermal
+	// estimate increases for these blocks; blocks not at the boundaries are shifted
+	if (extend_boundary_blocks_into_padding_zone && block.bb.ll.x == 0.0) {
+	}
+	else {
+		block_offset.ll.x += this->blocks_offset_x;
+	}
+	if (extend_boundary_blocks_into_padding_zone && block.bb.ll.y == 0.0) {
+	}
+	else {
+		block_offset.ll.y += this->blocks_offset_y;
+	}
+
+	// also consider extending blocks into right/upper padding zone if they are close
+	// to the related chip boundaries
+	if (
+			extend_boundary_blocks_into_padding_zone &&
+			std::abs(die_outline.x - block.bb.ur.x) < this->padding_right_boundary_blocks_distance
+	   ) {
+		// consider offset twice in order to reach right/uppper boundary related to
+		// layout described by padded power map
+		block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
+	}
+	// simple shift otherwise; compensate for padding of left/bottom boundaries
+	else {
+		block_offset.ur.x += this->blocks_offset_x;
+	}
+
+	if (
+			extend_boundary_blocks_into_padding_zone
+			&& std::abs(die_outline.y - block.bb.ur.y) < this->padding_upper_boundary_blocks_distance
+	   ) {
+		block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
+	}
+	else {
+		block_offset.ur.y += this->blocks_offset_y;
+	}
+
+	// determine index boundaries for offset block; based on boundary of blocks and
+	// the covered bins; note that casting truncates toward zero, i.e., performs like
+	// floor for positive numbers
+	footprint.x_lower = static_cast<unsigned>(block_offset.ll.x / this->power_maps_dim_x);
+	footprint.y_lower = static_cast<unsigned>(block_offset.ll.y / this->power_maps_dim_y);
+	// +1 in order to efficiently emulate the result of ceil(); limit upper bound to
+	// power-maps dimensions
+	footprint.x_upper = std::min(static_cast<unsigned>(block_offset.ur.x / this->power_maps_dim_x) + 1, this->dims.power_maps);
+	footprint.y_upper = std::min(static_cast<unsigned>(block_offset.ur.y / this->power_maps_dim_y) + 1, this->dims.power_maps);
+
+	// sanity check for blocks outside of the power maps, e.g., for layouts not
+	// fitting into the outline; such blocks are not considered
+	if (footprint.x_lower >= footprint.x_upper || footprint.y_lower >= footprint.y_upper) {
+		footprint.x_lower = footprint.x_upper = footprint.y_lower = footprint.y_upper = 0;
+		return;
+	}
+
+	// partial-coverage weights for boundary strips; the intersection of block and
+	// boundary bin, normalized to the bin's dimension; note that the +1 bin indices
+	// are guaranteed to be within bounds of power_maps_bins_ll_x/y (size =
+	// dims.power_maps + 1), where the related last tuple describes the upper-right
+	// corner coordinates of the right/top boundary
+	footprint.w_x_lower = std::max(0.0,
+			std::min(block_offset.ur.x, this->power_maps_bins_ll_x[footprint.x_lower + 1]) - std::max(block_offset.ll.x, this->power_maps_bins_ll_x[footprint.x_lower])
+		) / this->power_maps_dim_x;
+	footprint.w_x_upper = std::max(0.0,
+			std::min(block_offset.ur.x, this->power_maps_bins_ll_x[footprint.x_upper]) - std::max(block_offset.ll.x, this->power_maps_bins_ll_x[footprint.x_upper - 1])
+		) / this->power_maps_dim_x;
+	footprint.w_y_lower = std::max(0.0,
+			std::min(block_offset.ur.y, this->power_maps_bins_ll_y[footprint.y_lower + 1]) - std::max(block_offset.ll.y, this->power_maps_bins_ll_y[footprint.y_lower])
+		) / this->power_maps_dim_y;
+	footprint.w_y_upper = std::max(0.0,
+			std::min(block_offset.ur.y, this->power_maps_bins_ll_y[footprint.y_upper]) - std::max(block_offset.ll.y, this->power_maps_bins_ll_y[footprint.y_upper - 1])
+		) / this->power_maps_dim_y;
+}
+
+inline void ThermalAnalyzer::applyBlockFootprint(BlockFootprint const& footprint, double const& sign, MaskParameters const& parameters) {
+	unsigned x, y;
+	double w_x, w;
+	double power_density;
+	double power_density_padding_zone;
+	Map2D<double>& map = this->power_maps_blocks[footprint.layer];
+
+	power_density = sign * footprint.power_density;
+	power_density_padding_zone = power_density * parameters.power_density_scaling_padding_zone;
+
+	// walk power-map bins covering block outline
+	for (x = footprint.x_lower; x < footprint.x_upper; x++) {
+
+		// weight of column; full weight for inner columns
+		if (x == footprint.x_lower) {
+			w_x = footprint.w_x_lower;
+		}
+		else if (x == footprint.x_upper - 1) {
+			w_x = footprint.w_x_upper;
+		}
+		else {
+			w_x = 1.0;
+		}
+
+		for (y = footprint.y_lower; y < footprint.y_upper; y++) {
+
+			// weight of bin; full weight for inner bins
+			if (y == footprint.y_lower) {
+				w = w_x * footprint.w_y_lower;
+			}
+			else if (y == footprint.y_upper - 1) {
+				w = w_x * footprint.w_y_upper;
+			}
+			else {
+				w = w_x;
+			}
+
+			// consider scaled block power density for bins w/in padding zone
+			if (
+					x < this->dims.power_maps_padded_bins
+					|| x >= (this->dims.power_maps - this->dims.power_maps_padded_bins)
+					|| y < this->dims.power_maps_padded_bins
+					|| y >= (this->dims.power_maps - this->dims.power_maps_padded_bins)
+			   ) {
+				map[x][y] += power_density_padding_zone * w;
+			}
+			else {
+				map[x][y] += power_density * w;
+			}
+		}
+	}
+}
+
 /// note that this function only accounts for (via TSVs improved heat conduction) lower
 /// local power consumption, not the (much smaller) increase of power consumption due to
 /// resistivity of TSVs; TSVs densities, required for HotSpot calculation, are also
@@ -494,13 +506,13 @@ void ThermalAnalyzer::adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Isla
 	}
 
 	// walk power-map bins; adapt power according to TSV densities
-	for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-		for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+	for (x = this->dims.power_maps_padded_bins; x < this->dims.thermal_map + this->dims.power_maps_padded_bins; x++) {
+		for (y = this->dims.power_maps_padded_bins; y < this->dims.thermal_map + this->dims.power_maps_padded_bins; y++) {
 
 			// sanity check; TSV density should be <= 100%; might be larger
 			// due to superposition in calculations above
 			for (i = 0; i < layers; i++) {
-				this->power_maps[i][x][y].TSV_density = std::min(100.0, this->power_maps[i][x][y].TSV_density);
+				this->TSV_density_maps[i][x][y] = std::min(100.0, this->TSV_density_maps[i][x][y]);
 			}
 
 			// adapt maps for all layers; the uppermost layer next the
@@ -508,7 +520,7 @@ void ThermalAnalyzer::adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Isla
 			for (i = 0; i < layers; i++) {
 
 				// ignore cases w/o TSVs
-				if (this->power_maps[i][x][y].TSV_density == 0.0)
+				if (this->TSV_density_maps[i][x][y] == 0.0)
 					continue;
 
 				// scaling depends on TSV density; the larger the TSV
@@ -516,9 +528,9 @@ void ThermalAnalyzer::adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Isla
 				// the factor power_density_scaling_TSV_region ranges b/w
 				// 0.0 and 1.0, whereas TSV_density ranges b/w 0.0 and
 				// 100.0
-				this->power_maps[i][x][y].power_density *=
+				this->power_maps[i][x][y] *=
 					1.0 +
-					((parameters.power_density_scaling_TSV_region - 1.0) / 100.0) * this->power_maps[i][x][y].TSV_density;
+					((parameters.power_density_scaling_TSV_region - 1.0) / 100.0) * this->TSV_density_maps[i][x][y];
 			}
 		}
 	}
@@ -549,8 +561,8 @@ void ThermalAnalyzer::adaptPowerMapsTSVsHelper(TSV_Island TSVi) {
 	y_lower = static_cast<unsigned>(TSVi.bb.ll.y / this->power_maps_dim_y);
 	// +1 in order to efficiently emulate the result of ceil(); limit upper
 	// bound to power-maps dimensions
-	x_upper = std::min(static_cast<unsigned>(TSVi.bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-	y_upper = std::min(static_cast<unsigned>(TSVi.bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+	x_upper = std::min(static_cast<unsigned>(TSVi.bb.ur.x / this->power_maps_dim_x) + 1, this->dims.power_maps);
+	y_upper = std::min(static_cast<unsigned>(TSVi.bb.ur.y / this->power_maps_dim_y) + 1, this->dims.power_maps);
 
 	if (ThermalAnalyzer::DBG) {
 		std::cout << "DBG> TSV group " << TSVi.id << std::endl;
@@ -567,7 +579,7 @@ void ThermalAnalyzer::adaptPowerMapsTSVsHelper(TSV_Island TSVi) {
 			if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
 
 				// adapt map on affected layer
-				this->power_maps[TSVi.layer][x][y].TSV_density += 100.0;
+				this->TSV_density_maps[TSVi.layer][x][y] += 100.0;
 			}
 			// else consider TSV density according to partial
 			// intersection with current bin
@@ -577,7 +589,7 @@ void ThermalAnalyzer::adaptPowerMapsTSVsHelper(TSV_Island TSVi) {
 				bin.ll.y = this->power_maps_bins_ll_y[y];
 				// note that +1 is guaranteed to be within
 				// bounds of power_maps_bins_ll_x/y (size
-				// = ThermalAnalyzer::POWER_MAPS_DIM + 1);
+				// = dims.power_maps + 1);
 				// the related last tuple describes the
 				// upper-right corner coordinates of the
 				// right/top boundary
@@ -590,7 +602,7 @@ void ThermalAnalyzer::adaptPowerMapsTSVsHelper(TSV_Island TSVi) {
 				bin_intersect.area /= this->power_maps_bin_area;
 
 				// adapt map on affected layer
-				this->power_maps[TSVi.layer][x][y].TSV_density += 100.0 * bin_intersect.area;
+				this->TSV_density_maps[TSVi.layer][x][y] += 100.0 * bin_intersect.area;
 			}
 		}
 	}
@@ -627,7 +639,7 @@ void ThermalAnalyzer::adaptPowerMapsWiresHelper(std::vector<Block>& wires, int c
 	}
 }
 
-void ThermalAnalyzer::adaptPowerMapsWires(std::vector<Block>& wires) {
+void ThermalAnalyzer::adaptPowerMapsWires(std::vector<Block> const& wires) {
 	double power_density;
 	unsigned x, y;
 	unsigned x_lower, x_upper, y_lower, y_upper;
@@ -657,8 +669,8 @@ void ThermalAnalyzer::adaptPowerMapsWires(std::vector<Block>& wires) {
 		y_lower = static_cast<unsigned>(net_bb.ll.y / this->power_maps_dim_y);
 		// +1 in order to efficiently emulate the result of ceil(); limit upper bound to
 		// power-maps dimensions
-		x_upper = std::min(static_cast<unsigned>(net_bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-		y_upper = std::min(static_cast<unsigned>(net_bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+		x_upper = std::min(static_cast<unsigned>(net_bb.ur.x / this->power_maps_dim_x) + 1, this->dims.power_maps);
+		y_upper = std::min(static_cast<unsigned>(net_bb.ur.y / this->power_maps_dim_y) + 1, this->dims.power_maps);
 
 		// determine power density
 		power_density = wires[layer].power_density_unscaled / net_bb.area;
@@ -672,7 +684,7 @@ void ThermalAnalyzer::adaptPowerMapsWires(std::vector<Block>& wires) {
 				// don't consider partial overlaps, any affected bin is considered
 				// as fully affected; the loss in accuracy is expected to be
 				// rather low
-				this->power_maps[layer][x][y].power_density += power_density;
+				this->power_maps[layer][x][y] += power_density;
 			}
 		}
 	}
@@ -687,154 +699,148 @@ void ThermalAnalyzer::adaptPowerMapsWires(std::vector<Block>& wires) {
 /// Based on a separated convolution using separated 2D gauss function, i.e., 1D gauss
 /// fct., see http://www.songho.ca/dsp/convolution/convolution.html#separable_convolution
 /// Returns thermal map of lowest layer, i.e., hottest layer
-void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const& layers, MaskParameters const& parameters) {
+/// power-blurring kernel; 2D convolution performed as two separated 1D convolutions
+/// over the contiguous, padded power-density planes of all layers; the loops are
+/// walking contiguous rows and are thus vectorized by the compiler
+///
+/// the kernel is a template over the map and mask dimensions, where 0 refers to
+/// dimensions provided at runtime; the default dimensions are handled by a
+/// compile-time specialization, such that the loop bounds are constant in that case
+template<unsigned MAP_DIM, unsigned MASK_DIM>
+static inline void performPowerBlurringKernelTemplate(std::vector< Map2D<double> > const& power_maps, std::vector< std::vector<double> > const& thermal_masks,
+		int const layers, double const temp_offset, ThermalAnalyzer::MapDimensions const& dims,
+		double* __restrict thermal_map_tmp, double* __restrict thermal_map) {
+	unsigned const THERMAL_MAP_DIM = MAP_DIM ? MAP_DIM : dims.thermal_map;
+	unsigned const THERMAL_MASK_DIM = MASK_DIM ? MASK_DIM : dims.thermal_mask;
+	unsigned const THERMAL_MASK_CENTER = THERMAL_MASK_DIM / 2;
+	unsigned const PADDED_BINS = THERMAL_MASK_CENTER;
+	unsigned const POWER_MAPS_DIM = THERMAL_MAP_DIM + 2 * PADDED_BINS;
 	int layer;
-	unsigned x, y, i;
-	unsigned map_x, map_y;
-	unsigned mask_i;
-	double max_temp, avg_temp;
-	// required as buffer for separated convolution; note that its dimensions
-	// corresponds to a power map, which is required to hold temporary results for 1D
-	// convolution of padded power maps
-	std::array< std::array<double, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM> thermal_map_tmp;
-
-	if (ThermalAnalyzer::DBG_CALLS) {
-		std::cout << "-> ThermalAnalyzer::performPowerBlurring(" << &ret << ", " << ", " << layers << ", " << &parameters << ")" << std::endl;
-	}
+	unsigned x, y, mask_i;
+	double mask;
+	double* __restrict tmp_row;
+	double* __restrict thermal_row;
+	double const* __restrict power_row;
+
+	// horizontal convolution; for each x, the rows of the power maps shifted by the
+	// mask offsets are accumulated (weighted by the related mask element) into
+	// thermal_map_tmp; note that we need to walk the full y-dimension related to the
+	// padded power map in order to reasonably model the thermal effect in the
+	// padding zone during subsequent vertical convolution, whereas the x-dimension
+	// is restricted to the range of the thermal map in order to exploit the padded
+	// power map w/o mask boundary checks
+	for (x = PADDED_BINS; x < THERMAL_MAP_DIM + PADDED_BINS; x++) {
+
+		tmp_row = thermal_map_tmp + x * POWER_MAPS_DIM;
+
+		for (y = 0; y < POWER_MAPS_DIM; y++) {
+			tmp_row[y] = 0.0;
+		}
 
-	// init temp map w/ zero
-	for (auto& m : thermal_map_tmp) {
-		m.fill(0.0);
-	}
+		for (layer = 0; layer < layers; layer++) {
+			for (mask_i = 0; mask_i < THERMAL_MASK_DIM; mask_i++) {
 
-	// init final map w/ temperature offset; offset is a additive factor, and thus not
-	// considered during convolution
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-			this->thermal_map[x][y].temp = parameters.temp_offset;
-		}
-	}
+				// power-map row, not out of range due to the padded power
+				// maps
+				power_row = power_maps[layer].data() + (x + mask_i - THERMAL_MASK_CENTER) * POWER_MAPS_DIM;
+				mask = thermal_masks[layer][mask_i];
 
-	/// perform 2D convolution by performing two separated 1D convolution iterations;
-	/// note that no (kernel) flipping is required since the mask is symmetric
-	//
-	// start w/ horizontal convolution (with which to start doesn't matter actually)
-	for (layer = 0; layer < layers; layer++) {
-
-		// walk power-map grid for horizontal convolution; store into
-		// thermal_map_tmp; note that during horizontal convolution we need to
-		// walk the full y-dimension related to the padded power map in order to
-		// reasonably model the thermal effect in the padding zone during
-		// subsequent vertical convolution
-		for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
-
-			// for the x-dimension during horizontal convolution, we need to
-			// restrict the considered range according to the thermal map in
-			// order to exploit the padded power map w/o mask boundary checks
-			for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-
-				// perform horizontal 1D convolution, i.e., multiply
-				// input[x] w/ mask
-				//
-				// e.g., for x = 0, THERMAL_MASK_DIM = 3
-				// convol1D(x=0) = input[-1] * mask[0] + input[0] * mask[1] + input[1] * mask[2]
-				//
-				// can be also illustrated by aligning and multiplying
-				// both arrays:
-				// input array (power map); unpadded view
-				// |x=-1|x=0|x=1|x=2|
-				// input array (power map); padded, real view
-				// |x=0 |x=1|x=2|x=3|
-				// mask:
-				// |m=0 |m=1|m=2|
-				//
-				for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
-
-					// determine power-map index; note that it is not
-					// out of range due to the padded power maps
-					i = x + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER);
-
-					if (ThermalAnalyzer::DBG) {
-
-						// mass of dbg messages; only for insane
-						// flag
-						if (ThermalAnalyzer::DBG_INSANE) {
-							std::cout << "DBG> y=" << y << ", x=" << x << ", mask_i=" << mask_i << ", i=" << i << std::endl;
-						}
-
-						if (i >= ThermalAnalyzer::POWER_MAPS_DIM) {
-							std::cout << "DBG> Convolution data error; i out of range (should be limited by x)" << std::endl;
-						}
-					}
-
-					// convolution; multiplication of mask element and
-					// power-map bin
-					thermal_map_tmp[x][y] +=
-						this->power_maps[layer][i][y].power_density *
-						this->thermal_masks[layer][mask_i];
+				for (y = 0; y < POWER_MAPS_DIM; y++) {
+					tmp_row[y] += power_row[y] * mask;
 				}
 			}
 		}
 	}
 
-	// continue w/ vertical convolution; here we convolute the temp thermal map (sized
-	// like the padded power map) w/ the thermal masks in order to obtain the final
-	// thermal map (sized like a non-padded power map)
-	for (layer = 0; layer < layers; layer++) {
+	// vertical convolution; here we convolute the temp thermal map (sized like the
+	// padded power map) w/ the thermal masks in order to obtain the final thermal
+	// map (sized like a non-padded power map); the final map is initialized w/ the
+	// temperature offset, which is an additive factor and thus not considered during
+	// convolution
+	for (x = 0; x < THERMAL_MAP_DIM; x++) {
+
+		thermal_row = thermal_map + x * THERMAL_MAP_DIM;
+		// row in temp map, considers padding offset
+		tmp_row = thermal_map_tmp + (x + PADDED_BINS) * POWER_MAPS_DIM;
 
-		// walk power-map grid for vertical convolution; convolute mask w/ data
-		// obtained by horizontal convolution (thermal_map_tmp)
-		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+		for (y = 0; y < THERMAL_MAP_DIM; y++) {
+			thermal_row[y] = temp_offset;
+		}
 
-			// index for final thermal map, considers padding offset
-			map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+		for (layer = 0; layer < layers; layer++) {
+			for (mask_i = 0; mask_i < THERMAL_MASK_DIM; mask_i++) {
 
-			for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+				mask = thermal_masks[layer][mask_i];
 
-				// index for final thermal map, considers padding offset
-				map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+				// the mask offset for y-index 0 of the thermal map is
+				// mask_i in the temp map, due to the padding
+				for (y = 0; y < THERMAL_MAP_DIM; y++) {
+					thermal_row[y] += tmp_row[y + mask_i] * mask;
+				}
+			}
+		}
+	}
+}
 
-				// perform 1D vertical convolution
-				for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+/// power-blurring kernel, specialized for default map and mask dimensions
+///
+/// the kernel is multi-versioned for AVX-512 and AVX2, w/ a scalar fallback, where
+/// the path is selected at runtime according to the executing CPU; note that the
+/// order of accumulation is the same for all paths, results thus differ at most by
+/// rounding of fused multiply-add instructions, if applied by the compiler
+POWER_BLURRING_KERNEL_ISA
+static void performPowerBlurringKernelDefaultDims(std::vector< Map2D<double> > const& power_maps, std::vector< std::vector<double> > const& thermal_masks,
+		int const layers, double const temp_offset, ThermalAnalyzer::MapDimensions const& dims,
+		double* __restrict thermal_map_tmp, double* __restrict thermal_map) {
+	performPowerBlurringKernelTemplate<ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT, ThermalAnalyzer::THERMAL_MASK_DIM_DEFAULT>
+		(power_maps, thermal_masks, layers, temp_offset, dims, thermal_map_tmp, thermal_map);
+}
 
-					// determine power-map index; note that it is not
-					// out of range due to the temp thermal map (sized
-					// like the padded power map)
-					i = y + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER);
+/// power-blurring kernel, for map and mask dimensions defined at runtime; also
+/// multi-versioned, see performPowerBlurringKernelDefaultDims
+POWER_BLURRING_KERNEL_ISA
+static void performPowerBlurringKernel(std::vector< Map2D<double> > const& power_maps, std::vector< std::vector<double> > const& thermal_masks,
+		int const layers, double const temp_offset, ThermalAnalyzer::MapDimensions const& dims,
+		double* __restrict thermal_map_tmp, double* __restrict thermal_map) {
+	performPowerBlurringKernelTemplate<0, 0>
+		(power_maps, thermal_masks, layers, temp_offset, dims, thermal_map_tmp, thermal_map);
+}
 
-					if (ThermalAnalyzer::DBG) {
+void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const& layers, MaskParameters const& parameters) {
+	unsigned x, y;
+	double max_temp, avg_temp;
 
-						// mass of dbg messages; only for insane
-						// flag
-						if (ThermalAnalyzer::DBG_INSANE) {
-							std::cout << "DBG> x=" << x << ", y=" << y << ", map_x=" << map_x << ", map_y=" << map_y;
-							std::cout << ", mask_i=" << mask_i << ", i=" << i << std::endl;
-						}
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "-> ThermalAnalyzer::performPowerBlurring(" << &ret << ", " << ", " << layers << ", " << &parameters << ")" << std::endl;
+	}
 
-						if (i >= ThermalAnalyzer::POWER_MAPS_DIM) {
-							std::cout << "DBG> Convolution data error; i out of range (should be limited by y)" << std::endl;
-						}
-					}
+	/// perform 2D convolution by performing two separated 1D convolution iterations;
+	/// note that no (kernel) flipping is required since the mask is symmetric
+	if (this->dims.thermal_map == ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT && this->dims.thermal_mask == ThermalAnalyzer::THERMAL_MASK_DIM_DEFAULT) {
+		performPowerBlurringKernelDefaultDims(this->power_maps, this->thermal_masks, layers, parameters.temp_offset, this->dims,
+				this->thermal_map_tmp.data(), this->thermal_map_temps.data());
+	}
+	else {
+		performPowerBlurringKernel(this->power_maps, this->thermal_masks, layers, parameters.temp_offset, this->dims,
+				this->thermal_map_tmp.data(), this->thermal_map_temps.data());
+	}
 
-					// convolution; multiplication of mask element and
-					// power-map bin
-					this->thermal_map[map_x][map_y].temp +=
-						thermal_map_tmp[x][i] *
-						this->thermal_masks[layer][mask_i];
-				}
-			}
+	// copy temperatures into thermal map
+	for (x = 0; x < this->dims.thermal_map; x++) {
+		for (y = 0; y < this->dims.thermal_map; y++) {
+			this->thermal_map[x][y].temp = this->thermal_map_temps[x][y];
 		}
 	}
 
 	// determine max and avg value
 	max_temp = avg_temp = 0.0;
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+	for (x = 0; x < this->dims.thermal_map; x++) {
+		for (y = 0; y < this->dims.thermal_map; y++) {
 			max_temp = std::max(max_temp, this->thermal_map[x][y].temp);
 			avg_temp += this->thermal_map[x][y].temp;
 		}
 	}
-	avg_temp /= std::pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+	avg_temp /= std::pow(this->dims.thermal_map, 2);
 
 	// determine cost: max temp estimation, weighted w/ avg temp
 	ret.cost_temp = avg_temp * max_temp;
@@ -849,3 +855,64 @@ void ThermalAnalyzer::performPowerBlurring(ThermalAnalysisResult& ret, int const
 		std::cout << "<- ThermalAnalyzer::performPowerBlurring" << std::endl;
 	}
 }
+
+/// the blurred temperatures are determined w/o temperature offset, the offset
+/// minimizing the squared error is then given by the mean deviation of the reference;
+/// note that the power maps are generated in the same order as during regular layout
+/// evaluation, i.e., blocks, wires, TSVs
+void ThermalAnalyzer::evaluateCalibration(CalibrationResult& candidate, int const& layers, std::vector<Block> const& blocks, Point const& die_outline,
+		std::vector<TSV_Island> const& TSVs, std::vector<TSV_Island> const& dummy_TSVs, std::vector<Block> const& wires,
+		Map2D<double> const& reference) {
+	ThermalAnalysisResult result;
+	unsigned x, y;
+	unsigned bins;
+	double deviation, deviation_mean, deviation_squared;
+	double max_temp, max_temp_reference;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "-> ThermalAnalyzer::evaluateCalibration(" << &candidate << ", " << layers << ", " << &blocks << ", (" << die_outline.x << ", " << die_outline.y << "), ";
+		std::cout << &TSVs << ", " << &dummy_TSVs << ", " << &wires << ", " << &reference << ")" << std::endl;
+	}
+
+	candidate.parameters.temp_offset = 0.0;
+
+	// thermal analysis for candidate parameters
+	this->initThermalMasks(layers, false, candidate.parameters);
+	this->generatePowerMaps(layers, blocks, die_outline, candidate.parameters);
+	this->adaptPowerMapsWires(wires);
+	this->adaptPowerMapsTSVs(layers, TSVs, dummy_TSVs, candidate.parameters);
+	this->performPowerBlurring(result, layers, candidate.parameters);
+
+	// determine mean deviation, i.e., the fitted temperature offset
+	bins = this->dims.thermal_map * this->dims.thermal_map;
+	deviation_mean = 0.0;
+	max_temp_reference = 0.0;
+	for (x = 0; x < this->dims.thermal_map; x++) {
+		for (y = 0; y < this->dims.thermal_map; y++) {
+			deviation_mean += reference[x][y] - this->thermal_map_temps[x][y];
+			max_temp_reference = std::max(max_temp_reference, reference[x][y]);
+		}
+	}
+	deviation_mean /= bins;
+
+	// determine errors, considering the fitted offset
+	deviation_squared = 0.0;
+	candidate.error_max = 0.0;
+	for (x = 0; x < this->dims.thermal_map; x++) {
+		for (y = 0; y < this->dims.thermal_map; y++) {
+			deviation = this->thermal_map_temps[x][y] + deviation_mean - reference[x][y];
+
+			deviation_squared += deviation * deviation;
+			candidate.error_max = std::max(candidate.error_max, std::abs(deviation));
+		}
+	}
+	max_temp = result.max_temp + deviation_mean;
+
+	candidate.error_rms = std::sqrt(deviation_squared / bins);
+	candidate.error_peak = max_temp - max_temp_reference;
+	candidate.parameters.temp_offset = deviation_mean;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "<- ThermalAnalyzer::evaluateCalibration : " << candidate.error_rms << std::endl;
+	}
+}
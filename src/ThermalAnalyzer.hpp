@@ -27,6 +27,7 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Block.hpp"
+#include "Map2D.hpp"
 // forward declarations, if any
 class Point;
 class Net;
@@ -45,21 +46,12 @@ class ThermalAnalyzer {
 	// public data
 	public:
 
-		/// represents the thermal map's dimension
-		static constexpr unsigned THERMAL_MAP_DIM = 64;
-		/// represents the thermal mask's dimension (i.e., the 2D gauss function
-		/// representing the thermal impulse response);
-		/// note that value should be uneven!
-		static constexpr unsigned THERMAL_MASK_DIM = 11;
-		/// represents the center index of the center originated mask; unsigned division
-		/// discards remainder, i.e., is equal to floor() for positive numbers
-		static constexpr unsigned THERMAL_MASK_CENTER = THERMAL_MASK_DIM / 2;
-		/// represents the amount of padded bins at power maps' boundaries
-		static constexpr unsigned POWER_MAPS_PADDED_BINS = THERMAL_MASK_CENTER;
-		/// represents the power maps' dimension
-		/// (note that maps are padded at the boundaries according to mask
-		/// dim in order to handle boundary values for convolution)
-		static constexpr unsigned POWER_MAPS_DIM = THERMAL_MAP_DIM + (THERMAL_MASK_DIM - 1);
+		/// default dimension of the thermal map; the power blurring is compiled
+		/// as specialized fast path for the default dimensions
+		static constexpr unsigned THERMAL_MAP_DIM_DEFAULT = 64;
+		/// default dimension of the thermal mask; the mask parameters in the
+		/// config files are calibrated for this dimension
+		static constexpr unsigned THERMAL_MASK_DIM_DEFAULT = 11;
 
 		/// specific id for hotspot detection
 		static constexpr unsigned HOTSPOT_BACKGROUND = 0;
@@ -89,13 +81,42 @@ class ThermalAnalyzer {
 			unsigned y;
 			Rect bb;
 			int hotspot_id;
-			std::list<ThermalMapBin*> neighbors;
 		};
 		struct ThermalAnalysisResult {
 			double cost_temp;
 			double max_temp;
 			double temp_offset;
-			std::array< std::array<ThermalMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> *thermal_map = nullptr;
+			Map2D<ThermalMapBin> *thermal_map = nullptr;
+		};
+		/// thermal-mask calibration: candidate parameters and their fitting
+		/// error against the reference thermal map
+		struct CalibrationResult {
+			MaskParameters parameters;
+			/// root-mean-square error over all bins [K]
+			double error_rms;
+			/// max absolute error over all bins [K]
+			double error_max;
+			/// deviation of max temperature from reference's max temperature [K]
+			double error_peak;
+		};
+		/// maps' dimensions; to be set via setMapDimensions
+		struct MapDimensions {
+			/// represents the thermal map's dimension
+			unsigned thermal_map;
+			/// represents the thermal mask's dimension (i.e., the 2D gauss
+			/// function representing the thermal impulse response);
+			/// note that value should be uneven!
+			unsigned thermal_mask;
+			/// represents the center index of the center originated mask;
+			/// unsigned division discards remainder, i.e., is equal to floor()
+			/// for positive numbers
+			unsigned thermal_mask_center;
+			/// represents the amount of padded bins at power maps' boundaries
+			unsigned power_maps_padded_bins;
+			/// represents the power maps' dimension
+			/// (note that maps are padded at the boundaries according to mask
+			/// dim in order to handle boundary values for convolution)
+			unsigned power_maps;
 		};
 
 	// private data, functions
@@ -107,24 +128,90 @@ class ThermalAnalyzer {
 		/// thermal_masks[1] relates to the mask for layer 0 obtained by
 		/// considering heat source in layer 1 and so forth.  Note that the masks
 		/// are only 1D for the separated convolution.
-		std::vector< std::array<double, THERMAL_MASK_DIM> > thermal_masks;
+		std::vector< std::vector<double> > thermal_masks;
 		/// power_maps[i][x][y], whereas power_maps[0] relates to the map for layer
-		/// 0 and so forth.
-		std::vector< std::array< std::array<PowerMapBin, POWER_MAPS_DIM>, POWER_MAPS_DIM> > power_maps;
+		/// 0 and so forth. Only holds the (padded) power densities, such that
+		/// the map of each layer is stored as contiguous plane, as required
+		/// for vectorized power blurring.
+		std::vector< Map2D<double> > power_maps;
+		/// TSV_density_maps[i][x][y], whereas TSV_density_maps[0] relates to the
+		/// map for layer 0 and so forth; same (padded) dimensions as power_maps
+		std::vector< Map2D<double> > TSV_density_maps;
 		/// original (i.e., unpadded and not adapted) power_maps_orig[i][x][y],
 		/// whereas power_maps[0] relates to the map for layer / 0 and so forth;
 		/// same dimensions as thermal map
-		std::vector< std::array< std::array<PowerMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> > power_maps_orig;
+		std::vector< Map2D<PowerMapBin> > power_maps_orig;
 		/// thermal map for layer 0 (lowest layer), i.e., hottest layer
-		std::array< std::array<ThermalMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> thermal_map;
+		Map2D<ThermalMapBin> thermal_map;
+		/// power maps considering only the blocks' power, same (padded)
+		/// dimensions as power_maps; these maps are updated incrementally in
+		/// generatePowerMaps, i.e., only for blocks w/ changed footprint
+		std::vector< Map2D<double> > power_maps_blocks;
+		/// cached rasterization of block's footprint in the padded power map,
+		/// as applied to power_maps_blocks; POD declaration
+		struct BlockFootprint {
+			/// block parameters as of rasterization
+			int layer;
+			Rect bb;
+			double power_density;
+			/// range of covered bins; upper bounds are excluded
+			unsigned x_lower, x_upper, y_lower, y_upper;
+			/// partial-coverage weights for the boundary strips, i.e., for
+			/// the first and last column/row of covered bins; fully covered
+			/// bins are weighted w/ 1.0
+			double w_x_lower, w_x_upper, w_y_lower, w_y_upper;
+		};
+		/// cached footprints, indexed like the blocks
+		std::vector<BlockFootprint> power_maps_footprints;
+		/// validity of cached footprints; parameters for which the cache is
+		/// valid, and counter for periodic full re-generation, which limits
+		/// numerical drift of the incrementally updated maps
+		struct power_maps_cache {
+			bool valid;
+			unsigned updates;
+			Point die_outline;
+			bool extend_boundary_blocks_into_padding_zone;
+			double power_density_scaling_padding_zone;
+		} power_maps_cache;
+		/// interval for full re-generation of power maps
+		static constexpr unsigned POWER_MAPS_FULL_UPDATE_INTERVAL = 100;
+		/// helper for power maps generation; determines rasterization of block
+		inline void determineBlockFootprint(Block const& block, Point const& die_outline, bool const& extend_boundary_blocks_into_padding_zone,
+				BlockFootprint& footprint) const;
+		/// helper for power maps generation; adds (sign = 1.0) or subtracts (sign
+		/// = -1.0) rasterized block to/from power_maps_blocks
+		inline void applyBlockFootprint(BlockFootprint const& footprint, double const& sign, MaskParameters const& parameters);
+
+		/// buffers for power blurring; the temp buffer is sized like a padded
+		/// power map, required to hold temporary results for 1D convolution of
+		/// padded power maps; the other buffer holds the final temperatures
+		Map2D<double> thermal_map_tmp, thermal_map_temps;
 
 	// constructors, destructors, if any non-implicit
 	public:
+		/// default constructor
+		ThermalAnalyzer() {
+			this->setMapDimensions(THERMAL_MAP_DIM_DEFAULT, THERMAL_MASK_DIM_DEFAULT);
+			this->power_maps_cache.valid = false;
+		};
 
 	// public data, functions
 	public:
 		friend class IO;
 
+		/// maps' dimensions; note that the maps and masks have to be
+		/// (re-)initialized after changing the dimensions
+		MapDimensions dims;
+
+		/// setter for maps' dimensions, also derives the dependent dimensions
+		inline void setMapDimensions(unsigned const& thermal_map_dim, unsigned const& thermal_mask_dim) {
+			this->dims.thermal_map = thermal_map_dim;
+			this->dims.thermal_mask = thermal_mask_dim;
+			this->dims.thermal_mask_center = thermal_mask_dim / 2;
+			this->dims.power_maps_padded_bins = this->dims.thermal_mask_center;
+			this->dims.power_maps = thermal_map_dim + (thermal_mask_dim - 1);
+		};
+
 		/// thermal modeling: parameters for generating thermal maps
 		double thermal_map_dim_x, thermal_map_dim_y;
 		/// thermal modeling: parameters for generating power maps
@@ -136,7 +223,7 @@ class ThermalAnalyzer {
 		/// thermal modeling: parameters for generating power maps
 		double padding_right_boundary_blocks_distance, padding_upper_boundary_blocks_distance;
 		/// thermal modeling: parameters for generating power maps
-		std::array<double, POWER_MAPS_DIM + 1> power_maps_bins_ll_x, power_maps_bins_ll_y;
+		std::vector<double> power_maps_bins_ll_x, power_maps_bins_ll_y;
 		/// thermal modeling: parameters for generating power maps
 		static constexpr double PADDING_ZONE_BLOCKS_DISTANCE_LIMIT = 0.01;
 		/// material parameters for thermal 3D-IC simulation using HotSpot
@@ -252,27 +339,40 @@ class ThermalAnalyzer {
 		void adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Island> TSVs, std::vector<TSV_Island> dummy_TSVs, MaskParameters const& parameters);
 		void adaptPowerMapsTSVsHelper(TSV_Island TSVi);
 		/// thermal modeling: handlers
-		void adaptPowerMapsWires(std::vector<Block>& wires);
+		void adaptPowerMapsWires(std::vector<Block> const& wires);
 		void adaptPowerMapsWiresHelper(std::vector<Block>& wires, int const& layer, Rect const& net_bb, double const& total_wire_power);
 		/// thermal-analyzer routine based on power blurring,
 		/// i.e., convolution of thermals masks and power maps
 		void performPowerBlurring(ThermalAnalysisResult& ret, int const& layers, MaskParameters const& parameters);
+		/// thermal-mask calibration: evaluates the candidate's parameters for
+		/// the given layout against the reference thermal map (lowest layer);
+		/// the candidate's temperature offset is not evaluated but fitted, and
+		/// updated accordingly; the analyzer has to be initialized for the
+		/// reference's dimensions
+		void evaluateCalibration(CalibrationResult& candidate, int const& layers, std::vector<Block> const& blocks, Point const& die_outline,
+				std::vector<TSV_Island> const& TSVs, std::vector<TSV_Island> const& dummy_TSVs, std::vector<Block> const& wires,
+				Map2D<double> const& reference);
 
 		/// getter
-		inline std::vector< std::array< std::array<PowerMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> > const& getPowerMapsOrig() const {
+		inline std::vector< Map2D<PowerMapBin> > const& getPowerMapsOrig() const {
 			return this->power_maps_orig;
 		};
 
 		/// getter
-		inline std::vector< std::array< std::array<PowerMapBin, POWER_MAPS_DIM>, POWER_MAPS_DIM> > const& getPowerMaps() const {
+		inline std::vector< Map2D<double> > const& getPowerMaps() const {
 			return this->power_maps;
 		};
 
 		/// getter; may also edit the power_maps
-		inline std::vector< std::array< std::array<PowerMapBin, POWER_MAPS_DIM>, POWER_MAPS_DIM> >& editPowerMaps() {
+		inline std::vector< Map2D<double> >& editPowerMaps() {
 			return this->power_maps;
 		};
 
+		/// getter
+		inline std::vector< Map2D<double> > const& getTSVDensityMaps() const {
+			return this->TSV_density_maps;
+		};
+
 };
 
 #endif
@@ -0,0 +1,1102 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar 3D thermal solver, based on steady-state finite-volume
+ *    analysis of the 3D-IC stack and package
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "ThermalSolver.hpp"
+// required Corblivar headers
+#include "ThermalAnalyzer.hpp"
+#include "Point.hpp"
+#include "Rect.hpp"
+#include "Math.hpp"
+
+// memory allocation
+constexpr double ThermalSolver::TOLERANCE;
+
+void ThermalSolver::initSolver(int const& layers, unsigned const& dim, Point const& die_outline, Stack const& stack) {
+	unsigned x, y, layer, p;
+	unsigned level_dim, coarse_dim;
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "-> ThermalSolver::initSolver(" << layers << ", " << dim << ", " << die_outline.x << ", " << die_outline.y << ", " << &stack << ")" << std::endl;
+	}
+
+	// same geometry and stack; system and warm start remain valid
+	if (layers == this->dies && dim == this->dim && die_outline.x == this->outline_x && die_outline.y == this->outline_y && stack == this->stack) {
+
+		if (ThermalSolver::DBG_CALLS) {
+			std::cout << "<- ThermalSolver::initSolver" << std::endl;
+		}
+
+		return;
+	}
+
+	// changed die outline or stack; the conductances have to be re-assembled, but
+	// the system's structure and the warm start remain applicable
+	this->system_valid = false;
+	this->stack = stack;
+
+	// bins' dimensions, like for thermal map
+	this->outline_x = die_outline.x;
+	this->outline_y = die_outline.y;
+	this->bin_w = die_outline.x / dim;
+	this->bin_h = die_outline.y / dim;
+
+	if (layers == this->dies && dim == this->dim) {
+
+		if (ThermalSolver::DBG_CALLS) {
+			std::cout << "<- ThermalSolver::initSolver" << std::endl;
+		}
+
+		return;
+	}
+
+	this->dies = layers;
+	this->dim = dim;
+
+	// BEOL, active Si and passive Si layer for each die, bonding layers b/w the
+	// dies, and heat spreader and heatsink on top of the uppermost die
+	this->stack_layers = 4 * layers - 1 + 2;
+	this->nodes = dim * dim * this->stack_layers + ThermalSolver::PERIPHERY_NODES;
+
+	// allocate vectors
+	this->power.assign(this->nodes, 0.0);
+	this->temps.assign(this->nodes, 0.0);
+	this->residual.assign(this->nodes, 0.0);
+	this->direction.assign(this->nodes, 0.0);
+	this->product.assign(this->nodes, 0.0);
+	this->TSV_densities.assign(layers * dim * dim, 0.0);
+	// previous solution not applicable anymore
+	this->temps_accepted.clear();
+
+	this->thermal_maps.assign(layers, Map2D<double>(dim, dim, ThermalSolver::AMBIENT_TEMP));
+
+	/// multigrid levels; the bins along x and y are halved for each level, until
+	/// the dimension of the coarsest level is reached
+	this->levels.clear();
+	level_dim = dim;
+	while (true) {
+
+		this->levels.emplace_back();
+		Level& level = this->levels.back();
+
+		level.dim = level_dim;
+		level.nodes = level_dim * level_dim * this->stack_layers + ThermalSolver::PERIPHERY_NODES;
+		// the actual grid is always partitioned in the same way, as required for
+		// reductions w/ results independent of the thread count
+		if (this->levels.size() == 1) {
+			level.partitions = ThermalSolver::PARTITIONS;
+		}
+		else {
+			level.partitions = std::max(1u, std::min(ThermalSolver::PARTITIONS, level_dim * level_dim / ThermalSolver::PARTITION_COLUMNS_MIN));
+		}
+
+		level.diag.assign(level.nodes, 0.0);
+		level.vertical.assign(level.nodes, 0.0);
+		level.row_ptr.assign(level.nodes + 1, 0);
+		level.inv_pivot.assign(level.nodes, 0.0);
+		level.coupling.assign(level.nodes, 0.0);
+		level.rhs.assign(level.nodes, 0.0);
+		level.sol.assign(level.nodes, 0.0);
+		level.res.assign(level.nodes, 0.0);
+		level.prev.assign(level.nodes, 0.0);
+
+		if (level_dim <= ThermalSolver::MG_COARSEST_DIM) {
+			break;
+		}
+
+		level_dim = (level_dim + 1) / 2;
+	}
+
+	// nodes of next coarser level, i.e., aggregates of 2x2 bins in the same layer;
+	// periphery nodes are retained as is
+	for (unsigned l = 0; l + 1 < this->levels.size(); l++) {
+
+		Level& level = this->levels[l];
+		coarse_dim = this->levels[l + 1].dim;
+
+		level.aggregate.resize(level.nodes);
+
+		for (x = 0; x < level.dim; x++) {
+			for (y = 0; y < level.dim; y++) {
+				for (layer = 0; layer < this->stack_layers; layer++) {
+					level.aggregate[(x * level.dim + y) * this->stack_layers + layer] =
+						((x / 2) * coarse_dim + y / 2) * this->stack_layers + layer;
+				}
+			}
+		}
+		for (p = 0; p < ThermalSolver::PERIPHERY_NODES; p++) {
+			level.aggregate[level.dim * level.dim * this->stack_layers + p] = coarse_dim * coarse_dim * this->stack_layers + p;
+		}
+	}
+
+	if (ThermalSolver::DBG) {
+		std::cout << "DBG_THERMAL_SOLVER> Stack layers: " << this->stack_layers << "; nodes: " << this->nodes << "; multigrid levels: " << this->levels.size() << std::endl;
+	}
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "<- ThermalSolver::initSolver" << std::endl;
+	}
+}
+
+double ThermalSolver::thickness(unsigned const& layer) const {
+
+	// heatsink
+	if (layer == this->stack_layers - 1) {
+		return ThermalSolver::SINK_THICKNESS;
+	}
+	// heat spreader
+	else if (layer == this->stack_layers - 2) {
+		return ThermalSolver::SPREADER_THICKNESS;
+	}
+
+	// layers of dies, given in [um]; order as in lcf file, see
+	// IO::writeHotSpotFiles
+	switch (layer % 4) {
+		case 0:
+			return this->stack.BEOL_thickness * Math::SCALE_UM_M;
+		case 1:
+			return this->stack.Si_active_thickness * Math::SCALE_UM_M;
+		case 2:
+			return this->stack.Si_passive_thickness * Math::SCALE_UM_M;
+		default:
+			return this->stack.bond_thickness * Math::SCALE_UM_M;
+	}
+}
+
+double ThermalSolver::conductivity(unsigned const& layer, unsigned const& x, unsigned const& y) const {
+	double TSV_density;
+
+	// heatsink
+	if (layer == this->stack_layers - 1) {
+		return ThermalSolver::SINK_CONDUCTIVITY;
+	}
+	// heat spreader
+	else if (layer == this->stack_layers - 2) {
+		return ThermalSolver::SPREADER_CONDUCTIVITY;
+	}
+
+	// layers of dies; BEOL and active Si w/ homogeneous material, passive Si and
+	// bonding layers w/ TSV-density-dependent compound material
+	switch (layer % 4) {
+		case 0:
+			return 1.0 / ThermalAnalyzer::THERMAL_RESISTIVITY_BEOL;
+		case 1:
+			return 1.0 / ThermalAnalyzer::THERMAL_RESISTIVITY_SI;
+	}
+
+	TSV_density = this->TSV_densities[((layer / 4) * this->dim + x) * this->dim + y];
+
+	if (layer % 4 == 2) {
+		return 1.0 / ThermalAnalyzer::thermResSi(this->stack.TSV_group_Cu_area_ratio, TSV_density);
+	}
+	else {
+		return 1.0 / ThermalAnalyzer::thermResBond(this->stack.TSV_group_Cu_area_ratio, TSV_density);
+	}
+}
+
+void ThermalSolver::addPower(Rect const& bb, double const& power, unsigned const& layer) {
+	unsigned x, y;
+	unsigned x_lower, x_upper, y_lower, y_upper;
+	Rect bin, bin_intersect;
+
+	if (bb.area == 0.0 || power == 0.0) {
+		return;
+	}
+
+	// determine index boundaries for bb; limited to die outline; note that casting
+	// truncates toward zero, i.e., performs like floor for positive numbers
+	x_lower = static_cast<unsigned>(std::max(0.0, bb.ll.x) / this->bin_w);
+	y_lower = static_cast<unsigned>(std::max(0.0, bb.ll.y) / this->bin_h);
+	// +1 in order to efficiently emulate the result of ceil()
+	x_upper = std::min(static_cast<unsigned>(bb.ur.x / this->bin_w) + 1, this->dim);
+	y_upper = std::min(static_cast<unsigned>(bb.ur.y / this->bin_h) + 1, this->dim);
+
+	// walk bins covering bb; power is distributed according to intersection
+	for (x = x_lower; x < x_upper; x++) {
+
+		bin.ll.x = x * this->bin_w;
+		bin.ur.x = (x + 1) * this->bin_w;
+
+		for (y = y_lower; y < y_upper; y++) {
+
+			bin.ll.y = y * this->bin_h;
+			bin.ur.y = (y + 1) * this->bin_h;
+
+			bin_intersect = Rect::determineIntersection(bin, bb);
+
+			this->power[this->node(x, y, layer)] += power * (bin_intersect.area / bb.area);
+		}
+	}
+}
+
+void ThermalSolver::assembleSystem(std::vector<Block> const& blocks, std::vector<Block> const& wires,
+		std::vector< Map2D<double> > const& TSV_density_maps, unsigned const& TSV_density_maps_offset) {
+	int die;
+	unsigned x, y, i;
+	double TSV_density;
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "-> ThermalSolver::assembleSystem(" << &blocks << ", " << &wires << ", " << &TSV_density_maps << ", " << TSV_density_maps_offset << ")" << std::endl;
+	}
+
+	/// power vector; blocks' power in active Si layers, wires' power in BEOL layers,
+	/// as for HotSpot
+	std::fill(this->power.begin(), this->power.end(), 0.0);
+
+	for (Block const& block : blocks) {
+		this->addPower(block.bb, block.power(), 4 * block.layer + 1);
+	}
+	for (unsigned w = 0; w < wires.size() && w < static_cast<unsigned>(this->dies); w++) {
+		// actual power encoded in power_density_unscaled, see
+		// ThermalAnalyzer::adaptPowerMapsWires
+		this->addPower(wires[w].bb, wires[w].power_density_unscaled, 4 * w);
+	}
+
+	/// TSV densities; the conductances are only to be re-assembled for changed
+	/// densities, which is not the case for most layout operations
+	i = 0;
+	for (die = 0; die < this->dies; die++) {
+		for (x = 0; x < this->dim; x++) {
+			for (y = 0; y < this->dim; y++, i++) {
+
+				if (static_cast<unsigned>(die) < TSV_density_maps.size()) {
+					TSV_density = TSV_density_maps[die][x + TSV_density_maps_offset][y + TSV_density_maps_offset];
+				}
+				else {
+					TSV_density = 0.0;
+				}
+
+				if (TSV_density != this->TSV_densities[i]) {
+					this->TSV_densities[i] = TSV_density;
+					this->system_valid = false;
+				}
+			}
+		}
+	}
+
+	if (!this->system_valid) {
+
+		this->assembleConductances();
+		this->assembleLevels();
+
+		this->system_valid = true;
+	}
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "<- ThermalSolver::assembleSystem" << std::endl;
+	}
+}
+
+/// the conductances b/w nodes are derived as series of the half-bin resistances of both
+/// nodes, as for HotSpot's grid model; the package periphery is modelled by one node
+/// per side and part, w/ the conductances derived from the mean distances and the
+/// areas of the parts
+void ThermalSolver::assembleConductances() {
+	unsigned x, y, layer, side, b;
+	unsigned n, i, k;
+	unsigned const spreader = this->stack_layers - 2;
+	unsigned const sink = this->stack_layers - 1;
+	double t, t_next;
+	double len, half_bin, overhang;
+	std::vector<double> conductivities;
+	std::vector<unsigned> cursor;
+	Level& level = this->levels[0];
+
+	// geometry in [m]
+	double const bin_w = this->bin_w * Math::SCALE_UM_M;
+	double const bin_h = this->bin_h * Math::SCALE_UM_M;
+	double const bin_area = bin_w * bin_h;
+	double const outline_x = this->outline_x * Math::SCALE_UM_M;
+	double const outline_y = this->outline_y * Math::SCALE_UM_M;
+	double const outline_area = outline_x * outline_y;
+	// overhang of spreader beyond die outline, and of heatsink beyond spreader;
+	// limited for (unrealistic) die outlines larger than the spreader
+	double const overhang_x = std::max(0.0, ThermalSolver::SPREADER_SIDE - outline_x) / 2.0;
+	double const overhang_y = std::max(0.0, ThermalSolver::SPREADER_SIDE - outline_y) / 2.0;
+	double const overhang_sink = (ThermalSolver::SINK_SIDE - ThermalSolver::SPREADER_SIDE) / 2.0;
+	// areas of periphery parts, for each side
+	double const spreader_part_area = std::max(0.0, std::pow(ThermalSolver::SPREADER_SIDE, 2.0) - outline_area) / 4.0;
+	double const sink_part_area = (std::pow(ThermalSolver::SINK_SIDE, 2.0) - std::pow(ThermalSolver::SPREADER_SIDE, 2.0)) / 4.0;
+	double const sink_area = std::pow(ThermalSolver::SINK_SIDE, 2.0);
+
+	this->edges.clear();
+	std::fill(level.diag.begin(), level.diag.end(), 0.0);
+	std::fill(level.vertical.begin(), level.vertical.end(), 0.0);
+
+	/// conductivities of all grid nodes
+	conductivities.resize(this->dim * this->dim * this->stack_layers);
+	for (x = 0; x < this->dim; x++) {
+		for (y = 0; y < this->dim; y++) {
+			for (layer = 0; layer < this->stack_layers; layer++) {
+				conductivities[this->node(x, y, layer)] = this->conductivity(layer, x, y);
+			}
+		}
+	}
+
+	/// conductances of grid nodes; lateral to next bins along x and y, vertical to
+	/// next upper layer
+	for (layer = 0; layer < this->stack_layers; layer++) {
+
+		t = this->thickness(layer);
+		t_next = (layer + 1 < this->stack_layers) ? this->thickness(layer + 1) : 0.0;
+
+		for (x = 0; x < this->dim; x++) {
+			for (y = 0; y < this->dim; y++) {
+
+				n = this->node(x, y, layer);
+
+				if (x + 1 < this->dim) {
+					this->addEdge(n, this->node(x + 1, y, layer),
+							t * bin_h / (bin_w / (2.0 * conductivities[n]) + bin_w / (2.0 * conductivities[this->node(x + 1, y, layer)])));
+				}
+				if (y + 1 < this->dim) {
+					this->addEdge(n, this->node(x, y + 1, layer),
+							t * bin_w / (bin_h / (2.0 * conductivities[n]) + bin_h / (2.0 * conductivities[this->node(x, y + 1, layer)])));
+				}
+				if (layer + 1 < this->stack_layers) {
+					level.vertical[n] = bin_area / (t / (2.0 * conductivities[n]) + t_next / (2.0 * conductivities[n + 1]));
+					this->addEdge(n, n + 1, level.vertical[n]);
+				}
+			}
+		}
+	}
+
+	/// conductances to ambient; secondary path for lowest layer, convection for
+	/// heatsink, where the convection resistance is distributed by area
+	for (x = 0; x < this->dim; x++) {
+		for (y = 0; y < this->dim; y++) {
+			level.diag[this->node(x, y, 0)] += bin_area / (outline_area * ThermalSolver::CONVECTION_RESISTANCE_SECONDARY);
+			level.diag[this->node(x, y, sink)] += bin_area / (sink_area * ThermalSolver::CONVECTION_RESISTANCE);
+		}
+	}
+
+	/// package periphery
+	for (side = 0; side < 4; side++) {
+
+		// W and E sides are adjacent to the first and last column of bins, S and N
+		// sides to the first and last row of bins
+		if (side < 2) {
+			len = bin_h;
+			half_bin = bin_w / 2.0;
+			overhang = overhang_x;
+		}
+		else {
+			len = bin_w;
+			half_bin = bin_h / 2.0;
+			overhang = overhang_y;
+		}
+
+		// lateral conductances from boundary bins of spreader and heatsink
+		for (b = 0; b < this->dim; b++) {
+
+			x = (side == 0) ? 0 : (side == 1) ? this->dim - 1 : b;
+			y = (side == 2) ? 0 : (side == 3) ? this->dim - 1 : b;
+
+			this->addEdge(this->node(x, y, spreader), this->peripheryNode(side, 0),
+					ThermalSolver::SPREADER_CONDUCTIVITY * ThermalSolver::SPREADER_THICKNESS * len / (half_bin + overhang / 2.0));
+			this->addEdge(this->node(x, y, sink), this->peripheryNode(side, 1),
+					ThermalSolver::SINK_CONDUCTIVITY * ThermalSolver::SINK_THICKNESS * len / (half_bin + overhang / 2.0));
+		}
+
+		// vertical conductance from spreader periphery to heatsink below
+		this->addEdge(this->peripheryNode(side, 0), this->peripheryNode(side, 1),
+				spreader_part_area / (ThermalSolver::SPREADER_THICKNESS / (2.0 * ThermalSolver::SPREADER_CONDUCTIVITY) +
+					ThermalSolver::SINK_THICKNESS / (2.0 * ThermalSolver::SINK_CONDUCTIVITY)));
+
+		// lateral conductance from heatsink below spreader to outer heatsink
+		this->addEdge(this->peripheryNode(side, 1), this->peripheryNode(side, 2),
+				ThermalSolver::SINK_CONDUCTIVITY * ThermalSolver::SINK_THICKNESS * ThermalSolver::SPREADER_SIDE / ((overhang + overhang_sink) / 2.0));
+
+		// convection
+		level.diag[this->peripheryNode(side, 1)] += spreader_part_area / (sink_area * ThermalSolver::CONVECTION_RESISTANCE);
+		level.diag[this->peripheryNode(side, 2)] += sink_part_area / (sink_area * ThermalSolver::CONVECTION_RESISTANCE);
+	}
+
+	/// off-diagonal conductances in CSR format; the edges are sorted into rows by
+	/// counting, such that the order is deterministic
+	std::fill(level.row_ptr.begin(), level.row_ptr.end(), 0);
+	for (Edge const& e : this->edges) {
+		level.row_ptr[e.i + 1]++;
+		level.row_ptr[e.j + 1]++;
+	}
+	for (i = 0; i < this->nodes; i++) {
+		level.row_ptr[i + 1] += level.row_ptr[i];
+	}
+	level.col_idx.resize(2 * this->edges.size());
+	level.values.resize(2 * this->edges.size());
+
+	cursor.assign(level.row_ptr.begin(), level.row_ptr.end() - 1);
+	for (Edge const& e : this->edges) {
+		k = cursor[e.i]++;
+		level.col_idx[k] = e.j;
+		level.values[k] = e.conductance;
+
+		k = cursor[e.j]++;
+		level.col_idx[k] = e.i;
+		level.values[k] = e.conductance;
+	}
+
+	if (ThermalSolver::DBG) {
+		std::cout << "DBG_THERMAL_SOLVER> Edges: " << this->edges.size() << std::endl;
+	}
+}
+
+/// for aggregation, the Galerkin projection simply sums up the conductances b/w the
+/// nodes of different aggregates, whereas conductances within aggregates cancel out
+/// for the diagonal; the vertical conductances of each aggregate remain in the same
+/// bin column, thus the line smoother is applicable for all levels
+void ThermalSolver::assembleLevels() {
+	unsigned l, i, k, n, I, J;
+	unsigned column, layer;
+	unsigned coarsest_nodes, r, c;
+	double pivot, sum;
+	std::vector<unsigned> members_ptr, members, cursor;
+	std::vector<int> position;
+
+	/// systems of coarser levels
+	for (l = 1; l < this->levels.size(); l++) {
+
+		Level const& fine = this->levels[l - 1];
+		Level& coarse = this->levels[l];
+
+		// nodes of each aggregate, sorted by counting
+		members_ptr.assign(coarse.nodes + 1, 0);
+		for (i = 0; i < fine.nodes; i++) {
+			members_ptr[fine.aggregate[i] + 1]++;
+		}
+		for (I = 0; I < coarse.nodes; I++) {
+			members_ptr[I + 1] += members_ptr[I];
+		}
+		members.resize(fine.nodes);
+		cursor.assign(members_ptr.begin(), members_ptr.end() - 1);
+		for (i = 0; i < fine.nodes; i++) {
+			members[cursor[fine.aggregate[i]]++] = i;
+		}
+
+		// conductances of each aggregate; conductances to the same other
+		// aggregate are merged via their position in the current row
+		position.assign(coarse.nodes, -1);
+		coarse.col_idx.clear();
+		coarse.values.clear();
+
+		for (I = 0; I < coarse.nodes; I++) {
+
+			coarse.row_ptr[I] = coarse.col_idx.size();
+			coarse.diag[I] = coarse.vertical[I] = 0.0;
+
+			for (k = members_ptr[I]; k < members_ptr[I + 1]; k++) {
+
+				i = members[k];
+
+				coarse.diag[I] += fine.diag[i];
+				coarse.vertical[I] += fine.vertical[i];
+
+				for (n = fine.row_ptr[i]; n < fine.row_ptr[i + 1]; n++) {
+
+					J = fine.aggregate[fine.col_idx[n]];
+
+					if (J == I) {
+						coarse.diag[I] -= fine.values[n];
+					}
+					else if (position[J] == -1) {
+						position[J] = coarse.col_idx.size();
+						coarse.col_idx.push_back(J);
+						coarse.values.push_back(fine.values[n]);
+					}
+					else {
+						coarse.values[position[J]] += fine.values[n];
+					}
+				}
+			}
+
+			for (n = coarse.row_ptr[I]; n < coarse.col_idx.size(); n++) {
+				position[coarse.col_idx[n]] = -1;
+			}
+		}
+		coarse.row_ptr[coarse.nodes] = coarse.col_idx.size();
+	}
+
+	/// line smoother; factorization of the tridiagonal block of each bin column,
+	/// i.e., of the diagonal and the vertical conductances
+	for (Level& level : this->levels) {
+
+		for (column = 0; column < level.dim * level.dim; column++) {
+
+			n = column * this->stack_layers;
+
+			for (layer = 0; layer < this->stack_layers; layer++, n++) {
+
+				pivot = level.diag[n];
+				if (layer > 0) {
+					pivot -= level.vertical[n - 1] * level.coupling[n - 1];
+				}
+
+				level.inv_pivot[n] = 1.0 / pivot;
+				level.coupling[n] = level.vertical[n] * level.inv_pivot[n];
+			}
+		}
+		// plain Jacobi smoothing for periphery nodes
+		for (n = level.dim * level.dim * this->stack_layers; n < level.nodes; n++) {
+			level.inv_pivot[n] = 1.0 / level.diag[n];
+			level.coupling[n] = 0.0;
+		}
+	}
+
+	/// coarsest level; dense Cholesky factorization
+	Level const& coarsest = this->levels.back();
+	coarsest_nodes = coarsest.nodes;
+
+	this->coarsest_factor.assign(coarsest_nodes * coarsest_nodes, 0.0);
+	for (r = 0; r < coarsest_nodes; r++) {
+
+		this->coarsest_factor[r * coarsest_nodes + r] = coarsest.diag[r];
+
+		for (k = coarsest.row_ptr[r]; k < coarsest.row_ptr[r + 1]; k++) {
+			this->coarsest_factor[r * coarsest_nodes + coarsest.col_idx[k]] -= coarsest.values[k];
+		}
+	}
+	for (c = 0; c < coarsest_nodes; c++) {
+
+		sum = this->coarsest_factor[c * coarsest_nodes + c];
+		for (k = 0; k < c; k++) {
+			sum -= std::pow(this->coarsest_factor[c * coarsest_nodes + k], 2.0);
+		}
+		this->coarsest_factor[c * coarsest_nodes + c] = std::sqrt(sum);
+
+		for (r = c + 1; r < coarsest_nodes; r++) {
+
+			sum = this->coarsest_factor[r * coarsest_nodes + c];
+			for (k = 0; k < c; k++) {
+				sum -= this->coarsest_factor[r * coarsest_nodes + k] * this->coarsest_factor[c * coarsest_nodes + k];
+			}
+			this->coarsest_factor[r * coarsest_nodes + c] = sum / this->coarsest_factor[c * coarsest_nodes + c];
+		}
+	}
+
+	if (ThermalSolver::DBG) {
+		for (l = 0; l < this->levels.size(); l++) {
+			std::cout << "DBG_THERMAL_SOLVER> Multigrid level " << l << "; dimension: " << this->levels[l].dim << "; nodes: " << this->levels[l].nodes;
+			std::cout << "; conductances: " << this->levels[l].col_idx.size() / 2 << std::endl;
+		}
+	}
+}
+
+void ThermalSolver::multiply(Level const& level, unsigned const& partition, std::vector<double> const& in, std::vector<double>& out) const {
+	unsigned i, k, begin, end;
+	double sum;
+
+	this->partitionNodes(level, partition, begin, end);
+
+	for (i = begin; i < end; i++) {
+
+		sum = level.diag[i] * in[i];
+
+		for (k = level.row_ptr[i]; k < level.row_ptr[i + 1]; k++) {
+			sum -= level.values[k] * in[level.col_idx[k]];
+		}
+
+		out[i] = sum;
+	}
+}
+
+void ThermalSolver::determineResidual(Level& level, unsigned const& partition) const {
+	unsigned i, begin, end;
+
+	this->multiply(level, partition, level.sol, level.res);
+
+	this->partitionNodes(level, partition, begin, end);
+
+	for (i = begin; i < end; i++) {
+		level.res[i] = level.rhs[i] - level.res[i];
+	}
+}
+
+/// damped line Jacobi, i.e., exact solve for the vertical heat flow of each bin column,
+/// which dominates the conductances of the dies, and plain Jacobi for the lateral heat
+/// flow, which dominates for spreader and heatsink and is handled by the coarser
+/// levels; the residual is expected to be determined already, except for the initial
+/// sweep w/ zero solution where the residual equals the right-hand side
+void ThermalSolver::smooth(Level& level, unsigned const& partition, bool const& init) const {
+	unsigned i, n, begin, end, layer;
+	unsigned const grid_nodes = level.dim * level.dim * this->stack_layers;
+
+	this->partitionNodes(level, partition, begin, end);
+
+	if (init) {
+		for (i = begin; i < end; i++) {
+			level.res[i] = level.rhs[i];
+		}
+	}
+
+	// forward and backward substitution for the tridiagonal block of each bin
+	// column, in place
+	for (i = begin; i < std::min(end, grid_nodes); i += this->stack_layers) {
+
+		for (layer = 1, n = i + 1; layer < this->stack_layers; layer++, n++) {
+			level.res[n] += level.coupling[n - 1] * level.res[n - 1];
+		}
+
+		n = i + this->stack_layers - 1;
+		level.res[n] *= level.inv_pivot[n];
+		for (layer = 1, n--; layer < this->stack_layers; layer++, n--) {
+			level.res[n] = level.res[n] * level.inv_pivot[n] + level.coupling[n] * level.res[n + 1];
+		}
+	}
+
+	// periphery nodes
+	for (i = std::max(begin, grid_nodes); i < end; i++) {
+		level.res[i] *= level.inv_pivot[i];
+	}
+
+	for (i = begin; i < end; i++) {
+		level.sol[i] = (init ? 0.0 : level.sol[i]) + ThermalSolver::MG_SMOOTHING_WEIGHT * level.res[i];
+	}
+}
+
+/// the same sweeps are applied before and after the coarse-level correction, which
+/// renders the cycle a symmetric operator, as required for preconditioning CG; W-cycles
+/// are applied since the aggregation-based coarse levels provide rather weak
+/// corrections for the lateral heat flow, which are compensated by the second cycle;
+/// for warm-started solves during SA, only few iterations are required anyway, and the
+/// cheaper V-cycles are applied
+void ThermalSolver::cycle(unsigned const& l, bool const& W_cycle) {
+	unsigned sweep;
+
+	if (l == this->levels.size() - 1) {
+		this->solveCoarsest();
+		return;
+	}
+
+	Level& level = this->levels[l];
+	Level& coarse = this->levels[l + 1];
+
+	// pre-smoothing
+	this->workers->run([&](unsigned const& partition) {
+		this->smooth(level, partition, true);
+	}, level.partitions);
+	for (sweep = 1; sweep < ThermalSolver::MG_SMOOTHING_SWEEPS; sweep++) {
+		this->workers->run([&](unsigned const& partition) {
+			this->determineResidual(level, partition);
+		}, level.partitions);
+		this->workers->run([&](unsigned const& partition) {
+			this->smooth(level, partition, false);
+		}, level.partitions);
+	}
+
+	// residual, restricted to coarser level, i.e., summed up for each aggregate
+	this->workers->run([&](unsigned const& partition) {
+		this->determineResidual(level, partition);
+	}, level.partitions);
+	this->workers->run([&](unsigned const& partition) {
+		unsigned I, begin, end;
+		unsigned column, layer, x, y;
+		unsigned const grid_nodes = level.dim * level.dim * this->stack_layers;
+		unsigned const coarse_grid_nodes = coarse.dim * coarse.dim * this->stack_layers;
+
+		this->partitionNodes(coarse, partition, begin, end);
+
+		for (I = begin; I < std::min(end, coarse_grid_nodes); I++) {
+
+			column = I / this->stack_layers;
+			layer = I % this->stack_layers;
+
+			coarse.rhs[I] = 0.0;
+			for (x = 2 * (column / coarse.dim); x < std::min(2 * (column / coarse.dim) + 2, level.dim); x++) {
+				for (y = 2 * (column % coarse.dim); y < std::min(2 * (column % coarse.dim) + 2, level.dim); y++) {
+					coarse.rhs[I] += level.res[(x * level.dim + y) * this->stack_layers + layer];
+				}
+			}
+		}
+		for (I = std::max(begin, coarse_grid_nodes); I < end; I++) {
+			coarse.rhs[I] = level.res[I - coarse_grid_nodes + grid_nodes];
+		}
+	}, coarse.partitions);
+
+	// coarse-level correction; for W-cycles, the coarser level is cycled twice,
+	// where the second cycle addresses the residual of the first one; this is not
+	// required for the coarsest level, which is solved directly
+	this->cycle(l + 1, W_cycle);
+
+	if (W_cycle && l + 2 < this->levels.size()) {
+
+		this->workers->run([&](unsigned const& partition) {
+			unsigned i, begin, end;
+
+			this->determineResidual(coarse, partition);
+
+			this->partitionNodes(coarse, partition, begin, end);
+
+			for (i = begin; i < end; i++) {
+				coarse.prev[i] = coarse.sol[i];
+				coarse.rhs[i] = coarse.res[i];
+			}
+		}, coarse.partitions);
+
+		this->cycle(l + 1, W_cycle);
+
+		this->workers->run([&](unsigned const& partition) {
+			unsigned i, begin, end;
+
+			this->partitionNodes(coarse, partition, begin, end);
+
+			for (i = begin; i < end; i++) {
+				coarse.sol[i] += coarse.prev[i];
+			}
+		}, coarse.partitions);
+	}
+
+	// prolongation of correction
+	this->workers->run([&](unsigned const& partition) {
+		unsigned i, begin, end;
+
+		this->partitionNodes(level, partition, begin, end);
+
+		for (i = begin; i < end; i++) {
+			level.sol[i] += coarse.sol[level.aggregate[i]];
+		}
+	}, level.partitions);
+
+	// post-smoothing
+	for (sweep = 0; sweep < ThermalSolver::MG_SMOOTHING_SWEEPS; sweep++) {
+		this->workers->run([&](unsigned const& partition) {
+			this->determineResidual(level, partition);
+		}, level.partitions);
+		this->workers->run([&](unsigned const& partition) {
+			this->smooth(level, partition, false);
+		}, level.partitions);
+	}
+}
+
+void ThermalSolver::solveCoarsest() {
+	unsigned r, k;
+	double sum;
+	Level& level = this->levels.back();
+	unsigned const n = level.nodes;
+
+	// forward substitution
+	for (r = 0; r < n; r++) {
+
+		sum = level.rhs[r];
+		for (k = 0; k < r; k++) {
+			sum -= this->coarsest_factor[r * n + k] * level.sol[k];
+		}
+		level.sol[r] = sum / this->coarsest_factor[r * n + r];
+	}
+
+	// backward substitution, w/ transposed factor
+	for (r = n; r-- > 0;) {
+
+		sum = level.sol[r];
+		for (k = r + 1; k < n; k++) {
+			sum -= this->coarsest_factor[k * n + r] * level.sol[k];
+		}
+		level.sol[r] = sum / this->coarsest_factor[r * n + r];
+	}
+}
+
+void ThermalSolver::solve(Result& ret, std::vector<Block> const& blocks, std::vector<Block> const& wires,
+		std::vector< Map2D<double> > const& TSV_density_maps, unsigned const& TSV_density_maps_offset,
+		double const& tolerance, bool const& warm_start) {
+	unsigned iteration;
+	unsigned p;
+	unsigned x, y;
+	int die;
+	bool warm;
+	double alpha, beta;
+	double rz, rz_prev, pq, rr, bb;
+	std::array<double, ThermalSolver::PARTITIONS> partial_1, partial_2;
+	Level& level = this->levels[0];
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "-> ThermalSolver::solve(" << &ret << ", " << &blocks << ", " << &wires << ", " << &TSV_density_maps << ", " << TSV_density_maps_offset;
+		std::cout << ", " << tolerance << ", " << warm_start << ")" << std::endl;
+	}
+
+	this->assembleSystem(blocks, wires, TSV_density_maps, TSV_density_maps_offset);
+
+	// workers are kept for subsequent calls
+	if (!this->workers) {
+		this->workers.reset(new Workers(this->parameters.threads));
+	}
+
+	/// conjugate gradients, preconditioned by one multigrid W-cycle, or V-cycle for
+	/// (to be) warm-started solves during SA; all vector operations are performed per partition, where
+	/// the dot products are reduced over the partitions in fixed order
+
+	// init; solution starts from solution of last accepted layout, if available and
+	// requested, or w/o any temperature rise
+	warm = warm_start && this->temps_accepted.size() == this->nodes;
+	if (warm) {
+		this->temps = this->temps_accepted;
+	}
+	else {
+		std::fill(this->temps.begin(), this->temps.end(), 0.0);
+	}
+
+	this->workers->run([&](unsigned const& partition) {
+		unsigned i, begin, end;
+
+		this->partitionNodes(level, partition, begin, end);
+
+		if (warm) {
+			this->multiply(level, partition, this->temps, this->product);
+		}
+
+		partial_1[partition] = partial_2[partition] = 0.0;
+		for (i = begin; i < end; i++) {
+			this->residual[i] = level.rhs[i] = this->power[i] - (warm ? this->product[i] : 0.0);
+			partial_1[partition] += this->residual[i] * this->residual[i];
+			partial_2[partition] += this->power[i] * this->power[i];
+		}
+	}, level.partitions);
+	rr = bb = 0.0;
+	for (p = 0; p < ThermalSolver::PARTITIONS; p++) {
+		rr += partial_1[p];
+		bb += partial_2[p];
+	}
+
+	ret.iterations = 0;
+	ret.residual = 0.0;
+	ret.converged = true;
+
+	// no power at all; solution is trivial
+	if (bb == 0.0) {
+		std::fill(this->temps.begin(), this->temps.end(), 0.0);
+	}
+	else {
+		ret.residual = std::sqrt(rr / bb);
+		ret.converged = (ret.residual <= tolerance);
+	}
+
+	if (!ret.converged) {
+
+		this->cycle(0, !warm_start);
+
+		this->workers->run([&](unsigned const& partition) {
+			unsigned i, begin, end;
+
+			this->partitionNodes(level, partition, begin, end);
+
+			partial_1[partition] = 0.0;
+			for (i = begin; i < end; i++) {
+				this->direction[i] = level.sol[i];
+				partial_1[partition] += this->residual[i] * level.sol[i];
+			}
+		}, level.partitions);
+		rz = 0.0;
+		for (p = 0; p < ThermalSolver::PARTITIONS; p++) {
+			rz += partial_1[p];
+		}
+
+		for (iteration = 1; iteration <= ThermalSolver::MAX_ITERATIONS; iteration++) {
+
+			// product of system and search direction
+			this->workers->run([&](unsigned const& partition) {
+				unsigned i, begin, end;
+
+				this->multiply(level, partition, this->direction, this->product);
+
+				this->partitionNodes(level, partition, begin, end);
+
+				partial_1[partition] = 0.0;
+				for (i = begin; i < end; i++) {
+					partial_1[partition] += this->direction[i] * this->product[i];
+				}
+			}, level.partitions);
+			pq = 0.0;
+			for (p = 0; p < ThermalSolver::PARTITIONS; p++) {
+				pq += partial_1[p];
+			}
+
+			alpha = rz / pq;
+
+			// update solution and residual
+			this->workers->run([&](unsigned const& partition) {
+				unsigned i, begin, end;
+
+				this->partitionNodes(level, partition, begin, end);
+
+				partial_1[partition] = 0.0;
+				for (i = begin; i < end; i++) {
+					this->temps[i] += alpha * this->direction[i];
+					this->residual[i] = level.rhs[i] = this->residual[i] - alpha * this->product[i];
+					partial_1[partition] += this->residual[i] * this->residual[i];
+				}
+			}, level.partitions);
+			rr = 0.0;
+			for (p = 0; p < ThermalSolver::PARTITIONS; p++) {
+				rr += partial_1[p];
+			}
+
+			ret.iterations = iteration;
+			ret.residual = std::sqrt(rr / bb);
+
+			if (ThermalSolver::DBG) {
+				std::cout << "DBG_THERMAL_SOLVER> Iteration " << iteration << "; relative residual: " << ret.residual << std::endl;
+			}
+
+			if (ret.residual <= tolerance) {
+				ret.converged = true;
+				break;
+			}
+
+			// precondition residual
+			this->cycle(0, !warm_start);
+
+			this->workers->run([&](unsigned const& partition) {
+				unsigned i, begin, end;
+
+				this->partitionNodes(level, partition, begin, end);
+
+				partial_1[partition] = 0.0;
+				for (i = begin; i < end; i++) {
+					partial_1[partition] += this->residual[i] * level.sol[i];
+				}
+			}, level.partitions);
+			rz_prev = rz;
+			rz = 0.0;
+			for (p = 0; p < ThermalSolver::PARTITIONS; p++) {
+				rz += partial_1[p];
+			}
+
+			beta = rz / rz_prev;
+
+			// update search direction
+			this->workers->run([&](unsigned const& partition) {
+				unsigned i, begin, end;
+
+				this->partitionNodes(level, partition, begin, end);
+
+				for (i = begin; i < end; i++) {
+					this->direction[i] = level.sol[i] + beta * this->direction[i];
+				}
+			}, level.partitions);
+		}
+	}
+
+	/// thermal maps for active Si layers; max and avg temperature for lowest layer
+	for (die = 0; die < this->dies; die++) {
+		for (x = 0; x < this->dim; x++) {
+			for (y = 0; y < this->dim; y++) {
+				this->thermal_maps[die][x][y] = ThermalSolver::AMBIENT_TEMP + this->temps[this->node(x, y, 4 * die + 1)];
+			}
+		}
+	}
+	ret.max_temp = ThermalSolver::AMBIENT_TEMP;
+	ret.avg_temp = 0.0;
+	for (double const& temp : this->thermal_maps[0]) {
+		ret.max_temp = std::max(ret.max_temp, temp);
+		ret.avg_temp += temp;
+	}
+	ret.avg_temp /= this->dim * this->dim;
+
+	if (ThermalSolver::DBG_CALLS) {
+		std::cout << "<- ThermalSolver::solve" << std::endl;
+	}
+}
+
+ThermalSolver::Workers::Workers(unsigned const& threads) {
+	unsigned t;
+
+	this->generation = this->pending = 0;
+	this->finished = false;
+	this->task = nullptr;
+	this->partitions = 0;
+
+	// the calling thread is a worker as well
+	this->count = std::max(1u, std::min(threads, ThermalSolver::PARTITIONS));
+	for (t = 1; t < this->count; t++) {
+		this->threads.emplace_back(&ThermalSolver::Workers::work, this, t);
+	}
+}
+
+ThermalSolver::Workers::~Workers() {
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->finished = true;
+	}
+	this->phase_start.notify_all();
+
+	for (std::thread& t : this->threads) {
+		t.join();
+	}
+}
+
+void ThermalSolver::Workers::work(unsigned const& thread) {
+	unsigned p;
+	unsigned generation = 0;
+
+	while (true) {
+
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->phase_start.wait(lock, [&]() {
+				return (this->generation != generation || this->finished);
+			});
+
+			if (this->finished) {
+				return;
+			}
+
+			generation = this->generation;
+		}
+
+		for (p = thread; p < this->partitions; p += this->count) {
+			(*this->task)(p);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->pending--;
+		}
+		this->phase_done.notify_one();
+	}
+}
+
+void ThermalSolver::Workers::run(std::function<void(unsigned const&)> const& task, unsigned const& partitions) {
+	unsigned p;
+
+	if (this->count > 1) {
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->task = &task;
+			this->partitions = partitions;
+			this->pending = this->count - 1;
+			this->generation++;
+		}
+		this->phase_start.notify_all();
+	}
+
+	for (p = 0; p < partitions; p += this->count) {
+		task(p);
+	}
+
+	if (this->count > 1) {
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->phase_done.wait(lock, [&]() {
+			return (this->pending == 0);
+		});
+	}
+}
@@ -0,0 +1,358 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar 3D thermal solver, based on steady-state finite-volume
+ *    analysis of the 3D-IC stack and package
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_THERMALSOLVER
+#define _CORBLIVAR_THERMALSOLVER
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Block.hpp"
+#include "Map2D.hpp"
+// forward declarations, if any
+class Point;
+
+/// Corblivar 3D thermal solver; the stack is modelled like for HotSpot, see
+/// IO::writeHotSpotFiles, i.e., BEOL, active Si, passive Si and bonding layer for each
+/// die, followed by heat spreader and heatsink; each layer is discretized into the
+/// bins of the thermal map, and the resulting sparse system of thermal conductances
+/// is solved w/ conjugate gradients, preconditioned by multigrid W-cycles, or by
+/// V-cycles for warm-started solves during SA
+class ThermalSolver {
+	private:
+		/// debugging code switch (private)
+		static constexpr bool DBG_CALLS = false;
+		/// debugging code switch (private)
+		static constexpr bool DBG = false;
+
+	// public data
+	public:
+		struct Parameters {
+			/// perform 3D thermal analysis for final solution
+			bool enabled;
+			/// threads for the solver, i.e., for parallel sparse
+			/// matrix-vector products and vector operations
+			unsigned threads;
+			/// derive thermal cost from 3D thermal analysis, instead of power
+			/// blurring, during late SA phases; the 3D thermal analysis is
+			/// only performed for accepted layouts, other candidates are
+			/// estimated by power blurring, scaled accordingly
+			bool SA;
+			/// SA progress, i.e., ratio of SA iterations, from which on 3D
+			/// thermal analysis is applied for thermal cost
+			double SA_progress;
+			/// convergence criterion for SA evaluations, i.e., residual norm
+			/// relative to the norm of the power vector
+			double SA_tolerance;
+		} parameters;
+
+		/// solver parameters: convergence criterion, i.e., residual norm
+		/// relative to the norm of the power vector
+		static constexpr double TOLERANCE = 1.0e-9;
+		/// solver parameters: upper limit for iterations
+		static constexpr unsigned MAX_ITERATIONS = 10000;
+		/// solver parameters: count of partitions of the system, i.e., of
+		/// consecutive bin columns; the partitions are distributed over the
+		/// threads, whereas partial results are reduced in the order of the
+		/// partitions, such that results are independent of the thread count
+		static constexpr unsigned PARTITIONS = 64;
+		/// solver parameters: min count of bin columns per partition for the
+		/// coarser multigrid levels, which require no reductions, such that
+		/// small levels are handled w/o parallelization overhead
+		static constexpr unsigned PARTITION_COLUMNS_MIN = 64;
+
+		/// multigrid parameters: bins along x and y for coarsest level, which is
+		/// solved directly
+		static constexpr unsigned MG_COARSEST_DIM = 2;
+		/// multigrid parameters: smoothing sweeps before and after each coarse-level
+		/// correction
+		static constexpr unsigned MG_SMOOTHING_SWEEPS = 1;
+		/// multigrid parameters: damping of smoothing sweeps
+		static constexpr double MG_SMOOTHING_WEIGHT = 0.85;
+
+		/// package parameters, as for HotSpot, see exp/hotspot_heatsink.config;
+		/// ambient temperature [K]
+		static constexpr double AMBIENT_TEMP = 293.0;
+		/// package parameters; convection resistance of heatsink [K/W]
+		static constexpr double CONVECTION_RESISTANCE = 0.1;
+		/// package parameters; convection resistance of secondary heat path,
+		/// i.e., via C4 bumps, package substrate and PCB, which is lumped into
+		/// this resistance [K/W]
+		static constexpr double CONVECTION_RESISTANCE_SECONDARY = 50.0;
+		/// package parameters; heat spreader side [m]
+		static constexpr double SPREADER_SIDE = 0.03;
+		/// package parameters; heat spreader thickness [m]
+		static constexpr double SPREADER_THICKNESS = 0.001;
+		/// package parameters; heat spreader thermal conductivity [W/(m*K)]
+		static constexpr double SPREADER_CONDUCTIVITY = 400.0;
+		/// package parameters; heatsink side [m]
+		static constexpr double SINK_SIDE = 0.06;
+		/// package parameters; heatsink thickness [m]
+		static constexpr double SINK_THICKNESS = 0.0069;
+		/// package parameters; heatsink thermal conductivity [W/(m*K)]
+		static constexpr double SINK_CONDUCTIVITY = 400.0;
+
+	// PODs, to be declared early on
+	public:
+		/// technology parameters of the stack; thicknesses are given in [um]
+		struct Stack {
+			double BEOL_thickness;
+			double Si_active_thickness;
+			double Si_passive_thickness;
+			double bond_thickness;
+			/// Cu area fraction for TSV groups
+			double TSV_group_Cu_area_ratio;
+
+			inline bool operator== (Stack const& other) const {
+				return this->BEOL_thickness == other.BEOL_thickness &&
+					this->Si_active_thickness == other.Si_active_thickness &&
+					this->Si_passive_thickness == other.Si_passive_thickness &&
+					this->bond_thickness == other.bond_thickness &&
+					this->TSV_group_Cu_area_ratio == other.TSV_group_Cu_area_ratio;
+			};
+		};
+		struct Result {
+			/// max temperature of lowest layer [K]
+			double max_temp;
+			/// avg temperature of lowest layer [K]
+			double avg_temp;
+			/// PCG iterations
+			unsigned iterations;
+			/// final residual norm, relative to norm of power vector
+			double residual;
+			bool converged;
+		};
+
+	// private data, functions
+	private:
+		/// dimensions; dies, bins along x and y, layers of stack (including
+		/// spreader and heatsink), and nodes of system
+		int dies;
+		unsigned dim;
+		unsigned stack_layers;
+		unsigned nodes;
+		/// nodes for the package periphery, i.e., the parts of spreader and
+		/// heatsink beyond the die outline; for each side (W, E, S, N), there
+		/// is one node for the spreader, one for the heatsink below the
+		/// spreader, and one for the outer heatsink
+		static constexpr unsigned PERIPHERY_NODES = 12;
+		/// stack parameters
+		Stack stack;
+		/// die outline and bins' dimensions [um]
+		double outline_x, outline_y;
+		double bin_w, bin_h;
+
+		/// node index for bin (x,y) of given stack layer; the nodes of each bin
+		/// column are consecutive, such that the vertical coupling of each column
+		/// forms a tridiagonal block
+		inline unsigned node(unsigned const& x, unsigned const& y, unsigned const& layer) const {
+			return (x * this->dim + y) * this->stack_layers + layer;
+		};
+		/// node index for periphery nodes; side is 0 to 3 for W, E, S, N, and
+		/// part is 0 for spreader, 1 for heatsink below spreader, 2 for outer
+		/// heatsink
+		inline unsigned peripheryNode(unsigned const& side, unsigned const& part) const {
+			return this->dim * this->dim * this->stack_layers + 3 * side + part;
+		};
+
+		/// system of conductances; thermal conductances b/w nodes, assembled
+		/// as list of edges
+		struct Edge {
+			unsigned i, j;
+			double conductance;
+		};
+		std::vector<Edge> edges;
+		/// system of conductances; TSV densities for which the conductances
+		/// have been assembled, i.e., the conductances are only re-assembled
+		/// for changed TSV densities or changed geometry
+		std::vector<double> TSV_densities;
+		bool system_valid;
+
+		/// multigrid levels; level 0 is the actual grid, each coarser level
+		/// aggregates 2x2 bins of the next finer level, whereas the layers of
+		/// the stack and the periphery nodes are retained; the systems of the
+		/// coarser levels are derived by Galerkin projection
+		struct Level {
+			/// bins along x and y, nodes, and partitions
+			unsigned dim;
+			unsigned nodes;
+			unsigned partitions;
+			/// system of conductances; diagonal, i.e., sum of all conductances
+			/// of each node, including those to ambient
+			std::vector<double> diag;
+			/// system of conductances; vertical conductance of each node to
+			/// next upper node in the same bin column, zero for uppermost node
+			std::vector<double> vertical;
+			/// system of conductances; off-diagonal conductances in CSR format
+			std::vector<unsigned> row_ptr, col_idx;
+			std::vector<double> values;
+			/// line smoother: factorization of the tridiagonal block of each
+			/// bin column, i.e., inverted pivots and normalized couplings to
+			/// next upper node
+			std::vector<double> inv_pivot, coupling;
+			/// node of next coarser level for each node of this level
+			std::vector<unsigned> aggregate;
+			/// multigrid-cycle vectors: right-hand side, solution, residual,
+			/// and solution of first cycle, for W-cycles
+			std::vector<double> rhs, sol, res, prev;
+		};
+		std::vector<Level> levels;
+		/// multigrid, coarsest level: dense Cholesky factor, row-wise lower
+		/// triangle
+		std::vector<double> coarsest_factor;
+
+		/// power vector, i.e., power dissipated in each node [W]
+		std::vector<double> power;
+		/// solution, i.e., temperature rise over ambient of each node [K]
+		std::vector<double> temps;
+		/// solution of last accepted layout, serves as warm start for SA
+		/// evaluations; empty if not available for current system
+		std::vector<double> temps_accepted;
+		/// PCG vectors
+		std::vector<double> residual, direction, product;
+
+		/// thermal maps, i.e., temperatures for active Si layer of each die
+		std::vector< Map2D<double> > thermal_maps;
+
+		/// helper for assembly; adds an edge w/ given conductance
+		inline void addEdge(unsigned const& i, unsigned const& j, double const& conductance) {
+			this->edges.push_back({i, j, conductance});
+			this->levels[0].diag[i] += conductance;
+			this->levels[0].diag[j] += conductance;
+		};
+		/// helper for assembly; adds power of given rectangle [um], uniformly
+		/// distributed, to the bins of given stack layer
+		void addPower(Rect const& bb, double const& power, unsigned const& layer);
+		/// helper for assembly; thermal conductivity of a node [W/(m*K)]
+		double conductivity(unsigned const& layer, unsigned const& x, unsigned const& y) const;
+		/// helper for assembly; thickness of stack layer [m]
+		double thickness(unsigned const& layer) const;
+		/// assembly of power vector and, if required, of system of conductances
+		void assembleSystem(std::vector<Block> const& blocks, std::vector<Block> const& wires,
+				std::vector< Map2D<double> > const& TSV_density_maps, unsigned const& TSV_density_maps_offset);
+		/// assembly of system of conductances for level 0
+		void assembleConductances();
+		/// derivation of coarser levels' systems and of their factorizations
+		void assembleLevels();
+
+		/// solver helpers, all operating on the nodes of one partition of given
+		/// level
+		void multiply(Level const& level, unsigned const& partition, std::vector<double> const& in, std::vector<double>& out) const;
+		void determineResidual(Level& level, unsigned const& partition) const;
+		void smooth(Level& level, unsigned const& partition, bool const& init) const;
+		/// multigrid W-cycle or V-cycle for given level, i.e., approximate
+		/// solve for the level's right-hand side
+		void cycle(unsigned const& l, bool const& W_cycle);
+		/// multigrid, coarsest level: direct solve
+		void solveCoarsest();
+		/// solver helpers; range of nodes of partition for given level
+		inline void partitionNodes(Level const& level, unsigned const& partition, unsigned& begin, unsigned& end) const {
+			unsigned const columns = level.dim * level.dim;
+
+			begin = (partition * columns / level.partitions) * this->stack_layers;
+			end = ((partition + 1) * columns / level.partitions) * this->stack_layers;
+
+			// periphery nodes are handled along w/ last partition
+			if (partition == level.partitions - 1) {
+				end = level.nodes;
+			}
+		};
+
+	// public helper class; also used by FloorPlanner for concurrent evaluation of
+	// interconnects
+	public:
+		/// solver helpers; workers for the parallel phases of the solver, i.e.,
+		/// for tasks to be run for all partitions; the threads are kept for the
+		/// solver's lifetime, and each phase is triggered by a new generation
+		class Workers {
+			private:
+				std::vector<std::thread> threads;
+				/// count of threads, including the calling thread
+				unsigned count;
+				std::mutex mutex;
+				std::condition_variable phase_start, phase_done;
+				unsigned generation, pending;
+				bool finished;
+				std::function<void(unsigned const&)> const* task;
+				unsigned partitions;
+
+				/// loop of worker thread; handles every n-th partition
+				void work(unsigned const& thread);
+
+			public:
+				Workers(unsigned const& threads);
+				~Workers();
+
+				/// runs the task for all partitions; the calling thread
+				/// handles its share of partitions as well
+				void run(std::function<void(unsigned const&)> const& task, unsigned const& partitions);
+		};
+
+	// private data
+	private:
+		std::unique_ptr<Workers> workers;
+
+	// constructors, destructors, if any non-implicit
+	public:
+		/// default constructor
+		ThermalSolver() {
+			this->parameters.enabled = false;
+			this->parameters.threads = 1;
+			this->parameters.SA = false;
+			this->parameters.SA_progress = 1.0;
+			this->parameters.SA_tolerance = ThermalSolver::TOLERANCE;
+			this->dies = 0;
+			this->dim = this->stack_layers = this->nodes = 0;
+			this->outline_x = this->outline_y = 0.0;
+			this->system_valid = false;
+		};
+
+	// public data, functions
+	public:
+		friend class IO;
+
+		/// init of geometry, stack and system's structure; only effective for
+		/// changed parameters, in which case any warm start is dropped as well
+		void initSolver(int const& layers, unsigned const& dim, Point const& die_outline, Stack const& stack);
+		/// steady-state analysis; the TSV densities are given in percent, as
+		/// for the ThermalAnalyzer, where the maps may be padded w/ the given
+		/// offset; for warm_start, the solver starts from the solution of the
+		/// last accepted layout, if available, and applies V-cycles instead of
+		/// W-cycles
+		void solve(Result& ret, std::vector<Block> const& blocks, std::vector<Block> const& wires,
+				std::vector< Map2D<double> > const& TSV_density_maps, unsigned const& TSV_density_maps_offset,
+				double const& tolerance = ThermalSolver::TOLERANCE, bool const& warm_start = false);
+
+		/// warm start: memorizes the solution of the last solve call as solution
+		/// of the accepted layout
+		inline void acceptSolution() {
+			this->temps_accepted = this->temps;
+		};
+
+		/// getter
+		inline std::vector< Map2D<double> > const& getThermalMaps() const {
+			return this->thermal_maps;
+		};
+};
+
+#endif
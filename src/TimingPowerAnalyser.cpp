@@ -308,6 +308,10 @@ void TimingPowerAnalyser::initSLSTA(std::vector<Block> const& blocks, std::vecto
 			}
 		 );
 
+	// derive the integer-indexed CSR layout from the sorted DAG, for incremental STA
+	//
+	this->initCSR(voltages_count);
+
 	if (TimingPowerAnalyser::DBG) {
 
 		std::cout << "DBG_TimingPowerAnalyser> Parsed DAG for nets:" << std::endl;
@@ -499,205 +503,527 @@ void TimingPowerAnalyser::determIndicesDAG(DAG_Node *cur_node) {
 	}
 }
 
-void TimingPowerAnalyser::updateTiming(bool const& voltage_assignment, double const& global_arrival_time, int const& voltage_index) {
-	DAG_Node* child;
-	DAG_Node* parent;
-	Rect bb_driver_sink;
 
-	DAG_Node &global_sink = this->nets_DAG.at(TimingPowerAnalyser::DAG_Node::SINK_ID);
-	DAG_Node &global_source = this->nets_DAG.at(TimingPowerAnalyser::DAG_Node::SOURCE_ID);
+void TimingPowerAnalyser::initCSR(unsigned const& voltages_count) {
+	int const nodes_count = this->nets_DAG_sorted.size();
+	std::unordered_map<DAG_Node const*, int> positions;
 
-	if (TimingPowerAnalyser::DBG_VERBOSE) {
-		if (voltage_index == -1) {
-			std::cout << "DBG_TimingPowerAnalyser> Determine timing values for DAG, considering all the block's currently assigned voltages" << std::endl;
+	this->DAG_CSR = TimingPowerAnalyser::CSR();
+
+	// positions of nodes in sorted DAG; also memorize the (non-const) nodes themselves
+	//
+	for (int i = 0; i < nodes_count; i++) {
+		DAG_Node const* node = this->nets_DAG_sorted[i];
+
+		positions.emplace(node, i);
+		this->DAG_CSR.nodes.push_back(&this->nets_DAG.at(node->block->id));
+		this->DAG_CSR.bbs.push_back(node->block->bb);
+		this->DAG_CSR.layers.push_back(node->block->layer);
+	}
+	this->DAG_CSR.sink = positions.at(&this->nets_DAG.at(TimingPowerAnalyser::DAG_Node::SINK_ID));
+	this->DAG_CSR.source = positions.at(&this->nets_DAG.at(TimingPowerAnalyser::DAG_Node::SOURCE_ID));
+
+	// the AAT propagation in updateTiming has been defined to ignore the very first and the very last node in the sorted DAG; the same holds for the RAT propagation
+	//
+	auto propagating = [&](int const& node) {
+		return (node >= 1) && (node <= nodes_count - 2);
+	};
+
+	// edges are derived from the parents of all nodes; these also cover the relations removed from children during cycle resolution, which are still considered
+	// for the RAT propagation; edges which remain within the children are considered for the AAT propagation
+	//
+	std::vector<bool> AAT_edge;
+	std::vector<bool> RAT_edge;
+
+	for (int sink = 0; sink < nodes_count; sink++) {
+		DAG_Node const* node = this->nets_DAG_sorted[sink];
+
+		for (auto const& pair : node->parents) {
+			int driver = positions.at(pair.second);
+			auto child = pair.second->children.find(node->block->id);
+
+			this->DAG_CSR.edge_driver.push_back(driver);
+			this->DAG_CSR.edge_sink.push_back(sink);
+
+			AAT_edge.push_back(propagating(driver) && child != pair.second->children.end() && child->second == node);
+			RAT_edge.push_back(propagating(sink));
 		}
-		else {
-			std::cout << "DBG_TimingPowerAnalyser> Determine timing values for DAG, considering the voltage index " << voltage_index << " for all blocks" << std::endl;
+	}
+
+	// helper to build the CSR adjacency for all selected edges, considering the given edge end (driver or sink) as key
+	//
+	auto build = [&](Adjacency& adj, std::vector<int> const& keys, std::vector<bool> const* selected) {
+
+		adj.offsets.assign(nodes_count + 1, 0);
+		adj.edges.clear();
+
+		for (unsigned e = 0; e < keys.size(); e++) {
+			if (selected == nullptr || (*selected)[e]) {
+				adj.offsets[keys[e] + 1]++;
+			}
 		}
-		if (!voltage_assignment) {
-			std::cout << "DBG_TimingPowerAnalyser>  No voltage assignment is applied, so we determine only the actual arrival time / system-level latency here..." << std::endl;
+		for (int i = 0; i < nodes_count; i++) {
+			adj.offsets[i + 1] += adj.offsets[i];
 		}
+
+		adj.edges.resize(adj.offsets.back());
+		std::vector<int> fill(adj.offsets.begin(), adj.offsets.end() - 1);
+
+		for (unsigned e = 0; e < keys.size(); e++) {
+			if (selected == nullptr || (*selected)[e]) {
+				adj.edges[fill[keys[e]]++] = e;
+			}
+		}
+	};
+	build(this->DAG_CSR.AAT_fanin, this->DAG_CSR.edge_sink, &AAT_edge);
+	build(this->DAG_CSR.AAT_fanout, this->DAG_CSR.edge_driver, &AAT_edge);
+	build(this->DAG_CSR.RAT_fanout, this->DAG_CSR.edge_driver, &RAT_edge);
+	build(this->DAG_CSR.RAT_fanin, this->DAG_CSR.edge_sink, &RAT_edge);
+
+	// all edges touching a node; edges are considered both for their driver and their sink
+	//
+	std::vector<int> both_ends(this->DAG_CSR.edge_driver);
+	both_ends.insert(both_ends.end(), this->DAG_CSR.edge_sink.begin(), this->DAG_CSR.edge_sink.end());
+	build(this->DAG_CSR.incident, both_ends, nullptr);
+	for (int& e : this->DAG_CSR.incident.edges) {
+		e %= this->DAG_CSR.edge_driver.size();
 	}
 
-	// reset AAT, RAT
+	// special nodes
 	//
-	for (auto &pair : this->nets_DAG) {
-		pair.second.setAAT(voltage_index, 0);
-		pair.second.setRAT(voltage_index, global_arrival_time);
+	for (auto const& pair : this->DAG_CSR.nodes[this->DAG_CSR.sink]->parents) {
+		this->DAG_CSR.sink_parents.push_back(positions.at(pair.second));
+	}
+	for (auto const& pair : this->DAG_CSR.nodes[this->DAG_CSR.source]->children) {
+		this->DAG_CSR.source_children.push_back(positions.at(pair.second));
 	}
 
-	// first and in any case, compute all arrival times over sorted DAG
+	// initial interconnect delays
 	//
-	// ignore the very first node, i.e., the global source; there is no physical delay between the global source and the input pins, which are following right after in
-	// nets_DAG_sorted
+	this->DAG_CSR.edge_delays.assign(this->DAG_CSR.edge_driver.size(), 0.0);
+	for (unsigned e = 0; e < this->DAG_CSR.edge_driver.size(); e++) {
+		int driver = this->DAG_CSR.edge_driver[e];
+		int sink = this->DAG_CSR.edge_sink[e];
+		Rect bb_driver_sink = Rect::determBoundingBox(this->DAG_CSR.bbs[driver], this->DAG_CSR.bbs[sink], true);
+
+		this->DAG_CSR.edge_delays[e] = TimingPowerAnalyser::elmoreDelay(bb_driver_sink.w + bb_driver_sink.h, std::abs(this->DAG_CSR.layers[driver] - this->DAG_CSR.layers[sink]));
+	}
+
+	// reset timing state for all voltage indices, including the one for all assigned voltages
 	//
-	// also ignore here the very last node, i.e., the global sink; this node is handled as special case below
+	this->timing_lanes = TimingPowerAnalyser::TimingLanes();
+	this->timing_lanes.count = voltages_count + 1;
+	this->timing_lanes.AAT_epoch.assign(this->timing_lanes.count, 0);
+	this->timing_lanes.RAT_epoch.assign(this->timing_lanes.count, 0);
+	this->timing_lanes.global_arrival_time.assign(this->timing_lanes.count, 0.0);
+	this->timing_lanes.delays.assign(nodes_count * this->timing_lanes.count, 0.0);
+	this->timing_lanes.AAT_propagated.assign(nodes_count * this->timing_lanes.count, 0.0);
+	this->timing_lanes.RAT_propagated.assign(nodes_count * this->timing_lanes.count, 0.0);
+	this->lanes_propagated.assign(this->timing_lanes.count, 0.0);
+	this->lanes_final.assign(this->timing_lanes.count, 0.0);
+
+	this->timing_epoch = 1;
+	this->AAT_changed.assign(nodes_count, 0);
+	this->RAT_changed.assign(nodes_count, 0);
+	this->timing_dirty.assign(nodes_count, false);
+	this->delay_changed.assign(nodes_count, false);
+	this->timing_late.clear();
+
+	if (TimingPowerAnalyser::DBG) {
+		std::cout << "DBG_TimingPowerAnalyser> CSR layout of DAG: " << nodes_count << " nodes, " << this->DAG_CSR.edge_driver.size() << " edges; ";
+		std::cout << this->DAG_CSR.AAT_fanin.edges.size() << " edges for AAT propagation, " << this->DAG_CSR.RAT_fanin.edges.size() << " edges for RAT propagation" << std::endl;
+	}
+}
+
+void TimingPowerAnalyser::updateInterconnectDelays() {
+	std::vector<int>& moved = this->timing_late;
+
+	// determine the nodes/blocks which have moved or changed their layer since the previous update
 	//
-	for (auto iter = (this->nets_DAG_sorted.begin() + 1); iter != (this->nets_DAG_sorted.end() - 1); ++iter) {
+	for (unsigned i = 0; i < this->DAG_CSR.nodes.size(); i++) {
+		Block const* block = this->DAG_CSR.nodes[i]->block;
+		Rect& bb = this->DAG_CSR.bbs[i];
 
-		DAG_Node const* node = *iter;
+		if (bb.ll.x != block->bb.ll.x || bb.ll.y != block->bb.ll.y || bb.w != block->bb.w || bb.h != block->bb.h || this->DAG_CSR.layers[i] != block->layer) {
 
-		if (TimingPowerAnalyser::DBG_VERBOSE) {
+			bb = block->bb;
+			this->DAG_CSR.layers[i] = block->layer;
 
-			std::cout << "DBG_TimingPowerAnalyser>  Determine AAT for all " << node->children.size() << " children of node: " << node->block->id << std::endl;
-			std::cout << "DBG_TimingPowerAnalyser>  (AAT of this node: " << node->getAAT(voltage_index) << ")" << std::endl;
+			moved.push_back(i);
 		}
+	}
 
-		// propagate AAT from this node to all children
-		//
-		// note that the global sink is still considered here every now and then, namely when we have an output pin as node; however, always checking whether the child is
-		// the global sink is more costly than just recalculating the proper AAT for the global sink as we do below
+	if (moved.empty()) {
+		return;
+	}
+
+	// update the interconnect delays for all edges of those nodes; timing values for the related drivers and sinks are then to be re-evaluated, for all voltage
+	// indices, which is tracked by the epoch of this change
+	//
+	this->timing_epoch++;
+
+	for (int node : moved) {
+
+		for (int k = this->DAG_CSR.incident.offsets[node]; k < this->DAG_CSR.incident.offsets[node + 1]; k++) {
+			int e = this->DAG_CSR.incident.edges[k];
+			int driver = this->DAG_CSR.edge_driver[e];
+			int sink = this->DAG_CSR.edge_sink[e];
+
+			Rect bb_driver_sink = Rect::determBoundingBox(this->DAG_CSR.bbs[driver], this->DAG_CSR.bbs[sink], true);
+			double delay = TimingPowerAnalyser::elmoreDelay(bb_driver_sink.w + bb_driver_sink.h, std::abs(this->DAG_CSR.layers[driver] - this->DAG_CSR.layers[sink]));
+
+			if (delay != this->DAG_CSR.edge_delays[e]) {
+
+				this->DAG_CSR.edge_delays[e] = delay;
+
+				this->AAT_changed[sink] = this->timing_epoch;
+				this->RAT_changed[driver] = this->timing_epoch;
+			}
+		}
+	}
+
+	moved.clear();
+}
+
+void TimingPowerAnalyser::propagateAAT(unsigned const& first_lane, unsigned const& last_lane) {
+	TimingLanes& lanes = this->timing_lanes;
+	unsigned const count = lanes.count;
+	bool full = false;
+	unsigned long epoch = this->timing_epoch;
+
+	// the lanes are evaluated together; thus, they are fully re-determined if any of them is not determined yet, and changes are considered since the oldest update
+	// among them
+	//
+	for (unsigned l = first_lane; l < last_lane; l++) {
+		full = full || (lanes.AAT_epoch[l] == 0);
+		epoch = std::min(epoch, lanes.AAT_epoch[l]);
+	}
+
+	double* AAT_propagated = this->lanes_propagated.data();
+	double* AAT = this->lanes_final.data();
+
+	// helper to determine the AAT of a node, for all lanes; the AAT is to be calculated considering the drivers' AAT, the interconnect delay, and the delay of the
+	// node itself; edges from drivers which are ordered after the node (only possible for edges removed during cycle resolution, but still found in the parents)
+	// cannot impact the AAT propagated further on, but still impact the node's own AAT; returns whether the AAT to be propagated has changed for any lane
+	//
+	auto evaluate = [&](int const& node) {
+		double const* delays = &lanes.delays[node * count];
+		bool changed = false;
+
+		for (unsigned l = first_lane; l < last_lane; l++) {
+			AAT_propagated[l] = AAT[l] = 0.0;
+		}
+
+		for (int k = this->DAG_CSR.AAT_fanin.offsets[node]; k < this->DAG_CSR.AAT_fanin.offsets[node + 1]; k++) {
+			int e = this->DAG_CSR.AAT_fanin.edges[k];
+			int driver = this->DAG_CSR.edge_driver[e];
+			double const edge_delay = this->DAG_CSR.edge_delays[e];
+			double const* AAT_driver = &lanes.AAT_propagated[driver * count];
+
+			// branch only once for all lanes, to keep the lanes' loop vectorizable
+			double* AAT_edge = (driver < node) ? AAT_propagated : AAT;
+
+			for (unsigned l = first_lane; l < last_lane; l++) {
+				AAT_edge[l] = std::max(AAT_edge[l], AAT_driver[l] + edge_delay + delays[l]);
+			}
+		}
+
+		for (unsigned l = first_lane; l < last_lane; l++) {
+			this->DAG_CSR.nodes[node]->setAAT(l, std::max(AAT[l], AAT_propagated[l]));
+
+			if (AAT_propagated[l] != lanes.AAT_propagated[node * count + l]) {
+				lanes.AAT_propagated[node * count + l] = AAT_propagated[l];
+				changed = true;
+			}
+		}
+
+		return changed;
+	};
+
+	// walk the sorted DAG once; nodes are re-evaluated when their own delay or the delays of their incoming edges have changed, or when the AAT propagated by any
+	// driver has changed
+	//
+	for (unsigned node = 0; node < this->DAG_CSR.nodes.size(); node++) {
+		Block const* block = this->DAG_CSR.nodes[node]->block;
+
+		// the blocks' delays change with voltage assignment, or for soft blocks being reshaped; the last lane refers to the assigned voltages
 		//
-		for (auto &pair : node->children) {
-			child = pair.second;
+		for (unsigned l = first_lane; l < last_lane; l++) {
+			double delay = block->delay((l == count - 1) ? -1 : static_cast<int>(l));
 
-			if (TimingPowerAnalyser::DBG_VERBOSE) {
+			if (delay != lanes.delays[node * count + l]) {
+
+				lanes.delays[node * count + l] = delay;
 
-				std::cout << "DBG_TimingPowerAnalyser>   Current AAT for node " << child->block->id << ": " << child->getAAT(voltage_index) << std::endl;
+				this->timing_dirty[node] = true;
+				// memorize for RAT propagation; only required if RATs are maintained
+				this->delay_changed[node] = this->delay_changed[node] || (lanes.RAT_epoch[l] != 0);
 			}
+		}
 
-			// to estimate the interconnects delay (wires and TSVs), we consider the projected bounding box; it is reasonable to assume that all wires and TSVs will be
-			// placed within that box; also consider the centers of the blocks, as we do for interconnect estimation in general
-			//
-			bb_driver_sink = Rect::determBoundingBox(node->block->bb, child->block->bb, true);
+		if (!(full || this->timing_dirty[node] || this->AAT_changed[node] > epoch)) {
+			continue;
+		}
+		this->timing_dirty[node] = false;
 
-			// now, the AAT for the child is to be calculated considering the driver's AAT, the interconnect delay, and the delay of the child itself
-			//
-			child->setAAT(voltage_index, std::max(child->getAAT(voltage_index),
-					node->getAAT(voltage_index)
-					+ TimingPowerAnalyser::elmoreDelay(bb_driver_sink.w + bb_driver_sink.h, std::abs(node->block->layer - child->block->layer))
-					+ child->block->delay(voltage_index)
-				));
+		// the global sink is handled separately below
+		if (static_cast<int>(node) == this->DAG_CSR.sink) {
+			continue;
+		}
 
-			if (TimingPowerAnalyser::DBG_VERBOSE) {
+		// only if the propagated AAT changes, the children have to be re-evaluated as well
+		//
+		if (evaluate(node)) {
 
-				std::cout << "DBG_TimingPowerAnalyser>   Updated AAT for node " << child->block->id << ": " << child->getAAT(voltage_index) << std::endl;
-				std::cout << "DBG_TimingPowerAnalyser>    Inherent delay for this node: " << child->block->delay(voltage_index) << std::endl;
-				std::cout << "DBG_TimingPowerAnalyser>    Elmore delay for connecting " << node->block->id << " to this node: ";
-				std::cout << TimingPowerAnalyser::elmoreDelay(bb_driver_sink.w + bb_driver_sink.h, std::abs(node->block->layer - child->block->layer)) << std::endl;
-				std::cout << "DBG_TimingPowerAnalyser>     Related HPWL: " << bb_driver_sink.w + bb_driver_sink.h << std::endl;
-				std::cout << "DBG_TimingPowerAnalyser>     Related TSVs: " << std::abs(node->block->layer - child->block->layer) << std::endl;
+			for (int k = this->DAG_CSR.AAT_fanout.offsets[node]; k < this->DAG_CSR.AAT_fanout.offsets[node + 1]; k++) {
+				unsigned child = this->DAG_CSR.edge_sink[this->DAG_CSR.AAT_fanout.edges[k]];
+
+				if (child > node) {
+					this->timing_dirty[child] = true;
+				}
+				else {
+					this->timing_late.push_back(child);
+				}
 			}
 		}
 	}
+
+	// children ordered before their driver are re-evaluated only now, once all propagated AATs are final
+	//
+	for (int node : this->timing_late) {
+		evaluate(node);
+	}
+	this->timing_late.clear();
+
 	// now, solve the special case for the global sink; its AAT is simply the maximum among all parents, as there is no physical delay between those parents (the output pins)
 	// and the global sink
 	//
-	// also note that the AAT for the global sink has been set already above; reset first
-	global_sink.setAAT(voltage_index, 0);
-	for (auto &pair : global_sink.parents) {
+	DAG_Node* global_sink = this->DAG_CSR.nodes[this->DAG_CSR.sink];
 
-		global_sink.setAAT(voltage_index, std::max(
-				global_sink.getAAT(voltage_index),
-				pair.second->getAAT(voltage_index)
-			));
+	for (unsigned l = first_lane; l < last_lane; l++) {
+
+		lanes.AAT_epoch[l] = this->timing_epoch;
+
+		global_sink->setAAT(l, 0);
+		for (int parent : this->DAG_CSR.sink_parents) {
+
+			global_sink->setAAT(l, std::max(
+					global_sink->getAAT(l),
+					this->DAG_CSR.nodes[parent]->getAAT(l)
+				));
+		}
 	}
+}
 
-	// the other calculations (for RAT and slack) are only required in case voltage assignment is applied
+void TimingPowerAnalyser::propagateRAT(unsigned const& first_lane, unsigned const& last_lane, double const& global_arrival_time) {
+	TimingLanes& lanes = this->timing_lanes;
+	unsigned const count = lanes.count;
+	bool full = false;
+	unsigned long epoch = this->timing_epoch;
+
+	// same as for AAT; also, a changed global arrival time impacts all RATs
 	//
-	if (voltage_assignment) {
+	for (unsigned l = first_lane; l < last_lane; l++) {
+		full = full || (lanes.RAT_epoch[l] == 0) || (lanes.global_arrival_time[l] != global_arrival_time);
+		epoch = std::min(epoch, lanes.RAT_epoch[l]);
 
-		// next, compute the required arrival times over sorted DAG, considering the given critical delay
-		//
-		// same principle as AAT, just reversed, walking DAG backwards and using parents
-		//
-		// also ignore the very first node and last nodes (global sink and source), with the same reasoning as for the AAT
-		//
-		for (auto r_iter = (this->nets_DAG_sorted.rbegin() + 1); r_iter != (this->nets_DAG_sorted.rend() - 1); ++r_iter) {
+		lanes.global_arrival_time[l] = global_arrival_time;
+	}
 
-			DAG_Node const* node = *r_iter;
+	double* RAT_propagated = this->lanes_propagated.data();
+	double* RAT = this->lanes_final.data();
 
-			if (TimingPowerAnalyser::DBG_VERBOSE) {
+	// helper to determine the RAT of a node, for all lanes; same principle as AAT, just reversed, considering the RATs of the sinks driven by the node; returns
+	// whether the RAT to be propagated has changed for any lane
+	//
+	auto evaluate = [&](int const& node) {
+		double const* delays = &lanes.delays[node * count];
+		bool changed = false;
 
-				std::cout << "DBG_TimingPowerAnalyser>  Determine RAT for all " << node->parents.size() << " parents of node: " << node->block->id << std::endl;
-				std::cout << "DBG_TimingPowerAnalyser>  (RAT of this node: " << node->getRAT(voltage_index) << ")" << std::endl;
+		for (unsigned l = first_lane; l < last_lane; l++) {
+			RAT_propagated[l] = RAT[l] = global_arrival_time;
+		}
+
+		for (int k = this->DAG_CSR.RAT_fanout.offsets[node]; k < this->DAG_CSR.RAT_fanout.offsets[node + 1]; k++) {
+			int e = this->DAG_CSR.RAT_fanout.edges[k];
+			int sink = this->DAG_CSR.edge_sink[e];
+			double const edge_delay = this->DAG_CSR.edge_delays[e];
+			double const* RAT_sink = &lanes.RAT_propagated[sink * count];
+
+			// branch only once for all lanes, to keep the lanes' loop vectorizable
+			double* RAT_edge = (sink > node) ? RAT_propagated : RAT;
+
+			for (unsigned l = first_lane; l < last_lane; l++) {
+				RAT_edge[l] = std::min(RAT_edge[l], RAT_sink[l] - edge_delay - delays[l]);
 			}
+		}
 
-			// propagate RAT from this node to all parents
-			//
-			// note that the global source is still considered here every now and then, namely when we have an input pin as node; however, always checking whether the parent is
-			// the global source is more costly than just recalculating the proper RAT for the global source as we do below
-			//
-			for (auto &pair : node->parents) {
-				parent = pair.second;
+		for (unsigned l = first_lane; l < last_lane; l++) {
+			this->DAG_CSR.nodes[node]->setRAT(l, std::min(RAT[l], RAT_propagated[l]));
 
-				if (TimingPowerAnalyser::DBG_VERBOSE) {
+			if (RAT_propagated[l] != lanes.RAT_propagated[node * count + l]) {
+				lanes.RAT_propagated[node * count + l] = RAT_propagated[l];
+				changed = true;
+			}
+		}
 
-					std::cout << "DBG_TimingPowerAnalyser>   Current RAT for node " << parent->block->id << ": " << parent->getRAT(voltage_index) << std::endl;
-				}
+		return changed;
+	};
 
-				// to estimate the interconnects delay (wires and TSVs), we consider the projected bounding box; it is reasonable to assume that all wires and TSVs will be
-				// placed within that box; also consider the centers of the blocks, as we do for interconnect estimation in general
-				//
-				bb_driver_sink = Rect::determBoundingBox(parent->block->bb, node->block->bb, true);
+	// walk the sorted DAG once backwards
+	//
+	for (int node = this->DAG_CSR.nodes.size() - 1; node >= 0; node--) {
 
-				// now, the RAT for the parent is to be calculated considering the node's RAT, the interconnect delay, and the delay of the parent itself
-				//
-				parent->setRAT(voltage_index, std::min(parent->getRAT(voltage_index),
-						node->getRAT(voltage_index)
-						- TimingPowerAnalyser::elmoreDelay(bb_driver_sink.w + bb_driver_sink.h, std::abs(parent->block->layer - node->block->layer))
-						- parent->block->delay(voltage_index)
-					));
+		bool dirty = full || this->timing_dirty[node] || this->delay_changed[node] || this->RAT_changed[node] > epoch;
+		this->timing_dirty[node] = this->delay_changed[node] = false;
 
-				if (TimingPowerAnalyser::DBG_VERBOSE) {
+		// the global source is handled separately below
+		if (!dirty || node == this->DAG_CSR.source) {
+			continue;
+		}
+
+		// only if the propagated RAT changes, the parents have to be re-evaluated as well
+		//
+		if (evaluate(node)) {
+
+			for (int k = this->DAG_CSR.RAT_fanin.offsets[node]; k < this->DAG_CSR.RAT_fanin.offsets[node + 1]; k++) {
+				int parent = this->DAG_CSR.edge_driver[this->DAG_CSR.RAT_fanin.edges[k]];
 
-					std::cout << "DBG_TimingPowerAnalyser>   Updated RAT for node " << parent->block->id << ": " << parent->getRAT(voltage_index) << std::endl;
-					std::cout << "DBG_TimingPowerAnalyser>    Inherent delay for this node: " << parent->block->delay(voltage_index) << std::endl;
-					std::cout << "DBG_TimingPowerAnalyser>    Elmore delay for connecting this node to node " << node->block->id << ": ";
-					std::cout << TimingPowerAnalyser::elmoreDelay(bb_driver_sink.w + bb_driver_sink.h, std::abs(parent->block->layer - node->block->layer)) << std::endl;
-					std::cout << "DBG_TimingPowerAnalyser>     Related HPWL: " << bb_driver_sink.w + bb_driver_sink.h << std::endl;
-					std::cout << "DBG_TimingPowerAnalyser>     Related TSVs: " << std::abs(parent->block->layer - node->block->layer) << std::endl;
+				if (parent < node) {
+					this->timing_dirty[parent] = true;
+				}
+				else {
+					this->timing_late.push_back(parent);
 				}
 			}
 		}
-		// now, solve the special case for the global source; its RAT is simply the minimum among all children, as there is no physical delay between those children (the input
-		// pins) and the global source
-		//
-		// also note that the RAT for the global source has been set already above; reset first
-		global_source.setRAT(voltage_index, global_arrival_time);
-		for (auto &pair : global_source.children) {
+	}
 
-			global_source.setRAT(voltage_index, std::min(
-					global_source.getRAT(voltage_index),
-					pair.second->getRAT(voltage_index)
-				));
-		}
+	// parents ordered after their sink are re-evaluated only now, once all propagated RATs are final
+	//
+	for (int node : this->timing_late) {
+		evaluate(node);
+	}
+	this->timing_late.clear();
 
-		// finally, compute the slack for all DAG nodes
-		//
-		for (auto &pair : this->nets_DAG) {
+	// now, solve the special case for the global source; its RAT is simply the minimum among all children, as there is no physical delay between those children (the input
+	// pins) and the global source
+	//
+	DAG_Node* global_source = this->DAG_CSR.nodes[this->DAG_CSR.source];
 
-			DAG_Node &node = pair.second;
+	for (unsigned l = first_lane; l < last_lane; l++) {
 
-			node.setSlack(voltage_index, node.getRAT(voltage_index)- node.getAAT(voltage_index));
+		lanes.RAT_epoch[l] = this->timing_epoch;
 
-			// also memorize the _potential_ slack in the blocks themselves; only required for the cases where we pre-calculate the conservative slack models for all blocks
-			// having the same voltage index
-			if (voltage_index != -1) {
-				node.block->potential_slacks[voltage_index] = node.getSlack(voltage_index);
-			}
+		global_source->setRAT(l, global_arrival_time);
+		for (int child : this->DAG_CSR.source_children) {
+
+			global_source->setRAT(l, std::min(
+					global_source->getRAT(l),
+					this->DAG_CSR.nodes[child]->getRAT(l)
+				));
 		}
 	}
+}
 
-	if (TimingPowerAnalyser::DBG_VERBOSE) {
+void TimingPowerAnalyser::updateTiming(bool const& voltage_assignment, double const& global_arrival_time, int const& voltage_index) {
 
+	if (TimingPowerAnalyser::DBG_VERBOSE) {
 		if (voltage_index == -1) {
-			std::cout << "DBG_TimingPowerAnalyser> Final timing values for DAG, considering all the block's currently assigned voltages:" << std::endl;
+			std::cout << "DBG_TimingPowerAnalyser> Determine timing values for DAG, considering all the block's currently assigned voltages" << std::endl;
 		}
 		else {
-			std::cout << "DBG_TimingPowerAnalyser> Final timing values for DAG, considering the voltage index " << voltage_index << " for all blocks" << std::endl;
+			std::cout << "DBG_TimingPowerAnalyser> Determine timing values for DAG, considering the voltage index " << voltage_index << " for all blocks" << std::endl;
 		}
 		if (!voltage_assignment) {
-			std::cout << "DBG_TimingPowerAnalyser>  No voltage assignment is applied, so only the actual arrival time / system-level latency is valid" << std::endl;
+			std::cout << "DBG_TimingPowerAnalyser>  No voltage assignment is applied, so we determine only the actual arrival time / system-level latency here..." << std::endl;
 		}
+	}
 
-		for (DAG_Node const* node : this->nets_DAG_sorted) {
+	// the last lane refers to the configuration considering all the block's currently assigned voltages
+	//
+	unsigned lane = (voltage_index == -1) ? (this->timing_lanes.count - 1) : voltage_index;
 
-			std::cout << "DBG_TimingPowerAnalyser>  Node for block/pin " << node->block->id << std::endl;
-			std::cout << "DBG_TimingPowerAnalyser>   Topological index: " << node->index << std::endl;
-			std::cout << "DBG_TimingPowerAnalyser>   Actual arrival time: " << node->getAAT(voltage_index) << std::endl;
-			std::cout << "DBG_TimingPowerAnalyser>   Required arrival time: " << node->getRAT(voltage_index) << std::endl;
-			std::cout << "DBG_TimingPowerAnalyser>   Timing slack: " << node->getSlack(voltage_index) << std::endl;
+	this->updateTimingLanes(voltage_assignment, global_arrival_time, lane, lane + 1);
+}
+
+void TimingPowerAnalyser::updateTimingAllVoltages(bool const& voltage_assignment, double const& global_arrival_time) {
+
+	if (TimingPowerAnalyser::DBG_VERBOSE) {
+		std::cout << "DBG_TimingPowerAnalyser> Determine timing values for DAG, considering all voltage indices for all blocks" << std::endl;
+		if (!voltage_assignment) {
+			std::cout << "DBG_TimingPowerAnalyser>  No voltage assignment is applied, so we determine only the actual arrival time / system-level latency here..." << std::endl;
+		}
+	}
+
+	// all lanes except the last one, which refers to the assigned voltages
+	//
+	this->updateTimingLanes(voltage_assignment, global_arrival_time, 0, this->timing_lanes.count - 1);
+}
+
+void TimingPowerAnalyser::updateTimingLanes(bool const& voltage_assignment, double const& global_arrival_time, unsigned const& first_lane, unsigned const& last_lane) {
+
+	// first, update the interconnect delays for all blocks which have moved or changed their layer
+	//
+	this->updateInterconnectDelays();
+
+	// in any case, compute all arrival times over sorted DAG
+	//
+	this->propagateAAT(first_lane, last_lane);
+
+	// the other calculations (for RAT and slack) are only required in case voltage assignment is applied
+	//
+	if (voltage_assignment) {
+
+		// next, compute the required arrival times over sorted DAG, considering the given critical delay
+		//
+		this->propagateRAT(first_lane, last_lane, global_arrival_time);
+
+		// finally, compute the slack for all DAG nodes
+		//
+		for (DAG_Node* node : this->DAG_CSR.nodes) {
+
+			for (unsigned l = first_lane; l < last_lane; l++) {
+
+				node->setSlack(l, node->getRAT(l) - node->getAAT(l));
+
+				// also memorize the _potential_ slack in the blocks themselves; only required for the cases where we pre-calculate the conservative slack models for
+				// all blocks having the same voltage index, i.e., not for the last lane
+				if (l < this->timing_lanes.count - 1) {
+					node->block->potential_slacks[l] = node->getSlack(l);
+				}
+			}
+		}
+	}
+	// RATs are not maintained without voltage assignment; thus, they have to be fully re-determined once required
+	else {
+		for (unsigned l = first_lane; l < last_lane; l++) {
+			this->timing_lanes.RAT_epoch[l] = 0;
+		}
+	}
+
+	if (TimingPowerAnalyser::DBG_VERBOSE) {
+
+		for (unsigned l = first_lane; l < last_lane; l++) {
+
+			if (l == this->timing_lanes.count - 1) {
+				std::cout << "DBG_TimingPowerAnalyser> Final timing values for DAG, considering all the block's currently assigned voltages:" << std::endl;
+			}
+			else {
+				std::cout << "DBG_TimingPowerAnalyser> Final timing values for DAG, considering the voltage index " << l << " for all blocks" << std::endl;
+			}
+			if (!voltage_assignment) {
+				std::cout << "DBG_TimingPowerAnalyser>  No voltage assignment is applied, so only the actual arrival time / system-level latency is valid" << std::endl;
+			}
+
+			for (DAG_Node const* node : this->nets_DAG_sorted) {
+
+				std::cout << "DBG_TimingPowerAnalyser>  Node for block/pin " << node->block->id << std::endl;
+				std::cout << "DBG_TimingPowerAnalyser>   Topological index: " << node->index << std::endl;
+				std::cout << "DBG_TimingPowerAnalyser>   Actual arrival time: " << node->getAAT(l) << std::endl;
+				std::cout << "DBG_TimingPowerAnalyser>   Required arrival time: " << node->getRAT(l) << std::endl;
+				std::cout << "DBG_TimingPowerAnalyser>   Timing slack: " << node->getSlack(l) << std::endl;
+			}
 		}
 	}
 }
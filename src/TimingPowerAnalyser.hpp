@@ -205,6 +205,82 @@ class TimingPowerAnalyser {
 		/// wrapper for access of final DAG; sorted by topological indices
 		std::vector<DAG_Node const*> nets_DAG_sorted;
 
+		/// integer-indexed adjacency of the final DAG, in compressed sparse row (CSR)
+		/// layout; nodes are referred to by their position in nets_DAG_sorted, and
+		/// the edges of node i are found in edges[offsets[i]] to edges[offsets[i+1] - 1]
+		struct Adjacency {
+			std::vector<int> offsets;
+			std::vector<int> edges;
+		};
+
+		/// CSR representation of the DAG, derived from nets_DAG_sorted by initSLSTA
+		struct CSR {
+			/// driver and sink node of all edges, i.e., all parent-child relations
+			std::vector<int> edge_driver;
+			std::vector<int> edge_sink;
+
+			/// edges along which AAT is propagated, for each node as sink and as driver
+			Adjacency AAT_fanin;
+			Adjacency AAT_fanout;
+			/// edges along which RAT is propagated, for each node as driver and as sink
+			Adjacency RAT_fanout;
+			Adjacency RAT_fanin;
+			/// all edges touching a node
+			Adjacency incident;
+
+			/// DAG nodes, ordered as in nets_DAG_sorted
+			std::vector<DAG_Node*> nodes;
+
+			/// parents of global sink and children of global source; required for the
+			/// special handling of these nodes
+			std::vector<int> sink_parents;
+			std::vector<int> source_children;
+			int sink;
+			int source;
+
+			/// cached interconnect delays for all edges, and the related geometry of all nodes
+			std::vector<double> edge_delays;
+			std::vector<Rect> bbs;
+			std::vector<int> layers;
+		} DAG_CSR;
+
+		/// timing state for incremental STA, for all voltage indices; each voltage
+		/// index is handled as separate lane, and the values of all lanes are
+		/// stored contiguously per node, i.e., value of node i for lane l is found
+		/// at [i * count + l]; the last lane encodes the configuration where all
+		/// blocks have their particular best voltage assigned, as for DAG_Node
+		struct TimingLanes {
+			unsigned count;
+
+			/// epochs of the last update of AAT and RAT, for each lane; 0 if not
+			/// determined yet
+			std::vector<unsigned long> AAT_epoch;
+			std::vector<unsigned long> RAT_epoch;
+			/// global arrival time the RAT is based on, for each lane
+			std::vector<double> global_arrival_time;
+
+			/// module delays of all nodes, as considered during last update
+			std::vector<double> delays;
+			/// AAT and RAT as propagated to children and parents, respectively;
+			/// these may differ from the final values in case of edges against the
+			/// topological order
+			std::vector<double> AAT_propagated;
+			std::vector<double> RAT_propagated;
+		} timing_lanes;
+
+		/// epoch of the latest change of interconnect delays; for each node, the
+		/// epoch of the latest change impacting its AAT and RAT, respectively
+		unsigned long timing_epoch;
+		std::vector<unsigned long> AAT_changed;
+		std::vector<unsigned long> RAT_changed;
+
+		/// scratch data for the incremental propagation
+		std::vector<bool> timing_dirty;
+		std::vector<bool> delay_changed;
+		std::vector<int> timing_late;
+		std::vector<double> lanes_propagated;
+		std::vector<double> lanes_final;
+
 		// init dummy blocks for special nodes
 		Block dummy_block_DAG_source = Block(DAG_Node::SOURCE_ID);
 		Block dummy_block_DAG_sink = Block(DAG_Node::SINK_ID);
@@ -255,9 +331,14 @@ class TimingPowerAnalyser {
 			);
 
 		/// determine timing values for DAG; will also update the slack for all blocks (if voltage_assignment is true), based on the voltage index given (if -1, then the
-		//timing will be based on each / block's assigned voltage)
+		//timing will be based on each / block's assigned voltage); timing values are updated incrementally, i.e., only for the nodes affected by blocks which have moved,
+		//changed their layer, or changed their delay since the previous call for the same voltage index
 		void updateTiming(bool const& voltage_assignment, double const& global_arrival_time, int const& voltage_index = -1);
 
+		/// determine timing values for DAG, for all voltage indices at once, i.e., equivalent to calling updateTiming for each voltage index, but in one pass over
+		//the DAG
+		void updateTimingAllVoltages(bool const& voltage_assignment, double const& global_arrival_time);
+
 		double getGlobalAAT(int const& voltage_index = -1) {
 			DAG_Node const& global_sink = this->nets_DAG.at(TimingPowerAnalyser::DAG_Node::SINK_ID);
 
@@ -278,6 +359,13 @@ class TimingPowerAnalyser {
 	private:
 		void determIndicesDAG(DAG_Node *cur_node);
 		bool resolveCyclesDAG(DAG_Node *cur_node, bool const& log);
+
+		/// helpers for incremental STA over the CSR layout
+		void initCSR(unsigned const& voltages_count);
+		void updateInterconnectDelays();
+		void updateTimingLanes(bool const& voltage_assignment, double const& global_arrival_time, unsigned const& first_lane, unsigned const& last_lane);
+		void propagateAAT(unsigned const& first_lane, unsigned const& last_lane);
+		void propagateRAT(unsigned const& first_lane, unsigned const& last_lane, double const& global_arrival_time);
 };
 
 #endif
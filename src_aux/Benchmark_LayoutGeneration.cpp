@@ -0,0 +1,160 @@
+/*
+ * =====================================================================================
+ *
+ *    Description: Microbenchmark for layout generation; runtime and heap allocations per layout generation
+ *
+ *    Copyright (C) 2016 Johann Knechtel, johann aett nyu dot edu
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+#include "../src/Math.hpp"
+// further library includes
+#include <chrono>
+#include <new>
+
+// benchmark parameters; seed for random-number generator, and layout generations per
+// run and mode
+static constexpr unsigned SEED = 1;
+static constexpr unsigned ITERATIONS = 2000;
+
+// counter for heap allocations, covering all allocations of this binary
+static unsigned long long allocations = 0;
+
+// replacements of global allocation functions, for counting allocations; the array
+// and nothrow variants are implicitly covered, they are implemented via these
+// functions by the standard library
+void* operator new(std::size_t size) {
+	void* ret;
+
+	allocations++;
+
+	ret = std::malloc(size == 0 ? 1 : size);
+	if (ret == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return ret;
+}
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+// layout-generation modes
+enum class Mode : unsigned {FULL = 0, FULL_ALIGNMENT = 1, PARTIAL = 2};
+
+// forward declaration
+void benchmark(CorblivarCore& corb, int const& layers, Mode const& mode);
+
+// measures layout generation for the benchmark and config given as for Corblivar itself;
+// for a before/after comparison, build and run this tool against both revisions; it only
+// relies on the public interface of CorblivarCore
+//
+int main (int argc, char** argv) {
+	FloorPlanner fp;
+
+	std::cout << std::endl;
+	std::cout << "Layout-Generation Microbenchmark: Runtime and Heap Allocations per Layout Generation" << std::endl;
+	std::cout << "------------------------------------------------------------------------------------" << std::endl;
+	std::cout << std::endl;
+
+	// parse program parameter, config file, and further files
+	IO::parseParametersFiles(fp, argc, argv);
+	// fixed seed, overrides any seed given in config file; required for
+	// reproducible layouts across runs and revisions
+	Math::seedRand(SEED);
+	// parse blocks
+	IO::parseBlocks(fp);
+	// parse nets
+	IO::parseNets(fp);
+
+	// init Corblivar core
+	CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+	// parse alignment request
+	IO::parseAlignmentRequests(fp, corb.editAlignments());
+
+	// generate new, random data set
+	corb.initCorblivarRandomly(false, fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+
+	benchmark(corb, fp.getLayers(), Mode::FULL);
+	benchmark(corb, fp.getLayers(), Mode::FULL_ALIGNMENT);
+	benchmark(corb, fp.getLayers(), Mode::PARTIAL);
+
+	std::cout << std::endl;
+}
+
+// performs and measures layout generations; for partial regeneration, each layout
+// generation is preceded by a swap of two random blocks within a random die
+//
+void benchmark(CorblivarCore& corb, int const& layers, Mode const& mode) {
+	unsigned i;
+	unsigned long long allocations_start;
+	int die;
+	int tuples;
+	bool alignment = (mode == Mode::FULL_ALIGNMENT);
+	std::chrono::steady_clock::time_point time_start;
+	double time;
+
+	// warm-up run; memory of buffers is allocated on demand and retained
+	// afterwards
+	corb.invalidatePlacements();
+	corb.generateLayout(alignment);
+
+	allocations_start = allocations;
+	time_start = std::chrono::steady_clock::now();
+
+	for (i = 0; i < ITERATIONS; i++) {
+
+		if (mode == Mode::PARTIAL) {
+
+			die = Math::randI(0, layers);
+			tuples = corb.getDie(die).getCBL().size();
+
+			if (tuples > 1) {
+				corb.swapBlocks(die, die, Math::randI(0, tuples), Math::randI(0, tuples));
+			}
+		}
+		else {
+			corb.invalidatePlacements();
+		}
+
+		corb.generateLayout(alignment);
+	}
+
+	time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - time_start).count();
+
+	std::cout << "Benchmark> ";
+	if (mode == Mode::FULL) {
+		std::cout << "Full layout generation, w/o alignment:" << std::endl;
+	}
+	else if (mode == Mode::FULL_ALIGNMENT) {
+		std::cout << "Full layout generation, w/ alignment:" << std::endl;
+	}
+	else {
+		std::cout << "Partial layout generation after random block swaps, w/o alignment:" << std::endl;
+	}
+	std::cout << "Benchmark>  Layout generations: " << ITERATIONS << std::endl;
+	std::cout << "Benchmark>  Runtime per layout generation [us]: " << time / ITERATIONS << std::endl;
+	std::cout << "Benchmark>  Heap allocations per layout generation: " << static_cast<double>(allocations - allocations_start) / ITERATIONS << std::endl;
+}
@@ -0,0 +1,169 @@
+/*
+ * =====================================================================================
+ *
+ *    Description: Microbenchmark for voltage assignment; runtime and heap allocations for determination and selection of compound modules
+ *
+ *    Copyright (C) 2016 Johann Knechtel, johann aett nyu dot edu
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+#include "../src/MultipleVoltages.hpp"
+#include "../src/ContiguityAnalysis.hpp"
+#include "../src/Block.hpp"
+#include "../src/Math.hpp"
+// further library includes
+#include <chrono>
+#include <new>
+
+// benchmark parameters; seed for random-number generator, random layouts, and runs of
+// voltage assignment per layout
+static constexpr unsigned SEED = 1;
+static constexpr unsigned LAYOUTS = 15;
+static constexpr unsigned ITERATIONS = 5;
+
+// counter for heap allocations, covering all allocations of this binary
+static unsigned long long allocations = 0;
+
+// replacements of global allocation functions, for counting allocations; the array
+// and nothrow variants are implicitly covered, they are implemented via these
+// functions by the standard library
+void* operator new(std::size_t size) {
+	void* ret;
+
+	allocations++;
+
+	ret = std::malloc(size == 0 ? 1 : size);
+	if (ret == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return ret;
+}
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+// benchmark handler; declared as friend of FloorPlanner, in order to drive the
+// voltage-assignment steps of FloorPlanner::evaluateVoltageAssignment individually
+class VoltageAssignmentBenchmark {
+	public:
+		static void run(FloorPlanner& fp, CorblivarCore& corb);
+};
+
+// measures MultipleVoltages::determineCompoundModules and
+// MultipleVoltages::selectCompoundModules for the benchmark and config given as for
+// Corblivar itself; for a before/after comparison, build and run this tool against both
+// revisions; the checksum over the selected modules is to match for both revisions
+//
+int main (int argc, char** argv) {
+	FloorPlanner fp;
+
+	std::cout << std::endl;
+	std::cout << "Voltage-Assignment Microbenchmark: Runtime and Heap Allocations for Compound Modules" << std::endl;
+	std::cout << "------------------------------------------------------------------------------------" << std::endl;
+	std::cout << std::endl;
+
+	// parse program parameter, config file, and further files
+	IO::parseParametersFiles(fp, argc, argv);
+	// fixed seed, overrides any seed given in config file; required for
+	// reproducible layouts across runs and revisions
+	Math::seedRand(SEED);
+	// parse blocks
+	IO::parseBlocks(fp);
+	// parse nets
+	IO::parseNets(fp);
+
+	// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+	fp.initTimingPowerAnalyser();
+
+	// init Corblivar core
+	CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+	VoltageAssignmentBenchmark::run(fp, corb);
+
+	std::cout << std::endl;
+}
+
+void VoltageAssignmentBenchmark::run(FloorPlanner& fp, CorblivarCore& corb) {
+	unsigned l, i;
+	unsigned long long allocations_start;
+	unsigned long long allocations_total = 0;
+	std::chrono::steady_clock::time_point time_start, time_determine;
+	double time_total = 0.0;
+	double time_determine_total = 0.0;
+	double checksum = 0.0;
+	unsigned selected_modules = 0;
+	FloorPlanner::Cost cost;
+
+	for (l = 0; l < LAYOUTS; l++) {
+
+		// generate new, random layout
+		corb.initCorblivarRandomly(false, fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+		corb.invalidatePlacements();
+		corb.generateLayout(false);
+
+		// determine slacks, as required for feasible voltages
+		fp.evaluateTiming(cost, true);
+
+		// derive applicable voltages and contiguity for each block, as in
+		// FloorPlanner::evaluateVoltageAssignment
+		for (Block& block : fp.blocks) {
+			block.setFeasibleVoltages();
+		}
+		fp.contigAnalyser.analyseBlocks(fp.IC.layers, fp.blocks);
+
+		for (i = 0; i < ITERATIONS; i++) {
+
+			allocations_start = allocations;
+			time_start = std::chrono::steady_clock::now();
+
+			fp.voltageAssignment.determineCompoundModules(fp.blocks, fp.contigAnalyser);
+
+			time_determine = std::chrono::steady_clock::now();
+
+			std::vector<MultipleVoltages::CompoundModule*> const& selected = fp.voltageAssignment.selectCompoundModules(fp.nets, false, true);
+
+			time_total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - time_start).count();
+			time_determine_total += std::chrono::duration<double, std::milli>(time_determine - time_start).count();
+			allocations_total += allocations - allocations_start;
+
+			// checksum over selected modules, only for first run per layout
+			if (i == 0) {
+
+				for (MultipleVoltages::CompoundModule const* module : selected) {
+					checksum += module->power_saving() + module->corners_powerring_max() + module->level_shifter(false);
+				}
+
+				selected_modules += selected.size();
+			}
+		}
+	}
+
+	std::cout << "Benchmark> Random layouts: " << LAYOUTS << "; runs per layout: " << ITERATIONS << std::endl;
+	std::cout << "Benchmark> Runtime per determination and selection [ms]: " << time_total / (LAYOUTS * ITERATIONS) << std::endl;
+	std::cout << "Benchmark>  Thereof determination [ms]: " << time_determine_total / (LAYOUTS * ITERATIONS) << std::endl;
+	std::cout << "Benchmark> Heap allocations per determination and selection: " << static_cast<double>(allocations_total) / (LAYOUTS * ITERATIONS) << std::endl;
+	std::cout << "Benchmark> Selected modules, over all layouts: " << selected_modules << std::endl;
+	std::cout << "Benchmark> Checksum for selected modules: " << std::setprecision(12) << checksum << std::endl;
+}
@@ -30,7 +30,7 @@
 static constexpr bool DBG = false;
 
 // type definitions, for shorter notation
-typedef	std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> thermal_maps_layer_type;
+typedef	Map2D<ThermalAnalyzer::ThermalMapBin> thermal_maps_layer_type;
 typedef	std::vector< thermal_maps_layer_type > thermal_maps_type;
 
 // forward declaration
@@ -140,7 +140,7 @@ void parseHotSpotFiles(FloorPlanner& fp, thermal_maps_type& thermal_maps) {
 		}
 
 		// init maps structure
-		thermal_maps.emplace_back(thermal_maps_layer_type());
+		thermal_maps.emplace_back(thermal_maps_layer_type(fp.getThermalAnalyzer().dims.thermal_map, fp.getThermalAnalyzer().dims.thermal_map));
 
 		// parse file
 		//
@@ -154,7 +154,7 @@ void parseHotSpotFiles(FloorPlanner& fp, thermal_maps_type& thermal_maps) {
 
 			// drop the dummy data points, inserted for gnuplot
 			//
-			if (x == ThermalAnalyzer::THERMAL_MAP_DIM || y == ThermalAnalyzer::THERMAL_MAP_DIM) {
+			if (x == static_cast<int>(fp.getThermalAnalyzer().dims.thermal_map) || y == static_cast<int>(fp.getThermalAnalyzer().dims.thermal_map)) {
 				continue;
 			}
 
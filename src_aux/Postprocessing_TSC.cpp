@@ -40,11 +40,11 @@ static constexpr double MEAN_TO_STD_DEV_FACTOR = 0.1;
 static constexpr double MAX_CORR_RANGE = 0.99;
 
 // type definitions, for shorter notation
-typedef	std::array< std::array< std::array<double, SAMPLING_ITERATIONS> , ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> samples_data_layer_type;
+typedef	std::array< std::array< std::array<double, SAMPLING_ITERATIONS> , ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT>, ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT> samples_data_layer_type;
 typedef	std::vector< samples_data_layer_type > samples_data_type;
-typedef std::array< std::array<double, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> correlations_layer_type;
+typedef std::array< std::array<double, ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT>, ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT> correlations_layer_type;
 // copied from Variation_TSC
-typedef	std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> thermal_maps_layer_type;
+typedef	Map2D<ThermalAnalyzer::ThermalMapBin> thermal_maps_layer_type;
 typedef	std::vector< thermal_maps_layer_type > thermal_maps_type;
 
 // forward declaration
@@ -104,6 +104,13 @@ int main (int argc, char** argv) {
 
 	// parse program parameter, config file, and further files
 	IO::parseParametersFiles(fp, argc, argv);
+
+	// sanity check for maps' dimensions; the sampling data structures are
+	// dimensioned for the default thermal-map dimension
+	if (fp.getThermalAnalyzer().dims.thermal_map != ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT) {
+		std::cout << "Thermal-map dimension other than " << ThermalAnalyzer::THERMAL_MAP_DIM_DEFAULT << " is not supported by this tool!" << std::endl;
+		exit(1);
+	}
 	// parse blocks
 	IO::parseBlocks(fp);
 	// parse nets
@@ -199,8 +206,8 @@ int main (int argc, char** argv) {
 			// copy data from Corblivar power maps into local data structure power_samples
 			//
 			for (int layer = 0; layer < fp.getLayers(); layer++) {
-				for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (unsigned x = 0; x < fp.getThermalAnalyzer().dims.thermal_map; x++) {
+					for (unsigned y = 0; y < fp.getThermalAnalyzer().dims.thermal_map; y++) {
 
 						power_samples[layer][x][y][sampling_iter] = fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density;
 					}
@@ -227,8 +234,8 @@ int main (int argc, char** argv) {
 					std::cout << " Layer " << layer << std::endl;
 					std::cout << std::endl;
 
-					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+					for (unsigned x = 0; x < fp.getThermalAnalyzer().dims.thermal_map; x++) {
+						for (unsigned y = 0; y < fp.getThermalAnalyzer().dims.thermal_map; y++) {
 
 							std::cout << "  Power[" << x << "][" << y << "]: " << power_samples[layer][x][y][sampling_iter] << std::endl;
 							std::cout << "  Temp [" << x << "][" << y << "]: " << temp_samples[layer][x][y][sampling_iter] << std::endl;
@@ -264,8 +271,8 @@ int main (int argc, char** argv) {
 			count_corr = 0;
 			max_corr = 0.0;
 
-			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-				for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			for (unsigned x = 0; x < fp.getThermalAnalyzer().dims.thermal_map; x++) {
+				for (unsigned y = 0; y < fp.getThermalAnalyzer().dims.thermal_map; y++) {
 
 					avg_power = avg_temp = 0.0;
 					cov = std_dev_power = std_dev_temp = 0.0;
@@ -342,8 +349,8 @@ int main (int argc, char** argv) {
 
 			// now, also calculate the std dev of correlations 
 			std_dev_corr = 0.0;
-			for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-				for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			for (unsigned x = 0; x < fp.getThermalAnalyzer().dims.thermal_map; x++) {
+				for (unsigned y = 0; y < fp.getThermalAnalyzer().dims.thermal_map; y++) {
 
 					// consider only valid correlations values
 					if (!std::isnan(correlations[layer][x][y])) {
@@ -403,8 +410,8 @@ int main (int argc, char** argv) {
 
 				int adapted_bins_layer = 0;
 
-				for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				for (unsigned x = 0; x < fp.getThermalAnalyzer().dims.thermal_map; x++) {
+					for (unsigned y = 0; y < fp.getThermalAnalyzer().dims.thermal_map; y++) {
 
 						// consider only valid correlations values
 						if (std::isnan(correlations[layer][x][y])) {
@@ -419,10 +426,10 @@ int main (int argc, char** argv) {
 							//
 							// first determine the bb of the related grid bin
 							Rect bb;
-							bb.ll.x = x * (fp.getOutline().x / ThermalAnalyzer::THERMAL_MAP_DIM);
-							bb.ll.y = y * (fp.getOutline().y / ThermalAnalyzer::THERMAL_MAP_DIM);
-							bb.ur.x = (x + 1) * (fp.getOutline().x / ThermalAnalyzer::THERMAL_MAP_DIM);
-							bb.ur.y = (y + 1) * (fp.getOutline().y / ThermalAnalyzer::THERMAL_MAP_DIM);
+							bb.ll.x = x * (fp.getOutline().x / fp.getThermalAnalyzer().dims.thermal_map);
+							bb.ll.y = y * (fp.getOutline().y / fp.getThermalAnalyzer().dims.thermal_map);
+							bb.ur.x = (x + 1) * (fp.getOutline().x / fp.getThermalAnalyzer().dims.thermal_map);
+							bb.ur.y = (y + 1) * (fp.getOutline().y / fp.getThermalAnalyzer().dims.thermal_map);
 
 							// generate id
 							std::string id = std::string("dummy_"
@@ -622,7 +629,7 @@ void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_ty
 
 			// drop the dummy data points, inserted for gnuplot
 			//
-			if (x == ThermalAnalyzer::THERMAL_MAP_DIM || y == ThermalAnalyzer::THERMAL_MAP_DIM) {
+			if (x == static_cast<int>(fp.getThermalAnalyzer().dims.thermal_map) || y == static_cast<int>(fp.getThermalAnalyzer().dims.thermal_map)) {
 				continue;
 			}
 
@@ -735,7 +742,7 @@ void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp) {
 	unsigned x, y;
 	unsigned map_x, map_y;
 	float x_ll, y_ll;
-	float bin_w, bin_h;
+	float bin_w = 0.0, bin_h = 0.0;
 
 	/// generate floorplans for passive Si and bonding layer; considering TSVs (modelled via densities)
 	for (cur_layer = 0; cur_layer < fp.getLayers(); cur_layer++) {
@@ -761,10 +768,10 @@ void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp) {
 		file_bond << "# comments and empty lines are ignored" << std::endl;
 
 		// walk power-map grid to obtain specific TSV densities of bins
-		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+		for (x = fp.getThermalAnalyzer().dims.power_maps_padded_bins; x < fp.getThermalAnalyzer().dims.thermal_map + fp.getThermalAnalyzer().dims.power_maps_padded_bins; x++) {
 
 			// adapt index for final thermal map according to padding
-			map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+			map_x = x - fp.getThermalAnalyzer().dims.power_maps_padded_bins;
 
 			// pre-calculate bin's lower-left corner coordinates;
 			// float precision required to avoid grid coordinate
@@ -777,19 +784,19 @@ void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp) {
 			//
 			// lower bound, regular bin dimension; value also used
 			// until reaching upper bound
-			if (x == ThermalAnalyzer::POWER_MAPS_PADDED_BINS) {
+			if (x == fp.getThermalAnalyzer().dims.power_maps_padded_bins) {
 				bin_w = static_cast<float>(fp.getThermalAnalyzer().power_maps_dim_x * Math::SCALE_UM_M);
 			}
 			// upper bound, limit bin dimension according to overall
 			// chip outline; scale down slightly is required to avoid
 			// rounding errors during HotSpot's grid mapping
-			else if (x == (ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
+			else if (x == (fp.getThermalAnalyzer().dims.thermal_map + fp.getThermalAnalyzer().dims.power_maps_padded_bins - 1)) {
 				bin_w = 0.999 * static_cast<float>(fp.getOutline().x * Math::SCALE_UM_M - x_ll);
 			}
 
-			for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+			for (y = fp.getThermalAnalyzer().dims.power_maps_padded_bins; y < fp.getThermalAnalyzer().dims.thermal_map + fp.getThermalAnalyzer().dims.power_maps_padded_bins; y++) {
 				// adapt index for final thermal map according to padding
-				map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+				map_y = y - fp.getThermalAnalyzer().dims.power_maps_padded_bins;
 
 				// pre-calculate bin's lower-left corner
 				// coordinates; float precision required to avoid
@@ -802,14 +809,14 @@ void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp) {
 				//
 				// lower bound, regular bin dimension; value also used
 				// until reaching upper bound
-				if (y == ThermalAnalyzer::POWER_MAPS_PADDED_BINS) {
+				if (y == fp.getThermalAnalyzer().dims.power_maps_padded_bins) {
 					bin_h = static_cast<float>(fp.getThermalAnalyzer().power_maps_dim_y * Math::SCALE_UM_M);
 				}
 				// upper bound, limit bin dimension according to
 				// overall chip outline; scale down slightly is
 				// required to avoid rounding errors during
 				// HotSpot's grid mapping
-				else if (y == (ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS - 1)) {
+				else if (y == (fp.getThermalAnalyzer().dims.thermal_map + fp.getThermalAnalyzer().dims.power_maps_padded_bins - 1)) {
 					bin_h = 0.999 * static_cast<float>(fp.getOutline().y * Math::SCALE_UM_M - y_ll);
 				}
 
@@ -822,8 +829,8 @@ void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp) {
 				file << "	" << x_ll;
 				file << "	" << y_ll;
 				// thermal properties, depending on bin's TSV density
-				file << "	" << ThermalAnalyzer::heatCapSi(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getPowerMaps()[cur_layer][x][y].TSV_density);
-				file << "	" << ThermalAnalyzer::thermResSi(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getPowerMaps()[cur_layer][x][y].TSV_density);
+				file << "	" << ThermalAnalyzer::heatCapSi(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getTSVDensityMaps()[cur_layer][x][y]);
+				file << "	" << ThermalAnalyzer::thermResSi(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getTSVDensityMaps()[cur_layer][x][y]);
 				file << std::endl;
 
 				// put grid block as floorplan blocks; bonding layer
@@ -835,8 +842,8 @@ void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp) {
 				file_bond << "	" << x_ll;
 				file_bond << "	" << y_ll;
 				// thermal properties, depending on bin's TSV density
-				file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getPowerMaps()[cur_layer][x][y].TSV_density);
-				file_bond << "	" << ThermalAnalyzer::thermResBond(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getPowerMaps()[cur_layer][x][y].TSV_density);
+				file_bond << "	" << ThermalAnalyzer::heatCapBond(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getTSVDensityMaps()[cur_layer][x][y]);
+				file_bond << "	" << ThermalAnalyzer::thermResBond(fp.getTechParameters().TSV_group_Cu_area_ratio, fp.getThermalAnalyzer().getTSVDensityMaps()[cur_layer][x][y]);
 				file_bond << std::endl;
 			}
 		}
@@ -871,7 +878,7 @@ void parseHotSpotFiles(FloorPlanner& fp, std::string const& benchmark_suffix, th
 		}
 
 		// init maps structure
-		thermal_maps.emplace_back(thermal_maps_layer_type());
+		thermal_maps.emplace_back(thermal_maps_layer_type(fp.getThermalAnalyzer().dims.thermal_map, fp.getThermalAnalyzer().dims.thermal_map));
 
 		// parse file
 		//
@@ -885,7 +892,7 @@ void parseHotSpotFiles(FloorPlanner& fp, std::string const& benchmark_suffix, th
 
 			// drop the dummy data points, inserted for gnuplot
 			//
-			if (x == ThermalAnalyzer::THERMAL_MAP_DIM || y == ThermalAnalyzer::THERMAL_MAP_DIM) {
+			if (x == static_cast<int>(fp.getThermalAnalyzer().dims.thermal_map) || y == static_cast<int>(fp.getThermalAnalyzer().dims.thermal_map)) {
 				continue;
 			}
 